@@ -0,0 +1,372 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <algorithm> // For std::min, std::equal, std::fill
+#include <cstddef> // For size_t
+#include <initializer_list>
+#include <stdexcept> // For std::invalid_argument, std::out_of_range
+#include <type_traits> // For std::is_same
+#include <vector>
+#include "../Concurrency/TaskPool.h"
+#include "../STL/Algorithms/SimdKernels.h" // For simd::activeLevel() and the intrinsics headers
+#include "../STL/Allocators/CacheLineAllocator.h"
+
+/*
+Notes about Matrix:
+
+1. **Storage**:
+   - One contiguous row-major block (element (r, c) at r * columns() + c) that starts on a
+     64-byte boundary, instead of int matrix[2][3] on the stack or a vector of row vectors.
+     m[r][c] still works: m[r] is a pointer to row r.
+
+2. **Cache Blocking**:
+   - The textbook triple loop streams through a whole column of B for every element of C.
+     Past a few hundred columns that column no longer fits in cache, and every element of B is
+     read from memory again for each row of A.
+   - multiply() works on blocks instead: a 256 x 256 block of B (256 KB of float) stays in L2
+     while it is multiplied with 64 rows of A at a time, and the result block is added into C.
+   - transpose() copies 32 x 32 tiles, so both the rows it reads and the columns it writes
+     stay in L1 for the whole tile.
+
+3. **SIMD Kernels**:
+   - For float and double with AVX2 and FMA (picked at run time) or NEON, the block multiply
+     keeps a 4-row x 2-vector tile of C in registers (8 accumulators) and adds one row of B
+     times a broadcast element of A per step, so every load of B feeds 4 FMAs.
+   - Other element types and machines without those extensions use a plain i-k-j loop that
+     the compiler vectorizes.
+   - transpose() of 4-byte elements (float, int) with AVX2 transposes 8 x 8 sub-tiles in
+     registers (unpack / shuffle / lane permute).
+
+4. **Threads**:
+   - multiply(pool, a, b) gives every task its own band of 64 rows of C, so no two tasks write
+     the same memory. Products of 64 rows or fewer just run on the calling thread.
+*/
+
+template <typename T>
+class Matrix {
+private:
+    size_t rowCount = 0;
+    size_t columnCount = 0;
+    std::vector<T, CacheLineAllocator<T>> values;
+
+public:
+    Matrix() = default;
+
+    Matrix(size_t rows, size_t columns, const T& fill = T()) : rowCount(rows), columnCount(columns), values(rows * columns, fill) {}
+
+    // Matrix<int> m = {{1, 2, 3}, {4, 5, 6}};
+    Matrix(std::initializer_list<std::initializer_list<T>> rows) : rowCount(rows.size()), columnCount(rows.size() ? rows.begin()->size() : 0) {
+        values.reserve(rowCount * columnCount);
+        for (const auto& row : rows) {
+            if (row.size() != columnCount) throw std::invalid_argument("Matrix rows must all have the same length");
+            values.insert(values.end(), row.begin(), row.end());
+        }
+    }
+
+    static Matrix identity(size_t size) {
+        Matrix result(size, size);
+        for (size_t i = 0; i < size; ++i) result(i, i) = T(1);
+        return result;
+    }
+
+    size_t rows() const { return rowCount; }
+    size_t columns() const { return columnCount; }
+
+    T& operator()(size_t row, size_t column) { return values[row * columnCount + column]; }
+    const T& operator()(size_t row, size_t column) const { return values[row * columnCount + column]; }
+
+    T& at(size_t row, size_t column) {
+        if (row >= rowCount || column >= columnCount) throw std::out_of_range("Matrix index out of range");
+        return (*this)(row, column);
+    }
+
+    const T& at(size_t row, size_t column) const {
+        if (row >= rowCount || column >= columnCount) throw std::out_of_range("Matrix index out of range");
+        return (*this)(row, column);
+    }
+
+    // Row pointers, so m[r][c] reads like a built-in 2D array
+    T* operator[](size_t row) { return values.data() + row * columnCount; }
+    const T* operator[](size_t row) const { return values.data() + row * columnCount; }
+
+    T* data() { return values.data(); }
+    const T* data() const { return values.data(); }
+
+    void fill(const T& value) { std::fill(values.begin(), values.end(), value); }
+
+    bool operator==(const Matrix& other) const {
+        return rowCount == other.rowCount && columnCount == other.columnCount && std::equal(values.begin(), values.end(), other.values.begin());
+    }
+
+    bool operator!=(const Matrix& other) const { return !(*this == other); }
+};
+
+namespace matrix_detail {
+
+constexpr size_t blockRows = 64; // Rows of A (and C) per block, also the rows per parallel task
+constexpr size_t blockDepth = 256; // Columns of A / rows of B per block
+constexpr size_t blockColumns = 256; // Columns of B (and C) per block
+constexpr size_t tile = 32; // transpose tile edge
+
+// c[rows x columns] += a[rows x depth] * b[depth x columns]; each pointer has its own row stride
+template <typename T>
+void multiplyBlockScalar(const T* a, size_t aStride, const T* b, size_t bStride, T* c, size_t cStride,
+                         size_t rows, size_t depth, size_t columns) {
+    for (size_t i = 0; i < rows; ++i) {
+        T* cRow = c + i * cStride;
+        for (size_t k = 0; k < depth; ++k) {
+            T factor = a[i * aStride + k];
+            const T* bRow = b + k * bStride;
+            for (size_t j = 0; j < columns; ++j) {
+                cRow[j] += factor * bRow[j]; // Contiguous in j: the compiler vectorizes this loop
+            }
+        }
+    }
+}
+
+// The x86 kernels are compiled for AVX2 + FMA and only called when the CPU has both (simd::hasAvx2Fma())
+#if SIMD_HAS_AVX2_DISPATCH
+#define MATRIX_SIMD __attribute__((target("avx2,fma")))
+#else
+#define MATRIX_SIMD
+#endif
+
+#if SIMD_HAS_AVX2_DISPATCH
+namespace avx2 {
+
+struct FloatOps {
+    static constexpr size_t width = 8;
+    MATRIX_SIMD static __m256 load(const float* p) { return _mm256_loadu_ps(p); }
+    MATRIX_SIMD static void store(float* p, __m256 v) { _mm256_storeu_ps(p, v); }
+    MATRIX_SIMD static __m256 broadcast(float x) { return _mm256_set1_ps(x); }
+    MATRIX_SIMD static __m256 fma(__m256 a, __m256 b, __m256 c) { return _mm256_fmadd_ps(a, b, c); }
+};
+
+struct DoubleOps {
+    static constexpr size_t width = 4;
+    MATRIX_SIMD static __m256d load(const double* p) { return _mm256_loadu_pd(p); }
+    MATRIX_SIMD static void store(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+    MATRIX_SIMD static __m256d broadcast(double x) { return _mm256_set1_pd(x); }
+    MATRIX_SIMD static __m256d fma(__m256d a, __m256d b, __m256d c) { return _mm256_fmadd_pd(a, b, c); }
+};
+
+// 8 x 8 block of 4-byte elements: source rows sStride apart to target rows tStride apart, transposed
+MATRIX_SIMD inline void transpose8x8(const float* source, size_t sStride, float* target, size_t tStride) {
+    __m256 r0 = _mm256_loadu_ps(source), r1 = _mm256_loadu_ps(source + sStride);
+    __m256 r2 = _mm256_loadu_ps(source + 2 * sStride), r3 = _mm256_loadu_ps(source + 3 * sStride);
+    __m256 r4 = _mm256_loadu_ps(source + 4 * sStride), r5 = _mm256_loadu_ps(source + 5 * sStride);
+    __m256 r6 = _mm256_loadu_ps(source + 6 * sStride), r7 = _mm256_loadu_ps(source + 7 * sStride);
+    // Interleave pairs of rows, then pairs of pairs; the last step swaps the 128-bit halves
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 t4 = _mm256_unpacklo_ps(r4, r5), t5 = _mm256_unpackhi_ps(r4, r5);
+    __m256 t6 = _mm256_unpacklo_ps(r6, r7), t7 = _mm256_unpackhi_ps(r6, r7);
+    __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0)), u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0)), u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0)), u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0)), u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+    _mm256_storeu_ps(target, _mm256_permute2f128_ps(u0, u4, 0x20));
+    _mm256_storeu_ps(target + tStride, _mm256_permute2f128_ps(u1, u5, 0x20));
+    _mm256_storeu_ps(target + 2 * tStride, _mm256_permute2f128_ps(u2, u6, 0x20));
+    _mm256_storeu_ps(target + 3 * tStride, _mm256_permute2f128_ps(u3, u7, 0x20));
+    _mm256_storeu_ps(target + 4 * tStride, _mm256_permute2f128_ps(u0, u4, 0x31));
+    _mm256_storeu_ps(target + 5 * tStride, _mm256_permute2f128_ps(u1, u5, 0x31));
+    _mm256_storeu_ps(target + 6 * tStride, _mm256_permute2f128_ps(u2, u6, 0x31));
+    _mm256_storeu_ps(target + 7 * tStride, _mm256_permute2f128_ps(u3, u7, 0x31));
+}
+
+} // namespace avx2
+#endif // SIMD_HAS_AVX2_DISPATCH
+
+#if SIMD_HAS_NEON
+namespace neon {
+
+struct FloatOps {
+    static constexpr size_t width = 4;
+    static float32x4_t load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, float32x4_t v) { vst1q_f32(p, v); }
+    static float32x4_t broadcast(float x) { return vdupq_n_f32(x); }
+    static float32x4_t fma(float32x4_t a, float32x4_t b, float32x4_t c) { return vfmaq_f32(c, a, b); }
+};
+
+struct DoubleOps {
+    static constexpr size_t width = 2;
+    static float64x2_t load(const double* p) { return vld1q_f64(p); }
+    static void store(double* p, float64x2_t v) { vst1q_f64(p, v); }
+    static float64x2_t broadcast(double x) { return vdupq_n_f64(x); }
+    static float64x2_t fma(float64x2_t a, float64x2_t b, float64x2_t c) { return vfmaq_f64(c, a, b); }
+};
+
+} // namespace neon
+#endif // SIMD_HAS_NEON
+
+#if SIMD_HAS_AVX2_DISPATCH || SIMD_HAS_NEON
+// The 4 x (2 vectors) register tile; Ops supplies the vector type and its load/store/fma
+template <typename T, typename Ops>
+MATRIX_SIMD void multiplyTiles(const T* a, size_t aStride, const T* b, size_t bStride, T* c, size_t cStride,
+                               size_t rows, size_t depth, size_t columns) {
+    constexpr size_t width = Ops::width, tileColumns = 2 * width;
+    size_t fullRows = rows - rows % 4, fullColumns = columns - columns % tileColumns;
+    for (size_t i = 0; i < fullRows; i += 4) {
+        for (size_t j = 0; j < fullColumns; j += tileColumns) {
+            T* c0 = c + i * cStride + j;
+            T* c1 = c0 + cStride;
+            T* c2 = c1 + cStride;
+            T* c3 = c2 + cStride;
+            auto s00 = Ops::load(c0), s01 = Ops::load(c0 + width);
+            auto s10 = Ops::load(c1), s11 = Ops::load(c1 + width);
+            auto s20 = Ops::load(c2), s21 = Ops::load(c2 + width);
+            auto s30 = Ops::load(c3), s31 = Ops::load(c3 + width);
+            const T* a0 = a + i * aStride;
+            for (size_t k = 0; k < depth; ++k) {
+                const T* bRow = b + k * bStride + j;
+                auto b0 = Ops::load(bRow), b1 = Ops::load(bRow + width);
+                auto f = Ops::broadcast(a0[k]);
+                s00 = Ops::fma(f, b0, s00);
+                s01 = Ops::fma(f, b1, s01);
+                f = Ops::broadcast(a0[aStride + k]);
+                s10 = Ops::fma(f, b0, s10);
+                s11 = Ops::fma(f, b1, s11);
+                f = Ops::broadcast(a0[2 * aStride + k]);
+                s20 = Ops::fma(f, b0, s20);
+                s21 = Ops::fma(f, b1, s21);
+                f = Ops::broadcast(a0[3 * aStride + k]);
+                s30 = Ops::fma(f, b0, s30);
+                s31 = Ops::fma(f, b1, s31);
+            }
+            Ops::store(c0, s00);
+            Ops::store(c0 + width, s01);
+            Ops::store(c1, s10);
+            Ops::store(c1 + width, s11);
+            Ops::store(c2, s20);
+            Ops::store(c2 + width, s21);
+            Ops::store(c3, s30);
+            Ops::store(c3 + width, s31);
+        }
+    }
+    // The columns right of the last full tile, then the rows below the last group of 4
+    if (fullColumns < columns) {
+        multiplyBlockScalar(a, aStride, b + fullColumns, bStride, c + fullColumns, cStride, fullRows,
+                            depth, columns - fullColumns);
+    }
+    if (fullRows < rows) {
+        multiplyBlockScalar(a + fullRows * aStride, aStride, b, bStride, c + fullRows * cStride,
+                            cStride, rows - fullRows, depth, columns);
+    }
+}
+#endif
+
+#undef MATRIX_SIMD
+
+template <typename T>
+void multiplyBlock(const T* a, size_t aStride, const T* b, size_t bStride, T* c, size_t cStride,
+                   size_t rows, size_t depth, size_t columns) {
+    constexpr bool isFloat = std::is_same<T, float>::value, isDouble = std::is_same<T, double>::value;
+#if SIMD_HAS_AVX2_DISPATCH
+    if constexpr (isFloat || isDouble) {
+        if (simd::hasAvx2Fma()) {
+            using Ops = std::conditional_t<isFloat, avx2::FloatOps, avx2::DoubleOps>;
+            multiplyTiles<T, Ops>(a, aStride, b, bStride, c, cStride, rows, depth, columns);
+            return;
+        }
+    }
+#elif SIMD_HAS_NEON
+    if constexpr (isFloat || isDouble) {
+        if (simd::activeLevel() == simd::Level::Neon) {
+            using Ops = std::conditional_t<isFloat, neon::FloatOps, neon::DoubleOps>;
+            multiplyTiles<T, Ops>(a, aStride, b, bStride, c, cStride, rows, depth, columns);
+            return;
+        }
+    }
+#else
+    (void)isFloat;
+    (void)isDouble;
+#endif
+    multiplyBlockScalar(a, aStride, b, bStride, c, cStride, rows, depth, columns);
+}
+
+// Rows [rowFrom, rowTo) of c += a * b, block by block
+template <typename T>
+void multiplyRows(const Matrix<T>& a, const Matrix<T>& b, Matrix<T>& c, size_t rowFrom, size_t rowTo) {
+    size_t depth = a.columns(), columns = b.columns();
+    for (size_t jj = 0; jj < columns; jj += blockColumns) {
+        size_t blockWidth = std::min(blockColumns, columns - jj);
+        for (size_t kk = 0; kk < depth; kk += blockDepth) {
+            size_t blockHeight = std::min(blockDepth, depth - kk);
+            for (size_t ii = rowFrom; ii < rowTo; ii += blockRows) { // One block of B, reused for every block of rows
+                multiplyBlock(a[ii] + kk, depth, b[kk] + jj, columns, c[ii] + jj, columns,
+                              std::min(blockRows, rowTo - ii), blockHeight, blockWidth);
+            }
+        }
+    }
+}
+
+template <typename T>
+void checkShapes(const Matrix<T>& a, const Matrix<T>& b) {
+    if (a.columns() != b.rows()) throw std::invalid_argument("Matrix multiply: a.columns() != b.rows()");
+}
+
+} // namespace matrix_detail
+
+template <typename T>
+Matrix<T> transpose(const Matrix<T>& m) {
+    using namespace matrix_detail;
+    Matrix<T> result(m.columns(), m.rows());
+    size_t rows = m.rows(), columns = m.columns();
+    for (size_t ii = 0; ii < rows; ii += tile) {
+        for (size_t jj = 0; jj < columns; jj += tile) {
+            size_t rowEnd = std::min(ii + tile, rows), columnEnd = std::min(jj + tile, columns);
+            size_t i = ii;
+#if SIMD_HAS_AVX2_DISPATCH
+            if constexpr (sizeof(T) == 4 && std::is_arithmetic<T>::value) {
+                if (simd::hasAvx2Fma() && rowEnd - ii == tile && columnEnd - jj == tile) {
+                    for (; i < rowEnd; i += 8) {
+                        for (size_t j = jj; j < columnEnd; j += 8) {
+                            avx2::transpose8x8(reinterpret_cast<const float*>(m[i] + j), columns,
+                                               reinterpret_cast<float*>(result[j] + i), rows);
+                        }
+                    }
+                }
+            }
+#endif
+            for (; i < rowEnd; ++i) {
+                for (size_t j = jj; j < columnEnd; ++j) {
+                    result(j, i) = m(i, j);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+template <typename T>
+Matrix<T> multiply(const Matrix<T>& a, const Matrix<T>& b) {
+    matrix_detail::checkShapes(a, b);
+    Matrix<T> result(a.rows(), b.columns());
+    matrix_detail::multiplyRows(a, b, result, 0, a.rows());
+    return result;
+}
+
+// The same product with each band of 64 rows of the result computed by its own task
+template <typename T>
+Matrix<T> multiply(TaskPool& pool, const Matrix<T>& a, const Matrix<T>& b) {
+    matrix_detail::checkShapes(a, b);
+    Matrix<T> result(a.rows(), b.columns());
+    size_t bands = (a.rows() + matrix_detail::blockRows - 1) / matrix_detail::blockRows;
+    if (pool.threadCount() <= 1 || bands < 2) {
+        matrix_detail::multiplyRows(a, b, result, 0, a.rows());
+        return result;
+    }
+    pool.parallel_for(0, bands, [&](size_t band) {
+        size_t from = band * matrix_detail::blockRows;
+        matrix_detail::multiplyRows(a, b, result, from, std::min(from + matrix_detail::blockRows, a.rows()));
+    }, 1);
+    return result;
+}
+
+template <typename T>
+Matrix<T> operator*(const Matrix<T>& a, const Matrix<T>& b) {
+    return multiply(a, b);
+}
+
+#endif // MATRIX_H
@@ -0,0 +1,301 @@
+#ifndef STRING_UTILS_H
+#define STRING_UTILS_H
+
+#include <cstddef> // For size_t
+#include <cstdint> // For uint32_t
+#include <cstring> // For std::memchr, std::memcmp, std::memcpy
+#include <string>
+#include <string_view>
+#include <type_traits> // For std::is_same, std::decay_t
+#include <utility> // For std::swap
+#include <vector>
+#include "../STL/Algorithms/SimdKernels.h" // For simd::activeLevel() and the intrinsics headers
+#include "../STL/Vector/SimpleVector.h"
+
+/*
+Notes about the string utilities:
+
+1. **Views Instead of Copies**:
+   - find and split return positions and std::string_views into the original text: splitting
+     a log line into fields copies nothing and allocates nothing (split(text, ',', fields)
+     reuses the vector's capacity from the previous line). The views are only valid while the
+     text they point into is alive and unchanged.
+
+2. **SIMD Scans**:
+   - find(text, ch) and split compare 32 bytes at a time (AVX2) and turn the matches into a
+     bit mask, so split walks the delimiters of a whole block from the mask instead of
+     calling a search function once per field. Without AVX2 they use std::memchr, which the C
+     library vectorizes already.
+   - find(text, needle) first checks the needle's first and last byte against 32 positions at
+     once and only compares the full needle where both match.
+   - reverse swaps 32-byte blocks from both ends, reversing each with one byte shuffle,
+     instead of swapping one byte pair per iteration.
+   - The AVX2 versions are picked at run time like in SimdKernels.h; on ARM64 reverse uses
+     NEON and the searches use std::memchr.
+
+3. **One Allocation per Concatenation**:
+   - a + ", " + b + "!" builds a temporary string for every +, and each may reallocate as it
+     grows. concat(a, ", ", b, "!") and StringBuilder add up the lengths of all parts first
+     and reserve exactly that once.
+   - Results up to the small-string capacity (15 characters in libstdc++, 22 in libc++) live
+     inside the std::string object itself, so short results don't allocate at all.
+   - StringBuilder only keeps views of its parts until str(): the parts must outlive it.
+     Its list of parts starts in an inline buffer (SmallVector<Part, 8>), so building a
+     string from a handful of parts doesn't allocate anything but the result.
+*/
+
+namespace string_utils {
+
+#if SIMD_HAS_AVX2_DISPATCH
+namespace avx2 {
+
+#define STRING_AVX2 __attribute__((target("avx2")))
+
+STRING_AVX2 inline __m256i load(const char* data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)); }
+
+STRING_AVX2 inline uint32_t matches(const char* data, __m256i byte) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(load(data), byte)));
+}
+
+STRING_AVX2 inline __m256i reversed(__m256i block) {
+    const __m256i order = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                           15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    block = _mm256_shuffle_epi8(block, order); // Reverse within each 16-byte half
+    return _mm256_permute2x128_si256(block, block, 0x01); // Swap the halves
+}
+
+// Reverses the outer blocks of data; returns how many bytes at each end are done
+STRING_AVX2 inline size_t reverseBlocks(char* data, size_t size) {
+    size_t done = 0;
+    for (; 2 * (done + 32) <= size; done += 32) {
+        __m256i front = load(data + done);
+        __m256i back = load(data + size - done - 32);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + done), reversed(back));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + size - done - 32), reversed(front));
+    }
+    return done;
+}
+
+STRING_AVX2 inline size_t find(const char* data, size_t size, char ch) {
+    __m256i byte = _mm256_set1_epi8(ch);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        uint32_t mask = matches(data + i, byte);
+        if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    const void* hit = std::memchr(data + i, ch, size - i);
+    return hit ? static_cast<size_t>(static_cast<const char*>(hit) - data) : std::string_view::npos;
+}
+
+// needle.size() >= 2: filter on the first and last byte, then compare the middle
+STRING_AVX2 inline size_t find(const char* data, size_t size, std::string_view needle) {
+    size_t last = needle.size() - 1;
+    __m256i first = _mm256_set1_epi8(needle[0]);
+    __m256i final = _mm256_set1_epi8(needle[last]);
+    size_t i = 0;
+    for (; i + last + 32 <= size; i += 32) {
+        __m256i both = _mm256_and_si256(_mm256_cmpeq_epi8(load(data + i), first), _mm256_cmpeq_epi8(load(data + i + last), final));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(both));
+        while (mask != 0) {
+            size_t at = i + static_cast<size_t>(__builtin_ctz(mask));
+            if (std::memcmp(data + at + 1, needle.data() + 1, last - 1) == 0) return at;
+            mask &= mask - 1;
+        }
+    }
+    size_t rest = std::string_view(data + i, size - i).find(needle);
+    return rest == std::string_view::npos ? rest : i + rest;
+}
+
+// Calls field(view) for every field between delimiters
+template <typename Field>
+STRING_AVX2 void split(const char* data, size_t size, char delimiter, Field& field) {
+    __m256i byte = _mm256_set1_epi8(delimiter);
+    size_t start = 0, i = 0;
+    for (; i + 32 <= size; i += 32) {
+        uint32_t mask = matches(data + i, byte);
+        while (mask != 0) {
+            size_t at = i + static_cast<size_t>(__builtin_ctz(mask));
+            field(std::string_view(data + start, at - start));
+            start = at + 1;
+            mask &= mask - 1;
+        }
+    }
+    for (; i < size; ++i) {
+        if (data[i] == delimiter) {
+            field(std::string_view(data + start, i - start));
+            start = i + 1;
+        }
+    }
+    field(std::string_view(data + start, size - start));
+}
+
+#undef STRING_AVX2
+
+} // namespace avx2
+#endif // SIMD_HAS_AVX2_DISPATCH
+
+inline bool useAvx2() {
+#if SIMD_HAS_AVX2_DISPATCH
+    return simd::activeLevel() == simd::Level::Avx2;
+#else
+    return false;
+#endif
+}
+
+// Reverses size bytes in place
+inline void reverse(char* data, size_t size) {
+    size_t done = 0;
+#if SIMD_HAS_AVX2_DISPATCH
+    if (useAvx2()) done = avx2::reverseBlocks(data, size);
+#elif SIMD_HAS_NEON
+    for (; 2 * (done + 16) <= size; done += 16) {
+        uint8_t* front = reinterpret_cast<uint8_t*>(data + done);
+        uint8_t* back = reinterpret_cast<uint8_t*>(data + size - done - 16);
+        uint8x16_t f = vrev64q_u8(vld1q_u8(front)), b = vrev64q_u8(vld1q_u8(back));
+        vst1q_u8(front, vextq_u8(b, b, 8)); // vrev64 reverses each 8-byte half, vext swaps them
+        vst1q_u8(back, vextq_u8(f, f, 8));
+    }
+#endif
+    for (size_t left = done, right = size - done; left + 1 < right; ++left, --right) {
+        std::swap(data[left], data[right - 1]);
+    }
+}
+
+inline void reverse(std::string& text) {
+    reverse(text.data(), text.size());
+}
+
+// Position of the first ch at or after from, npos if none
+inline size_t find(std::string_view text, char ch, size_t from = 0) {
+    if (from >= text.size()) return std::string_view::npos;
+    size_t rest = text.size() - from;
+#if SIMD_HAS_AVX2_DISPATCH
+    if (useAvx2()) {
+        size_t at = avx2::find(text.data() + from, rest, ch);
+        return at == std::string_view::npos ? at : from + at;
+    }
+#endif
+    const void* hit = std::memchr(text.data() + from, ch, rest);
+    return hit ? static_cast<size_t>(static_cast<const char*>(hit) - text.data()) : std::string_view::npos;
+}
+
+// Position of the first needle at or after from, npos if none
+inline size_t find(std::string_view text, std::string_view needle, size_t from = 0) {
+    if (needle.size() <= 1 || from > text.size()) {
+        return needle.empty() ? (from <= text.size() ? from : std::string_view::npos) : find(text, needle[0], from);
+    }
+#if SIMD_HAS_AVX2_DISPATCH
+    if (useAvx2()) {
+        size_t at = avx2::find(text.data() + from, text.size() - from, needle);
+        return at == std::string_view::npos ? at : from + at;
+    }
+#endif
+    return text.find(needle, from);
+}
+
+// field(view) for every field of text between delimiters (n delimiters give n + 1 fields)
+template <typename Field>
+void forEachField(std::string_view text, char delimiter, Field field) {
+#if SIMD_HAS_AVX2_DISPATCH
+    if (useAvx2()) {
+        avx2::split(text.data(), text.size(), delimiter, field);
+        return;
+    }
+#endif
+    size_t start = 0;
+    while (true) {
+        size_t at = find(text, delimiter, start);
+        if (at == std::string_view::npos) break;
+        field(text.substr(start, at - start));
+        start = at + 1;
+    }
+    field(text.substr(start));
+}
+
+// Fields of text into fields (cleared first, its capacity is reused)
+inline void split(std::string_view text, char delimiter, std::vector<std::string_view>& fields) {
+    fields.clear();
+    forEachField(text, delimiter, [&fields](std::string_view field) { fields.push_back(field); });
+}
+
+inline std::vector<std::string_view> split(std::string_view text, char delimiter) {
+    std::vector<std::string_view> fields;
+    split(text, delimiter, fields);
+    return fields;
+}
+
+namespace detail {
+
+inline std::string_view view(std::string_view text) { return text; }
+inline std::string_view view(const char& ch) { return std::string_view(&ch, 1); }
+
+} // namespace detail
+
+// All parts (strings, string_views, C strings or chars) in one string, allocated once
+template <typename... Parts>
+std::string concat(const Parts&... parts) {
+    size_t total = (detail::view(parts).size() + ... + 0);
+    std::string result;
+    result.reserve(total); // No allocation at all if total fits the small-string buffer
+    (result.append(detail::view(parts)), ...);
+    return result;
+}
+
+// Collects views of the parts and their total length; str() allocates the result once
+class StringBuilder {
+private:
+    struct Part {
+        const char* data;
+        size_t size;
+        bool isChar; // The part is ch, kept here: a view of the caller's char could dangle
+        char ch;
+    };
+
+    SmallVector<Part, 8> parts;
+    size_t total = 0;
+
+    static std::string_view textOf(const Part& part) {
+        return part.isChar ? std::string_view(&part.ch, 1) : std::string_view(part.data, part.size);
+    }
+
+public:
+    StringBuilder& append(std::string_view text) {
+        parts.push_back(Part{text.data(), text.size(), false, '\0'});
+        total += text.size();
+        return *this;
+    }
+
+    StringBuilder& append(char ch) {
+        parts.push_back(Part{nullptr, 1, true, ch});
+        total += 1;
+        return *this;
+    }
+
+    StringBuilder& operator<<(std::string_view text) { return append(text); }
+    StringBuilder& operator<<(char ch) { return append(ch); }
+
+    size_t size() const { return total; }
+
+    void clear() {
+        parts.clear();
+        total = 0;
+    }
+
+    // Appends everything to out, growing it at most once
+    void appendTo(std::string& out) const {
+        out.reserve(out.size() + total);
+        for (const Part& part : parts) {
+            out.append(textOf(part));
+        }
+    }
+
+    std::string str() const {
+        std::string result;
+        appendTo(result);
+        return result;
+    }
+};
+
+} // namespace string_utils
+
+#endif // STRING_UTILS_H
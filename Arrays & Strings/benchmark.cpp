@@ -0,0 +1,271 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Matrix.h"
+#include "StringUtils.h"
+#include "../Benchmarks/AllocationCounter.h"
+
+using namespace std;
+
+/*
+Benchmark: string_utils vs the usual std::string code, and Matrix multiply vs the triple loop
+
+Strings, over ~8 MB of synthetic log lines:
+
+- Lines look like "2024-05-17T12:34:56,INFO,worker-17,request 4711 served in 23 ms,user=alice".
+- reverse: the byte-pair swap loop from reverseString vs string_utils::reverse on every line.
+- find: std::string::find vs string_utils::find, for a character (',') and a substring
+  ("served in") in the whole text.
+- split: substr copies into a vector<string> vs split into a reused vector<string_view>.
+- concat: a + ", " + b + "!" vs concat(a, ", ", b, "!") vs StringBuilder, with short
+  (small-string) and long results.
+- Allocations are counted by Benchmarks/AllocationCounter.h.
+
+Matrices (float), 64 x 64, 512 x 512 and 4096 x 4096:
+- The naive i-j-k triple loop over a row-major array, multiply(a, b) (blocked, one thread) and
+  multiply(pool, a, b) (blocked, one band of rows per task), in GFLOP/s (2 n^3 flops per
+  product). For 4096 the naive loop only computes the first 32 rows, otherwise it would take
+  minutes; its rate doesn't depend on how many rows it does.
+- transpose(m) vs the plain two-loop transpose, in GB/s (read + written).
+
+Pass `strings` or `matrix` to run only that part, and `scalar` to force the non-SIMD paths.
+
+Build: g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+*/
+
+static volatile size_t sink; // Keeps the optimizer from deleting the loops
+
+template <typename Body>
+void measure(const char* name, size_t bytes, Body body) {
+    size_t allocationsBefore = bench::allocationsSoFar().calls;
+    auto start = chrono::steady_clock::now();
+    size_t operations = body();
+    auto end = chrono::steady_clock::now();
+    size_t allocations = bench::allocationsSoFar().calls - allocationsBefore;
+
+    double ms = chrono::duration<double, milli>(end - start).count();
+    cout << "  " << name << ": " << ms << " ms";
+    if (bytes > 0) cout << ", " << bytes / (ms * 1000.0) << " MB/s";
+    cout << ", " << (double)allocations / operations << " allocations/op" << endl;
+}
+
+static vector<string> makeLines(size_t totalBytes) {
+    const char* levels[] = {"INFO", "WARN", "DEBUG", "ERROR"};
+    const char* users[] = {"alice", "bob", "carol", "dave", "eve"};
+    mt19937 random(2024);
+    vector<string> lines;
+    size_t bytes = 0;
+    while (bytes < totalBytes) {
+        string line = "2024-05-17T12:" + to_string(10 + random() % 50) + ":" + to_string(10 + random() % 50);
+        line += string(",") + levels[random() % 4] + ",worker-" + to_string(random() % 32);
+        line += ",request " + to_string(random() % 100000) + (random() % 8 == 0 ? " served in " : " queued for ");
+        line += to_string(random() % 500) + " ms,user=" + users[random() % 5];
+        bytes += line.size() + 1;
+        lines.push_back(move(line));
+    }
+    return lines;
+}
+
+// The loop from reverseString in Pointers & Functions/main.cpp
+static void swapReverse(string& str) {
+    int n = (int)str.length();
+    for (int i = 0; i < n / 2; i++) {
+        swap(str[i], str[n - i - 1]);
+    }
+}
+
+static void reverseBenchmark(vector<string> lines, size_t bytes) {
+    cout << "reverse every line:" << endl;
+    measure("byte swap loop       ", bytes, [&] {
+        for (string& line : lines) swapReverse(line);
+        sink = lines[0][0];
+        return lines.size();
+    });
+    measure("string_utils::reverse", bytes, [&] {
+        for (string& line : lines) string_utils::reverse(line);
+        sink = lines[0][0];
+        return lines.size();
+    });
+}
+
+template <typename Needle>
+static void findBenchmark(const char* what, const string& text, Needle needle) {
+    cout << "find every " << what << " in the text:" << endl;
+    size_t stdHits = 0, ourHits = 0;
+    measure("std::string::find  ", text.size(), [&] {
+        for (size_t at = text.find(needle); at != string::npos; at = text.find(needle, at + 1)) ++stdHits;
+        sink = stdHits;
+        return stdHits + 1;
+    });
+    measure("string_utils::find ", text.size(), [&] {
+        string_view view(text);
+        for (size_t at = string_utils::find(view, needle); at != string::npos; at = string_utils::find(view, needle, at + 1)) ++ourHits;
+        sink = ourHits;
+        return ourHits + 1;
+    });
+    if (stdHits != ourHits) cout << "  MISMATCH: " << stdHits << " vs " << ourHits << endl;
+}
+
+static void splitBenchmark(const vector<string>& lines, size_t bytes) {
+    cout << "split every line at ',':" << endl;
+    measure("substr into vector<string>   ", bytes, [&] {
+        size_t fields = 0;
+        for (const string& line : lines) {
+            vector<string> parts;
+            size_t start = 0;
+            while (true) {
+                size_t at = line.find(',', start);
+                parts.push_back(line.substr(start, at == string::npos ? string::npos : at - start));
+                if (at == string::npos) break;
+                start = at + 1;
+            }
+            fields += parts.size();
+        }
+        sink = fields;
+        return lines.size();
+    });
+    measure("split into vector<string_view>", bytes, [&] {
+        size_t fields = 0;
+        vector<string_view> parts;
+        for (const string& line : lines) {
+            string_utils::split(line, ',', parts);
+            fields += parts.size();
+        }
+        sink = fields;
+        return lines.size();
+    });
+}
+
+static void concatBenchmark(const char* what, const string& greeting, const string& name, size_t rounds) {
+    cout << "concatenate " << what << " (" << (greeting.size() + name.size() + 3) << " characters):" << endl;
+    measure("greeting + \", \" + name + \"!\"", 0, [&] {
+        size_t total = 0;
+        for (size_t r = 0; r < rounds; ++r) {
+            string full = greeting + ", " + name + "!";
+            total += full.size();
+        }
+        sink = total;
+        return rounds;
+    });
+    measure("concat(greeting, \", \", name, '!')", 0, [&] {
+        size_t total = 0;
+        for (size_t r = 0; r < rounds; ++r) {
+            string full = string_utils::concat(greeting, ", ", name, '!');
+            total += full.size();
+        }
+        sink = total;
+        return rounds;
+    });
+    measure("StringBuilder                  ", 0, [&] {
+        size_t total = 0;
+        for (size_t r = 0; r < rounds; ++r) {
+            string_utils::StringBuilder builder;
+            builder << greeting << ", " << name << '!';
+            total += builder.str().size();
+        }
+        sink = total;
+        return rounds;
+    });
+}
+
+// c = a * b for the first `rows` rows, the textbook way
+static void naiveMultiply(const float* a, const float* b, float* c, size_t n, size_t rows) {
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            float sum = 0;
+            for (size_t k = 0; k < n; ++k) {
+                sum += a[i * n + k] * b[k * n + j]; // Walks down a column of b: a new cache line every step
+            }
+            c[i * n + j] = sum;
+        }
+    }
+}
+
+// Seconds per call, repeating the call until at least 0.2 s have passed
+template <typename Body>
+double secondsPerCall(Body body) {
+    size_t calls = 0;
+    auto start = chrono::steady_clock::now();
+    double elapsed = 0;
+    do {
+        body();
+        ++calls;
+        elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    } while (elapsed < 0.2);
+    return elapsed / calls;
+}
+
+static void matrixBenchmark(TaskPool& pool) {
+    mt19937 random(4096);
+    uniform_real_distribution<float> value(-1.0f, 1.0f);
+    for (size_t n : {64, 512, 4096}) {
+        Matrix<float> a(n, n), b(n, n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                a(i, j) = value(random);
+                b(i, j) = value(random);
+            }
+        }
+        size_t naiveRows = n > 512 ? 32 : n;
+        Matrix<float> c(n, n);
+        double flops = 2.0 * n * n * n;
+        double naive = secondsPerCall([&] { naiveMultiply(a.data(), b.data(), c.data(), n, naiveRows); }) * n / naiveRows;
+        sink = static_cast<size_t>(c(0, 0));
+        double blocked = secondsPerCall([&] { c = multiply(a, b); });
+        sink = static_cast<size_t>(c(0, 0));
+        double parallelTime = secondsPerCall([&] { c = multiply(pool, a, b); });
+        sink = static_cast<size_t>(c(0, 0));
+        cout << n << " x " << n << " multiply: naive " << flops / naive / 1e9 << ", blocked " << flops / blocked / 1e9
+             << ", blocked parallel " << flops / parallelTime / 1e9 << " GFLOP/s" << endl;
+
+        double bytes = 2.0 * n * n * sizeof(float);
+        double plain = secondsPerCall([&] {
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) c(j, i) = a(i, j);
+            }
+        });
+        sink = static_cast<size_t>(c(0, 0));
+        double tiled = secondsPerCall([&] { c = transpose(a); });
+        sink = static_cast<size_t>(c(0, 0));
+        cout << n << " x " << n << " transpose: two loops " << bytes / plain / 1e9 << ", tiled " << bytes / tiled / 1e9 << " GB/s" << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bool strings = true, matrices = true;
+    for (int i = 1; i < argc; ++i) {
+        string mode = argv[i];
+        if (mode == "scalar") simd::useScalar(true);
+        if (mode == "strings") matrices = false;
+        if (mode == "matrix") strings = false;
+    }
+    cout << "SIMD level: " << simd::levelName(simd::activeLevel()) << endl;
+    if (matrices) {
+        TaskPool pool;
+        cout << pool.threadCount() << " threads" << endl;
+        matrixBenchmark(pool);
+    }
+    if (!strings) return 0;
+
+    vector<string> lines = makeLines(8 << 20);
+    string text;
+    for (const string& line : lines) {
+        text += line;
+        text += '\n';
+    }
+    cout << lines.size() << " lines, " << text.size() << " bytes" << endl;
+
+    reverseBenchmark(lines, text.size());
+    findBenchmark("','", text, ',');
+    findBenchmark("\"served in\"", text, string_view("served in"));
+    splitBenchmark(lines, text.size());
+    concatBenchmark("a short greeting", "Hello", "John", 2000000);
+    concatBenchmark("a long greeting", "Good evening and welcome back", "Johnathan Livingston", 2000000);
+    return 0;
+}
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <string>
+#include "Matrix.h"
+#include "StringUtils.h"
 using namespace std;
 
 int main() {
@@ -50,6 +52,22 @@ int main() {
         cout << endl;
     }
 
+    // d. Matrix<T> (Matrix.h): the same 2x3 layout in one aligned, contiguous block whose size is
+    //    chosen at run time, with cache-blocked multiply and transpose for real numeric work
+    Matrix<int> grid = {
+        {1, 2, 3},
+        {4, 5, 6}
+    };
+    cout << "\nMatrix element at [1][2]: " << grid[1][2] << endl; // Same indexing as the built-in 2D array
+    Matrix<int> product = grid * transpose(grid); // (2x3) * (3x2) = 2x2
+    cout << "grid * transpose(grid):\n";
+    for (size_t row = 0; row < product.rows(); row++) {
+        for (size_t col = 0; col < product.columns(); col++) {
+            cout << product(row, col) << " ";
+        }
+        cout << endl;
+    }
+
     // ===========================
     // 2. Strings in C++
     // ===========================
@@ -82,6 +100,16 @@ int main() {
     string fullGreeting = greeting + ", " + name + "!"; // Concatenates strings
     cout << "\nConcatenated String: " << fullGreeting << endl; // Outputs: Hello, John!
 
+    // Every + above creates a temporary string; concat measures all parts first and allocates once
+    string joinedGreeting = string_utils::concat(greeting, ", ", name, '!');
+    cout << "Concatenated with concat: " << joinedGreeting << endl; // Outputs: Hello, John!
+
+    // string_view fields point into the original string instead of copying it
+    string csvLine = "apple,orange,cherry";
+    for (string_view field : string_utils::split(csvLine, ',')) {
+        cout << "Field: " << field << endl;
+    }
+
     // Comparing strings
     string str1 = "apple";
     string str2 = "orange";
@@ -0,0 +1,123 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <atomic>
+#include <cerrno> // For EINVAL, ENOMEM
+#include <cstddef> // For size_t
+#include <cstdint> // For uint64_t
+#include <cstdlib> // For std::malloc, std::free
+#include <new> // For std::bad_alloc
+
+/*
+Notes about the allocation counter:
+
+1. **What Is Counted**:
+   - Every heap allocation of the program: its number and its requested bytes. Frees are
+     not counted; a benchmark that allocates per element shows it as calls per run.
+   - With glibc, malloc/calloc/realloc and the aligned variants are interposed, and
+     operator new is built on malloc, so containers, std::string and std::function are
+     all counted. Elsewhere operator new / new[] are replaced instead,
+     which misses direct malloc calls (BENCH_COUNTS_MALLOC is 0 then).
+   - The counters are relaxed atomics, so allocations on other threads (a TaskPool's
+     workers) are counted too.
+
+2. **Use**:
+   - The replacement functions are defined here, not just declared: include this header
+     (or Harness.h, which includes it) in exactly one .cpp of a program, its benchmark.cpp.
+     Every benchmark that counts allocations uses it, so they all count the same way.
+   - bench::allocationsSoFar() returns the running totals; subtract two of them.
+*/
+
+namespace bench {
+
+struct AllocationCount {
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+};
+
+namespace allocation_detail {
+
+// Constant-initialized, so they work for allocations made before main
+inline std::atomic<uint64_t> calls{0};
+inline std::atomic<uint64_t> bytes{0};
+
+inline void note(size_t size) {
+    calls.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+} // namespace allocation_detail
+
+inline AllocationCount allocationsSoFar() {
+    return AllocationCount{allocation_detail::calls.load(std::memory_order_relaxed),
+                           allocation_detail::bytes.load(std::memory_order_relaxed)};
+}
+
+} // namespace bench
+
+#if defined(__GLIBC__)
+#define BENCH_COUNTS_MALLOC 1
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+
+void* malloc(size_t size) noexcept {
+    bench::allocation_detail::note(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept {
+    bench::allocation_detail::note(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) noexcept {
+    bench::allocation_detail::note(size);
+    return __libc_realloc(ptr, size);
+}
+
+// Aligned operator new (FlatHashMap's table, CacheLineAllocator) ends up here
+void* aligned_alloc(size_t alignment, size_t size) noexcept {
+    bench::allocation_detail::note(size);
+    return __libc_memalign(alignment, size);
+}
+
+void* memalign(size_t alignment, size_t size) noexcept {
+    bench::allocation_detail::note(size);
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** result, size_t alignment, size_t size) noexcept {
+    if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) return EINVAL;
+    bench::allocation_detail::note(size);
+    void* ptr = __libc_memalign(alignment, size);
+    if (ptr == nullptr) return ENOMEM;
+    *result = ptr;
+    return 0;
+}
+}
+#else
+#define BENCH_COUNTS_MALLOC 0
+
+void* operator new(size_t size) {
+    bench::allocation_detail::note(size);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    bench::allocation_detail::note(size);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+#endif
+
+#endif // ALLOCATION_COUNTER_H
@@ -0,0 +1,314 @@
+#ifndef BENCHMARK_HARNESS_H
+#define BENCHMARK_HARNESS_H
+
+#include <algorithm> // For std::sort, std::min
+#include <chrono>
+#include <cmath> // For std::ceil
+#include <cstddef> // For size_t
+#include <cstdint> // For uint64_t
+#include <cstdlib> // For std::strtod, std::strtol
+#include <fstream>
+#include <iomanip> // For std::setw
+#include <iostream>
+#include <map>
+#include <memory> // For std::unique_ptr
+#include <stdexcept> // For std::invalid_argument, std::runtime_error
+#include <string>
+#include <type_traits> // For std::invoke_result_t, std::is_void_v
+#include <utility> // For std::forward
+#include <vector>
+#include "AllocationCounter.h"
+#include "PerfCounters.h"
+
+/*
+Notes about the benchmark harness:
+
+1. **Measuring**:
+   - run(name, items, body) calls body a few times untimed (warm-up: caches, branch
+     predictors, lazily allocated memory), then `repetitions` timed times. Each repetition
+     gives one time per item (`items` is how many operations one call of body does).
+   - run(name, items, setup, body): setup() runs before every call, untimed, and its result
+     is passed to body (a vector to sort, a tree to traverse), so each repetition starts
+     from the same state.
+   - A body's return value goes through doNotOptimize(), so the computation can't be
+     deleted as unused. Use doNotOptimize() inside loops too where a result would
+     otherwise be dead.
+
+2. **Reporting**:
+   - Per benchmark: min / median / p90 / p99 / max of the repetitions (in ns per item; with 15
+     repetitions p90 and p99 are the 2nd slowest and the slowest), heap allocations and
+     bytes per call of body (AllocationCounter.h), and with --perf, hardware counters per
+     item (PerfCounters.h).
+   - --json FILE writes every result as JSON, one result per line.
+
+3. **Regression Gate**:
+   - --compare FILE reads an earlier --json file and fails (finish() returns 1) if a
+     benchmark's median got slower by more than --tolerance (default 10%) or it allocates
+     more per call than before. Benchmarks missing from the file are reported and pass.
+   - Timings only compare on the same machine, build type and load: keep the baseline
+     file next to the build, not in the repository.
+
+4. **Options**:
+   - --repetitions N, --warmup N, --filter TEXT (run only names containing TEXT), --json FILE,
+     --compare FILE, --tolerance PERCENT, --perf.
+*/
+
+namespace bench {
+
+// Makes the compiler assume value is read, so the code computing it is kept
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+struct Options {
+    int warmup = 2;
+    int repetitions = 15;
+    std::string filter;
+    std::string jsonPath;
+    std::string comparePath;
+    double tolerance = 0.10;
+    bool perf = false;
+
+    static Options parse(int argc, char** argv) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            std::string option = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument(option + " needs a value");
+                return argv[++i];
+            };
+            if (option == "--repetitions") {
+                options.repetitions = std::max(1, static_cast<int>(std::strtol(value().c_str(), nullptr, 10)));
+            } else if (option == "--warmup") {
+                options.warmup = std::max(0, static_cast<int>(std::strtol(value().c_str(), nullptr, 10)));
+            } else if (option == "--filter") {
+                options.filter = value();
+            } else if (option == "--json") {
+                options.jsonPath = value();
+            } else if (option == "--compare") {
+                options.comparePath = value();
+            } else if (option == "--tolerance") {
+                options.tolerance = std::strtod(value().c_str(), nullptr) / 100;
+            } else if (option == "--perf") {
+                options.perf = true;
+            } else {
+                throw std::invalid_argument("unknown option " + option +
+                                            " (options: --repetitions N, --warmup N, --filter TEXT, --json FILE, "
+                                            "--compare FILE, --tolerance PERCENT, --perf)");
+            }
+        }
+        return options;
+    }
+};
+
+struct Result {
+    std::string name;
+    size_t items = 0;
+    int repetitions = 0;
+    double minNs = 0, medianNs = 0, p90Ns = 0, p99Ns = 0, maxNs = 0; // Per item
+    double allocations = 0, allocatedBytes = 0; // Per call of body
+    bool hasCounters = false;
+    double cycles = 0, instructions = 0, branchMisses = 0, cacheMisses = 0; // Per item
+};
+
+class Harness {
+private:
+    struct NoState {};
+
+    std::string suite;
+    Options options;
+    std::vector<Result> results;
+    std::unique_ptr<PerfCounters> counters; // Only with --perf
+
+    static double percentile(const std::vector<double>& sorted, double fraction) {
+        size_t rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+        return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+    }
+
+    static std::string escape(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\') escaped += '\\';
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    static void print(const Result& result) {
+        std::cout << "  " << std::left << std::setw(40) << result.name << std::right << " median " << std::setw(9)
+                  << result.medianNs << " ns/item (min " << result.minNs << ", p90 " << result.p90Ns << ", p99 "
+                  << result.p99Ns << "), " << result.allocations << " allocs / " << result.allocatedBytes << " B per run";
+        if (result.hasCounters) {
+            double ipc = result.cycles > 0 ? result.instructions / result.cycles : 0;
+            std::cout << ", " << result.cycles << " cycles/item, IPC " << ipc << ", " << result.branchMisses
+                      << " branch misses/item, " << result.cacheMisses << " LLC misses/item";
+        }
+        std::cout << std::endl;
+    }
+
+    void writeJson() const {
+        std::ofstream out(options.jsonPath);
+        if (!out) throw std::runtime_error("Cannot write " + options.jsonPath);
+        out << "{\n  \"suite\": \"" << escape(suite) << "\",\n  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            out << "    {\"name\": \"" << escape(r.name) << "\", \"items\": " << r.items << ", \"repetitions\": " << r.repetitions
+                << ", \"min_ns\": " << r.minNs << ", \"median_ns\": " << r.medianNs << ", \"p90_ns\": " << r.p90Ns
+                << ", \"p99_ns\": " << r.p99Ns << ", \"max_ns\": " << r.maxNs << ", \"allocations\": " << r.allocations
+                << ", \"allocated_bytes\": " << r.allocatedBytes;
+            if (r.hasCounters) {
+                out << ", \"cycles\": " << r.cycles << ", \"instructions\": " << r.instructions
+                    << ", \"branch_misses\": " << r.branchMisses << ", \"cache_misses\": " << r.cacheMisses;
+            }
+            out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+    // name -> {median ns, allocations} from a file written by writeJson
+    static std::map<std::string, std::pair<double, double>> readBaseline(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) throw std::runtime_error("Cannot read baseline " + path);
+        std::map<std::string, std::pair<double, double>> baseline;
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t at = line.find("\"name\": \"");
+            if (at == std::string::npos) continue;
+            std::string name;
+            for (at += 9; at < line.size() && line[at] != '"'; ++at) {
+                if (line[at] == '\\' && at + 1 < line.size()) ++at;
+                name += line[at];
+            }
+            auto number = [&](const char* key) {
+                size_t found = line.find(key);
+                return found == std::string::npos ? 0.0 : std::strtod(line.c_str() + found + std::char_traits<char>::length(key), nullptr);
+            };
+            baseline[name] = {number("\"median_ns\": "), number("\"allocations\": ")};
+        }
+        return baseline;
+    }
+
+    // Number of regressions against the baseline file
+    int compare() const {
+        auto baseline = readBaseline(options.comparePath);
+        int regressions = 0;
+        std::cout << "Against " << options.comparePath << " (tolerance " << options.tolerance * 100 << "%):" << std::endl;
+        for (const Result& result : results) {
+            auto found = baseline.find(result.name);
+            if (found == baseline.end()) {
+                std::cout << "  new        " << result.name << std::endl;
+                continue;
+            }
+            auto [baseMedian, baseAllocations] = found->second;
+            double change = baseMedian > 0 ? (result.medianNs / baseMedian - 1) * 100 : 0;
+            bool slower = result.medianNs > baseMedian * (1 + options.tolerance);
+            bool allocates = result.allocations > baseAllocations + 0.5;
+            regressions += slower || allocates;
+            std::cout << "  " << (slower || allocates ? "REGRESSION " : "ok         ") << result.name << ": " << std::showpos
+                      << change << std::noshowpos << "% time";
+            if (allocates) std::cout << ", allocations " << baseAllocations << " -> " << result.allocations;
+            std::cout << std::endl;
+        }
+        return regressions;
+    }
+
+public:
+    Harness(std::string suiteName, int argc, char** argv) : suite(std::move(suiteName)), options(Options::parse(argc, argv)) {
+        if (options.perf) counters = std::make_unique<PerfCounters>();
+        std::cout << suite << ": " << options.repetitions << " repetitions after " << options.warmup << " warm-up";
+        if (counters) std::cout << (counters->available() ? ", hardware counters on" : ", hardware counters unavailable");
+        if (!BENCH_COUNTS_MALLOC) std::cout << ", counting operator new only";
+        std::cout << std::endl;
+    }
+
+    const Options& settings() const { return options; }
+
+    template <typename Setup, typename Body>
+    void run(const std::string& name, size_t items, Setup&& setup, Body&& body) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) return;
+        using State = decltype(setup());
+        auto call = [&](State& state) {
+            if constexpr (std::is_void_v<std::invoke_result_t<Body&, State&>>) {
+                body(state);
+            } else {
+                doNotOptimize(body(state));
+            }
+        };
+        for (int i = 0; i < options.warmup; ++i) {
+            State state = setup();
+            call(state);
+        }
+
+        std::vector<double> samples;
+        AllocationCount allocated;
+        PerfSample totals;
+        for (int i = 0; i < options.repetitions; ++i) {
+            State state = setup();
+            AllocationCount before = allocationsSoFar();
+            if (counters) counters->start();
+            auto start = std::chrono::steady_clock::now();
+            call(state);
+            auto end = std::chrono::steady_clock::now();
+            PerfSample sample = counters ? counters->stop() : PerfSample();
+            AllocationCount after = allocationsSoFar();
+            samples.push_back(std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(items));
+            allocated.calls += after.calls - before.calls;
+            allocated.bytes += after.bytes - before.bytes;
+            totals.valid = sample.valid;
+            totals.cycles += sample.cycles;
+            totals.instructions += sample.instructions;
+            totals.branchMisses += sample.branchMisses;
+            totals.cacheMisses += sample.cacheMisses;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        Result result;
+        result.name = name;
+        result.items = items;
+        result.repetitions = options.repetitions;
+        result.minNs = samples.front();
+        result.medianNs = percentile(samples, 0.5);
+        result.p90Ns = percentile(samples, 0.9);
+        result.p99Ns = percentile(samples, 0.99);
+        result.maxNs = samples.back();
+        result.allocations = static_cast<double>(allocated.calls) / options.repetitions;
+        result.allocatedBytes = static_cast<double>(allocated.bytes) / options.repetitions;
+        if (totals.valid) {
+            double perItem = static_cast<double>(items) * options.repetitions;
+            result.hasCounters = true;
+            result.cycles = totals.cycles / perItem;
+            result.instructions = totals.instructions / perItem;
+            result.branchMisses = totals.branchMisses / perItem;
+            result.cacheMisses = totals.cacheMisses / perItem;
+        }
+        print(result);
+        results.push_back(result);
+    }
+
+    template <typename Body>
+    void run(const std::string& name, size_t items, Body&& body) {
+        run(name, items, [] { return NoState(); }, [&](NoState&) -> decltype(auto) { return body(); });
+    }
+
+    // Writes the JSON file and compares with the baseline (if asked to); returns the exit code
+    int finish() const {
+        if (!options.jsonPath.empty()) {
+            writeJson();
+            std::cout << "Wrote " << options.jsonPath << std::endl;
+        }
+        if (options.comparePath.empty()) return 0;
+        int regressions = compare();
+        std::cout << regressions << " regression(s)" << std::endl;
+        return regressions == 0 ? 0 : 1;
+    }
+};
+
+} // namespace bench
+
+#endif // BENCHMARK_HARNESS_H
@@ -0,0 +1,124 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint> // For uint64_t
+#include <cstring> // For std::memset
+
+#if defined(__linux__)
+#include <linux/perf_event.h> // For perf_event_attr, PERF_COUNT_HW_*
+#include <sys/ioctl.h> // For ioctl
+#include <sys/syscall.h> // For SYS_perf_event_open
+#include <unistd.h> // For syscall, read, close
+#define BENCH_HAS_PERF_EVENTS 1
+#else
+#define BENCH_HAS_PERF_EVENTS 0
+#endif
+
+/*
+Notes about the hardware counters:
+
+1. **What They Measure**:
+   - Cycles, instructions (so instructions per cycle), branch misses and last-level cache
+     misses of the calling thread, in user space only, over a start()/stop() window.
+     Threads the code starts itself aren't included.
+   - Opened as one group, so all four count over exactly the same window; if the CPU has
+     fewer free counters than that, the kernel rotates the group in and out and the values
+     are scaled by the time it was actually counting.
+
+2. **When They Are Missing**:
+   - perf_event_open is Linux only, and is often refused: inside containers and VMs, or when
+     /proc/sys/kernel/perf_event_paranoid is above 2. available() is false then and
+     stop() returns a sample with valid == false; benchmarks still run, just without the
+     counter columns. An event the CPU doesn't have (some VMs have no cache-miss event) is
+     left out and reads as 0, the others still count.
+*/
+
+namespace bench {
+
+struct PerfSample {
+    bool valid = false;
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t branchMisses = 0;
+    uint64_t cacheMisses = 0;
+};
+
+class PerfCounters {
+private:
+    static constexpr int eventCount = 4;
+    int fds[eventCount] = {-1, -1, -1, -1}; // fds[0] leads the group
+
+#if BENCH_HAS_PERF_EVENTS
+    static int open(uint64_t config, int groupFd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = groupFd == -1 ? 1 : 0; // The leader starts and stops the group
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+    }
+
+    // The value scaled up to the whole window if the counter only ran part of it
+    uint64_t readScaled(int fd) const {
+        if (fd < 0) return 0;
+        uint64_t values[3] = {0, 0, 0}; // Value, time enabled, time running
+        if (::read(fd, values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)) || values[2] == 0) return 0;
+        if (values[2] >= values[1]) return values[0];
+        return static_cast<uint64_t>(static_cast<double>(values[0]) * values[1] / values[2]);
+    }
+#endif
+
+public:
+    PerfCounters() {
+#if BENCH_HAS_PERF_EVENTS
+        const uint64_t configs[eventCount] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                              PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES};
+        fds[0] = open(configs[0], -1);
+        if (fds[0] < 0) return;
+        for (int i = 1; i < eventCount; ++i) fds[i] = open(configs[i], fds[0]);
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters() {
+#if BENCH_HAS_PERF_EVENTS
+        for (int fd : fds) {
+            if (fd >= 0) ::close(fd);
+        }
+#endif
+    }
+
+    bool available() const { return fds[0] >= 0; }
+
+    void start() {
+#if BENCH_HAS_PERF_EVENTS
+        if (!available()) return;
+        ::ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ::ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    PerfSample stop() {
+        PerfSample sample;
+#if BENCH_HAS_PERF_EVENTS
+        if (!available()) return sample;
+        ::ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        sample.valid = true;
+        sample.cycles = readScaled(fds[0]);
+        sample.instructions = readScaled(fds[1]);
+        sample.branchMisses = readScaled(fds[2]);
+        sample.cacheMisses = readScaled(fds[3]);
+#endif
+        return sample;
+    }
+};
+
+} // namespace bench
+
+#endif // PERF_COUNTERS_H
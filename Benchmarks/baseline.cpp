@@ -0,0 +1,884 @@
+#define INTEGER_WRAPPER_LOGGING 0 // Production mode: no printing per copy/move
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <queue>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stack>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+#include "Harness.h"
+#include "../Arrays & Strings/Matrix.h"
+#include "../Arrays & Strings/StringUtils.h"
+#include "../Exception Handling/Validation.h"
+#include "../NameSpaces/TransactionEngine.h"
+#include "../OOPs/Classes_Obj_Constructors/Employee.h"
+#include "../OOPs/Classes_Obj_Constructors/EmployeeTable.h"
+#include "../OOPs/Function Overriding/StaticDispatch.h"
+#include "../OOPs/Operator Overaloading/ComplexArray.h"
+#include "../STL/Algorithms/ParallelAlgorithms.h"
+#include "../STL/Algorithms/RadixSort.h"
+#include "../STL/Iterators/FastIO.h"
+#include "../STL/Lambda Functions/FunctionRef.h"
+#include "../STL/Lambda Functions/InplaceFunction.h"
+#include "../STL/LinkedList/SinglyLinkedList.h"
+#include "../STL/PriorityQueue/IndexedHeap.h"
+#include "../STL/Stack&Queue/RingBuffer.h"
+#include "../STL/TreeSet & TreeMap/BTree.h"
+#include "../STL/TreeSet & TreeMap/FlatMap.h"
+#include "../STL/Trees/BinaryTree.h"
+#include "../STL/Trees/FlatBinaryTree.h"
+#include "../STL/Unordered Map & Set/FlatHashMap.h"
+#include "../STL/Vector/SimpleVector.h"
+#include "../Semantics and R Values/IntegerWrapper.h"
+#include "../Smart Pointers/IntrusivePtr.h"
+#include "../Smart Pointers/SubscriberRegistry.h"
+
+using namespace std;
+
+/*
+Baseline benchmarks: the repository's own containers next to the standard ones they stand in for
+
+- One harness (Harness.h) for all of them: warm-up, repetitions, ns per item percentiles,
+  allocations and bytes per run, optional hardware counters, JSON output and a regression
+  gate (see the notes there). The module benchmarks (benchmark.cpp in each directory)
+  explore one design question each; this one is the fixed set whose numbers are tracked.
+- Every module written for speed has a few cases here, its fast path next to the code it
+  replaces, so bench-check guards them too: the parallel and SIMD algorithms, string_utils,
+  Matrix, IntrusivePtr, SubscriberRegistry, Expected, ComplexArray, FunctionRef and
+  InplaceFunction, PolyCollection, EmployeeTable and the TransactionEngine.
+- Sizes are large enough to leave the L1/L2 caches (100K-1M elements) but keep a full run
+  under a minute.
+- With CMake: `cmake --build build --target bench` runs everything, `bench-baseline` saves
+  this suite's results as the reference, `bench-check` compares against it and fails on a
+  regression.
+
+Build: g++ -std=c++17 -O2 -pthread baseline.cpp -o baseline
+Run:   ./baseline [--json results.json] [--compare reference.json] [--tolerance 10] [--perf]
+*/
+
+constexpr size_t bigCount = 1000000;
+constexpr size_t itemCount = 100000;
+
+static vector<int> randomInts(size_t n, uint32_t seed) {
+    mt19937 random(seed);
+    vector<int> values(n);
+    for (int& value : values) value = static_cast<int>(random() % (n * 4));
+    return values;
+}
+
+// A complete tree of n nodes in level order (no -1 holes)
+static vector<int> levelOrder(size_t n) {
+    vector<int> values(n);
+    for (size_t i = 0; i < n; ++i) values[i] = static_cast<int>(i);
+    return values;
+}
+
+static void sequences(bench::Harness& harness) {
+    harness.run("std::vector<int> push_back", bigCount, [] {
+        vector<int> values;
+        for (size_t i = 0; i < bigCount; ++i) values.push_back(static_cast<int>(i));
+        return values.size();
+    });
+    harness.run("SimpleVector<int> push_back", bigCount, [] {
+        SimpleVector<int> values;
+        for (size_t i = 0; i < bigCount; ++i) values.push_back(static_cast<int>(i));
+        return values.getSize();
+    });
+    harness.run("SmallVector<int, 8> 6 push_backs", itemCount, [] {
+        size_t total = 0;
+        for (size_t i = 0; i < itemCount; ++i) {
+            SmallVector<int, 8> small; // Fits the inline storage: no allocation
+            for (int j = 0; j < 6; ++j) small.push_back(j);
+            bench::doNotOptimize(small[5]);
+            total += small.getSize();
+        }
+        return total;
+    });
+    harness.run("std::deque<int> push_back", bigCount, [] {
+        deque<int> values;
+        for (size_t i = 0; i < bigCount; ++i) values.push_back(static_cast<int>(i));
+        return values.size();
+    });
+    harness.run("std::list<int> push_back", itemCount, [] {
+        list<int> values;
+        for (size_t i = 0; i < itemCount; ++i) values.push_back(static_cast<int>(i));
+        return values.size();
+    });
+    harness.run("SinglyLinkedList push_back + clear", itemCount, [] {
+        SinglyLinkedList values;
+        for (size_t i = 0; i < itemCount; ++i) values.push_back(static_cast<int>(i));
+        values.clear();
+        return values.size();
+    });
+    harness.run("PooledSinglyLinkedList push_back + clear", itemCount, [] {
+        PooledSinglyLinkedList values;
+        for (size_t i = 0; i < itemCount; ++i) values.push_back(static_cast<int>(i));
+        values.clear();
+        return values.size();
+    });
+    harness.run("std::stack<int> push + pop", bigCount, [] {
+        stack<int> values;
+        for (size_t i = 0; i < bigCount; ++i) values.push(static_cast<int>(i));
+        int64_t sum = 0;
+        while (!values.empty()) {
+            sum += values.top();
+            values.pop();
+        }
+        return sum;
+    });
+    harness.run("std::queue<int> push + pop", bigCount, [] {
+        queue<int> values;
+        for (size_t i = 0; i < bigCount; ++i) values.push(static_cast<int>(i));
+        int64_t sum = 0;
+        while (!values.empty()) {
+            sum += values.front();
+            values.pop();
+        }
+        return sum;
+    });
+    harness.run("SpscRingBuffer<int> push + pop", bigCount, [] {
+        SpscRingBuffer<int> ring(1024);
+        int64_t sum = 0;
+        int value = 0;
+        for (size_t i = 0; i < bigCount; ++i) { // One thread, pushing and popping in turn
+            ring.try_push(static_cast<int>(i));
+            ring.try_pop(value);
+            sum += value;
+        }
+        return sum;
+    });
+}
+
+static void wrappers(bench::Harness& harness) {
+    harness.run("vector<IntegerWrapper> grow", itemCount, [] {
+        vector<IntegerWrapper> values;
+        for (size_t i = 0; i < itemCount; ++i) values.emplace_back(static_cast<int>(i)); // Growth moves, noexcept
+        return values.size();
+    });
+    harness.run("vector<PooledIntegerWrapper> grow", itemCount, [] {
+        vector<PooledIntegerWrapper> values;
+        for (size_t i = 0; i < itemCount; ++i) values.emplace_back(static_cast<int>(i));
+        return values.size();
+    });
+    harness.run(
+        "vector<IntegerWrapper> copy-assign", itemCount,
+        [] {
+            vector<IntegerWrapper> source, target;
+            for (size_t i = 0; i < itemCount; ++i) {
+                source.emplace_back(static_cast<int>(i));
+                target.emplace_back(0);
+            }
+            return make_pair(move(source), move(target));
+        },
+        [](pair<vector<IntegerWrapper>, vector<IntegerWrapper>>& vectors) {
+            vectors.second = vectors.first; // Same sizes: every int is reused, nothing allocated
+            return vectors.second.size();
+        });
+}
+
+static void trees(bench::Harness& harness) {
+    vector<int> order = levelOrder(itemCount);
+    harness.run("BinaryTree build + destroy", itemCount, [&] {
+        BinaryTree tree;
+        tree.constructTreeFromLevelOrder(order);
+    });
+    harness.run("PooledBinaryTree build + destroy", itemCount, [&] {
+        PooledBinaryTree tree;
+        tree.constructTreeFromLevelOrder(order);
+    });
+    harness.run(
+        "BinaryTree inorder sum", itemCount,
+        [&] {
+            auto tree = make_unique<BinaryTree>();
+            tree->constructTreeFromLevelOrder(order);
+            return tree;
+        },
+        [](unique_ptr<BinaryTree>& tree) {
+            int64_t sum = 0;
+            tree->forEachInorder([&sum](int value) { sum += value; });
+            return sum;
+        });
+    harness.run(
+        "FlatBinaryTree inorder sum", itemCount,
+        [&] {
+            FlatBinaryTree tree;
+            tree.constructTreeFromLevelOrder(order);
+            return tree;
+        },
+        [](FlatBinaryTree& tree) {
+            int64_t sum = 0;
+            tree.forEachInorder([&sum](int value) { sum += value; });
+            return sum;
+        });
+}
+
+static void associative(bench::Harness& harness) {
+    vector<int> keys = randomInts(itemCount, 1);
+    vector<int> probes = randomInts(itemCount, 2);
+
+    harness.run("std::set<int> insert", itemCount, [&] {
+        set<int> values(keys.begin(), keys.end());
+        return values.size();
+    });
+    harness.run("BTreeSet<int> insert", itemCount, [&] {
+        BTreeSet<int> values;
+        for (int key : keys) values.insert(key);
+        return values.size();
+    });
+    harness.run("FlatSet<int> insert (bulk)", itemCount, [&] {
+        FlatSet<int> values;
+        values.insert(keys.begin(), keys.end());
+        return values.size();
+    });
+    harness.run("std::map<int, int> insert", itemCount, [&] {
+        map<int, int> values;
+        for (int key : keys) values[key] = key;
+        return values.size();
+    });
+    harness.run("std::unordered_map<int, int> insert", itemCount, [&] {
+        unordered_map<int, int> values;
+        for (int key : keys) values[key] = key;
+        return values.size();
+    });
+    harness.run("FlatHashMap<int, int> insert", itemCount, [&] {
+        FlatHashMap<int, int> values;
+        for (int key : keys) values[key] = key;
+        return values.size();
+    });
+
+    set<int> stdSet(keys.begin(), keys.end());
+    harness.run("std::set<int> find", itemCount, [&] {
+        size_t found = 0;
+        for (int probe : probes) found += stdSet.count(probe);
+        return found;
+    });
+    BTreeSet<int> btree;
+    for (int key : keys) btree.insert(key);
+    harness.run("BTreeSet<int> find", itemCount, [&] {
+        size_t found = 0;
+        for (int probe : probes) found += btree.find(probe) != btree.end();
+        return found;
+    });
+    unordered_map<int, int> stdHash;
+    FlatHashMap<int, int> flatHash;
+    for (int key : keys) stdHash[key] = flatHash[key] = key;
+    harness.run("std::unordered_map<int, int> find", itemCount, [&] {
+        size_t found = 0;
+        for (int probe : probes) found += stdHash.find(probe) != stdHash.end();
+        return found;
+    });
+    harness.run("FlatHashMap<int, int> find", itemCount, [&] {
+        size_t found = 0;
+        for (int probe : probes) found += flatHash.find(probe) != flatHash.end();
+        return found;
+    });
+}
+
+static void queuesAndSorting(bench::Harness& harness) {
+    vector<int> values = randomInts(bigCount, 3);
+    harness.run("std::priority_queue<int> push + pop", itemCount, [&] {
+        priority_queue<int> heap;
+        for (size_t i = 0; i < itemCount; ++i) heap.push(values[i]);
+        int64_t sum = 0;
+        while (!heap.empty()) {
+            sum += heap.top();
+            heap.pop();
+        }
+        return sum;
+    });
+    harness.run("IndexedHeap<int> push + pop", itemCount, [&] {
+        IndexedHeap<int> heap;
+        for (size_t i = 0; i < itemCount; ++i) heap.push(values[i]);
+        int64_t sum = 0;
+        while (!heap.empty()) {
+            sum += heap.top();
+            heap.pop();
+        }
+        return sum;
+    });
+    auto copyValues = [&] { return values; };
+    harness.run("std::sort 1M ints", bigCount, copyValues, [](vector<int>& data) {
+        sort(data.begin(), data.end());
+        return data[data.size() / 2];
+    });
+    harness.run("radix::sort 1M ints", bigCount, copyValues, [](vector<int>& data) {
+        radix::sort(data.data(), data.data() + data.size());
+        return data[data.size() / 2];
+    });
+
+    ostringstream text;
+    for (int value : values) text << value << ' ';
+    string input = text.str();
+    harness.run("istream >> int", bigCount, [&] {
+        istringstream in(input);
+        int64_t sum = 0;
+        for (int value; in >> value;) sum += value;
+        return sum;
+    });
+    harness.run("IntReader read int", bigCount, [&] {
+        istringstream in(input);
+        IntReader reader(in);
+        int64_t sum = 0;
+        for (int value; reader.read(value);) sum += value;
+        return sum;
+    });
+}
+
+static void parallelAndSimd(bench::Harness& harness, TaskPool& pool) {
+    vector<int> values = randomInts(bigCount, 4);
+    harness.run("std::max_element 1M ints", bigCount, [&] { return *max_element(values.begin(), values.end()); });
+    harness.run("simd::maxElement 1M ints", bigCount, [&] { return simd::maxElement(values.data(), values.size()); });
+    harness.run("simd::sum 1M ints", bigCount, [&] { return simd::sum(values.data(), values.size()); });
+    harness.run("simd::summarize 1M ints", bigCount, [&] { return simd::summarize(values.data(), values.size()).sum; });
+    harness.run("parallel::reduce 1M ints", bigCount, [&] { return parallel::reduce(pool, values, int64_t(0)); });
+    harness.run("parallel::find 1M ints (absent)", bigCount, [&] { return parallel::find(pool, values, -1) - values.begin(); });
+    vector<int> prefix(values.size());
+    harness.run("parallel::inclusive_scan 1M ints", bigCount, [&] {
+        parallel::inclusive_scan(pool, values, prefix);
+        return prefix.back();
+    });
+    auto copyValues = [&] { return values; };
+    harness.run("parallel::sort 1M ints", bigCount, copyValues, [&](vector<int>& data) {
+        parallel::sort(pool, data);
+        return data[data.size() / 2];
+    });
+}
+
+// Lines like "2024-05-17T12:34:56,INFO,worker-17,request 4711 served in 23 ms,user=alice"
+static vector<string> logLines(size_t count) {
+    const char* levels[] = {"INFO", "WARN", "DEBUG", "ERROR"};
+    const char* users[] = {"alice", "bob", "carol", "dave", "eve"};
+    mt19937 random(5);
+    vector<string> lines(count);
+    for (string& line : lines) {
+        line = "2024-05-17T12:" + to_string(10 + random() % 50) + ":" + to_string(10 + random() % 50);
+        line += string(",") + levels[random() % 4] + ",worker-" + to_string(random() % 32);
+        line += ",request " + to_string(random() % 100000) + (random() % 8 == 0 ? " served in " : " queued for ");
+        line += to_string(random() % 500) + " ms,user=" + users[random() % 5];
+    }
+    return lines;
+}
+
+static void strings(bench::Harness& harness) {
+    vector<string> lines = logLines(itemCount / 4);
+    string text;
+    for (const string& line : lines) {
+        text += line;
+        text += '\n';
+    }
+
+    // Items are bytes of text for the finds, lines for reverse and split
+    harness.run("std::string::find ','", text.size(), [&] {
+        size_t hits = 0;
+        for (size_t at = text.find(','); at != string::npos; at = text.find(',', at + 1)) ++hits;
+        return hits;
+    });
+    harness.run("string_utils::find ','", text.size(), [&] {
+        size_t hits = 0;
+        string_view view(text);
+        for (size_t at = string_utils::find(view, ','); at != string::npos; at = string_utils::find(view, ',', at + 1)) ++hits;
+        return hits;
+    });
+    harness.run("std::string::find \"served in\"", text.size(), [&] {
+        size_t hits = 0;
+        for (size_t at = text.find("served in"); at != string::npos; at = text.find("served in", at + 1)) ++hits;
+        return hits;
+    });
+    harness.run("string_utils::find \"served in\"", text.size(), [&] {
+        size_t hits = 0;
+        string_view view(text), needle("served in");
+        for (size_t at = string_utils::find(view, needle); at != string::npos; at = string_utils::find(view, needle, at + 1)) ++hits;
+        return hits;
+    });
+    harness.run("string_utils::reverse", lines.size(), [&] {
+        for (string& line : lines) string_utils::reverse(line);
+        return lines[0][0];
+    });
+    harness.run("split: substr into vector<string>", lines.size(), [&] {
+        size_t fields = 0;
+        for (const string& line : lines) {
+            vector<string> parts;
+            size_t start = 0;
+            while (true) {
+                size_t at = line.find(',', start);
+                parts.push_back(line.substr(start, at == string::npos ? string::npos : at - start));
+                if (at == string::npos) break;
+                start = at + 1;
+            }
+            fields += parts.size();
+        }
+        return fields;
+    });
+    harness.run("split: string_utils into string_views", lines.size(), [&] {
+        size_t fields = 0;
+        vector<string_view> parts;
+        for (const string& line : lines) {
+            string_utils::split(line, ',', parts);
+            fields += parts.size();
+        }
+        return fields;
+    });
+
+    string greeting = "Good evening and welcome back", name = "Johnathan Livingston";
+    harness.run("concat: a + \", \" + b + \"!\"", itemCount, [&] {
+        size_t total = 0;
+        for (size_t i = 0; i < itemCount; ++i) total += (greeting + ", " + name + "!").size();
+        return total;
+    });
+    harness.run("concat: string_utils::concat", itemCount, [&] {
+        size_t total = 0;
+        for (size_t i = 0; i < itemCount; ++i) total += string_utils::concat(greeting, ", ", name, '!').size();
+        return total;
+    });
+    harness.run("concat: StringBuilder", itemCount, [&] {
+        size_t total = 0;
+        for (size_t i = 0; i < itemCount; ++i) {
+            string_utils::StringBuilder builder;
+            builder << greeting << ", " << name << '!';
+            total += builder.str().size();
+        }
+        return total;
+    });
+}
+
+static void matrices(bench::Harness& harness, TaskPool& pool) {
+    constexpr size_t n = 256;
+    mt19937 random(6);
+    uniform_real_distribution<float> value(-1.0f, 1.0f);
+    Matrix<float> a(n, n), b(n, n), c(n, n);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            a(i, j) = value(random);
+            b(i, j) = value(random);
+        }
+    }
+
+    // Items are multiply-adds for the products and elements for the transposes
+    harness.run("naive i-j-k multiply 256x256 floats", n * n * n, [&] {
+        const float *x = a.data(), *y = b.data();
+        float* out = c.data();
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                float sum = 0;
+                for (size_t k = 0; k < n; ++k) sum += x[i * n + k] * y[k * n + j];
+                out[i * n + j] = sum;
+            }
+        }
+        return c(0, 0);
+    });
+    harness.run("multiply 256x256 floats", n * n * n, [&] {
+        c = multiply(a, b);
+        return c(0, 0);
+    });
+    harness.run("multiply(pool) 256x256 floats", n * n * n, [&] {
+        c = multiply(pool, a, b);
+        return c(0, 0);
+    });
+    harness.run("two-loop transpose 256x256 floats", n * n, [&] {
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) c(j, i) = a(i, j);
+        }
+        return c(0, 0);
+    });
+    harness.run("transpose 256x256 floats", n * n, [&] {
+        c = transpose(a);
+        return c(0, 0);
+    });
+}
+
+struct Car {
+    string name = "Tesla Model S";
+    int seats = 5;
+};
+
+// One copy (increment) and its destruction (decrement) per item
+template <typename Pointer>
+static int copyAndDestroy(const Pointer& source) {
+    int seats = 0;
+    for (size_t i = 0; i < bigCount; ++i) {
+        Pointer copy(source);
+        seats += copy->seats;
+    }
+    return seats;
+}
+
+template <typename Weak>
+static int lockAndRelease(const Weak& weak) {
+    int seats = 0;
+    for (size_t i = 0; i < bigCount; ++i) seats += weak.lock()->seats;
+    return seats;
+}
+
+static void pointers(bench::Harness& harness) {
+    shared_ptr<Car> shared = make_shared<Car>();
+    IntrusivePtr<Car> intrusive = makeIntrusive<Car>();
+    IntrusivePtr<Car, LocalCount> local = makeIntrusive<Car, LocalCount>();
+    harness.run("shared_ptr copy + destroy", bigCount, [&] { return copyAndDestroy(shared); });
+    harness.run("IntrusivePtr copy + destroy", bigCount, [&] { return copyAndDestroy(intrusive); });
+    harness.run("IntrusivePtr<LocalCount> copy + destroy", bigCount, [&] { return copyAndDestroy(local); });
+
+    weak_ptr<Car> weak = shared;
+    IntrusiveWeakPtr<Car> intrusiveWeak = intrusive;
+    harness.run("weak_ptr lock", bigCount, [&] { return lockAndRelease(weak); });
+    harness.run("IntrusiveWeakPtr lock", bigCount, [&] { return lockAndRelease(intrusiveWeak); });
+}
+
+struct ObservedLibrary;
+
+struct ObservingMember {
+    weak_ptr<ObservedLibrary> library;
+    long long booksBorrowed = 0;
+
+    void borrowBook(); // Locks library first, like Member::borrowBook
+    void borrowBookFrom(const ObservedLibrary& lib);
+};
+
+struct ObservedLibrary {
+    int booksPerVisit = 1;
+    vector<shared_ptr<ObservingMember>> members;
+    SubscriberRegistry<ObservingMember> registry;
+};
+
+void ObservingMember::borrowBook() {
+    if (auto lib = library.lock()) borrowBookFrom(*lib);
+}
+
+void ObservingMember::borrowBookFrom(const ObservedLibrary& lib) {
+    booksBorrowed += lib.booksPerVisit;
+}
+
+static void observers(bench::Harness& harness, TaskPool& pool) {
+    auto library = make_shared<ObservedLibrary>();
+    for (size_t i = 0; i < itemCount; ++i) {
+        auto member = make_shared<ObservingMember>();
+        member->library = library;
+        library->members.push_back(member);
+        library->registry.subscribe(member);
+    }
+    ObservedLibrary& lib = *library;
+    harness.run("notify: weak_ptr lock per member", itemCount, [&] {
+        for (const auto& member : lib.members) member->borrowBook();
+    });
+    harness.run("notify: SubscriberRegistry", itemCount, [&] {
+        lib.registry.notify([&](ObservingMember& member) { member.borrowBookFrom(lib); });
+    });
+    harness.run("notify: SubscriberRegistry + pool", itemCount, [&] {
+        lib.registry.notify(pool, [&](ObservingMember& member) { member.borrowBookFrom(lib); });
+    });
+}
+
+// One call away from the loop, like a validation step the optimizer can't inline
+__attribute__((noinline)) static int validateThrowing(int value) { return checkValue(value); }
+
+__attribute__((noinline)) static Expected<int> validateExpected(int value) noexcept { return tryCheckValue(value); }
+
+static void errors(bench::Harness& harness) {
+    mt19937 random(7);
+    const int invalid[] = {-7, 0, 250};
+    vector<int> records(bigCount);
+    for (int& value : records) value = random() % 100 == 0 ? invalid[random() % 3] : 1 + static_cast<int>(random() % 100);
+
+    harness.run("checkValue throws, 1% invalid", bigCount, [&] {
+        int64_t sum = 0;
+        for (int value : records) {
+            try {
+                sum += validateThrowing(value);
+            } catch (const exception& e) {
+                sum -= e.what()[0] != '\0';
+            }
+        }
+        return sum;
+    });
+    harness.run("tryCheckValue Expected, 1% invalid", bigCount, [&] {
+        int64_t sum = 0;
+        for (int value : records) {
+            Expected<int> result = validateExpected(value);
+            if (result) {
+                sum += *result;
+            } else {
+                sum -= result.error().message[0] != '\0';
+            }
+        }
+        return sum;
+    });
+}
+
+static void complexArrays(bench::Harness& harness) {
+    mt19937 random(8);
+    uniform_real_distribution<double> value(-1.0, 1.0);
+    vector<Complex> a, b, c, d(itemCount);
+    ComplexArray sa, sb, sc;
+    for (size_t i = 0; i < itemCount; ++i) {
+        a.emplace_back(value(random), value(random));
+        b.emplace_back(value(random), value(random));
+        c.emplace_back(value(random), value(random));
+        sa.push_back(a.back());
+        sb.push_back(b.back());
+        sc.push_back(c.back());
+    }
+    ComplexArray sd(itemCount), temporary(itemCount);
+
+    harness.run("vector<Complex> d = a + b * c", itemCount, [&] {
+        for (size_t i = 0; i < itemCount; ++i) d[i] = a[i] + b[i] * c[i];
+        return d[itemCount / 2].getReal();
+    });
+    harness.run("ComplexArray t = b * c, d = a + t", itemCount, [&] {
+        temporary = sb * sc;
+        sd = sa + temporary;
+        return sd.realData()[itemCount / 2];
+    });
+    harness.run("ComplexArray d = a + b * c (fused)", itemCount, [&] {
+        sd = sa + sb * sc;
+        return sd.realData()[itemCount / 2];
+    });
+}
+
+static int callableScale = 3; // Set in main, so the optimizer can't fold it
+static int callableInputs[1024];
+
+static int scaleAdd(int a, int b) { return a * callableScale + b; }
+
+// noipa: no inlining, cloning or constant propagation into these from the call site
+__attribute__((noipa)) static int64_t callPointer(int (*func)(int, int)) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < bigCount; ++i) sum += func(callableInputs[i % 1024], static_cast<int>(i));
+    return sum;
+}
+
+__attribute__((noipa)) static int64_t callStdFunction(const function<int(int, int)>& func) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < bigCount; ++i) sum += func(callableInputs[i % 1024], static_cast<int>(i));
+    return sum;
+}
+
+__attribute__((noipa)) static int64_t callFunctionRef(FunctionRef<int(int, int)> func) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < bigCount; ++i) sum += func(callableInputs[i % 1024], static_cast<int>(i));
+    return sum;
+}
+
+__attribute__((noipa)) static int64_t callInplaceFunction(const InplaceFunction<int(int, int)>& func) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < bigCount; ++i) sum += func(callableInputs[i % 1024], static_cast<int>(i));
+    return sum;
+}
+
+__attribute__((noipa)) static int callOnceStdFunction(function<int(int, int)> func, int a) { return func(a, 1); }
+__attribute__((noipa)) static int callOnceInplaceFunction(InplaceFunction<int(int, int)> func, int a) { return func(a, 1); }
+
+static void callables(bench::Harness& harness) {
+    for (int i = 0; i < 1024; ++i) callableInputs[i] = i * 7 % 100;
+    int k = callableScale;
+    auto lambda = [k](int a, int b) { return a * k + b; };
+    function<int(int, int)> stdFunction = lambda;
+    InplaceFunction<int(int, int)> inplace = lambda;
+    harness.run("call through a function pointer", bigCount, [&] { return callPointer(scaleAdd); });
+    harness.run("call through std::function", bigCount, [&] { return callStdFunction(stdFunction); });
+    harness.run("call through FunctionRef", bigCount, [&] { return callFunctionRef(lambda); });
+    harness.run("call through InplaceFunction", bigCount, [&] { return callInplaceFunction(inplace); });
+
+    // Three captured pointers (24 bytes): too big for std::function's small buffer
+    int offset = 1, factor = k, bias = 0;
+    int *offsetPtr = &offset, *factorPtr = &factor, *biasPtr = &bias;
+    harness.run("std::function construct + call", itemCount, [&] {
+        int64_t sum = 0;
+        for (size_t i = 0; i < itemCount; ++i) {
+            sum += callOnceStdFunction([offsetPtr, factorPtr, biasPtr](int a, int b) { return a * *factorPtr + b * *offsetPtr + *biasPtr; },
+                                       static_cast<int>(i));
+        }
+        return sum;
+    });
+    harness.run("InplaceFunction construct + call", itemCount, [&] {
+        int64_t sum = 0;
+        for (size_t i = 0; i < itemCount; ++i) {
+            sum += callOnceInplaceFunction([offsetPtr, factorPtr, biasPtr](int a, int b) { return a * *factorPtr + b * *offsetPtr + *biasPtr; },
+                                           static_cast<int>(i));
+        }
+        return sum;
+    });
+}
+
+// Two kinds of message, in random order, handled three ways
+struct VirtualMessage {
+    uint32_t payload;
+    explicit VirtualMessage(uint32_t payload) : payload(payload) {}
+    virtual uint64_t handle() const = 0;
+    virtual ~VirtualMessage() {}
+};
+
+struct VirtualAddTen : VirtualMessage {
+    using VirtualMessage::VirtualMessage;
+    uint64_t handle() const override { return payload + 10; }
+};
+
+struct VirtualTriple : VirtualMessage {
+    using VirtualMessage::VirtualMessage;
+    uint64_t handle() const override { return uint64_t(payload) * 3 + 1; }
+};
+
+struct AddTenMessage {
+    uint32_t payload;
+    uint64_t handle() const { return payload + 10; }
+};
+
+struct TripleMessage {
+    uint32_t payload;
+    uint64_t handle() const { return uint64_t(payload) * 3 + 1; }
+};
+
+static void dispatch(bench::Harness& harness) {
+    mt19937 random(9);
+    vector<unique_ptr<VirtualMessage>> messages;
+    vector<variant<AddTenMessage, TripleMessage>> variants;
+    PolyCollection<AddTenMessage, TripleMessage> collection;
+    for (size_t i = 0; i < bigCount; ++i) {
+        uint32_t payload = static_cast<uint32_t>(random() % 100000);
+        if (random() % 2 == 0) {
+            messages.push_back(make_unique<VirtualAddTen>(payload));
+            variants.push_back(AddTenMessage{payload});
+            collection.add(AddTenMessage{payload});
+        } else {
+            messages.push_back(make_unique<VirtualTriple>(payload));
+            variants.push_back(TripleMessage{payload});
+            collection.add(TripleMessage{payload});
+        }
+    }
+
+    harness.run("virtual handle(), mixed kinds", bigCount, [&] {
+        uint64_t sum = 0;
+        for (const auto& message : messages) sum += message->handle();
+        return sum;
+    });
+    harness.run("std::visit handle(), mixed kinds", bigCount, [&] {
+        uint64_t sum = 0;
+        for (const auto& message : variants) sum += visit([](const auto& alternative) { return alternative.handle(); }, message);
+        return sum;
+    });
+    harness.run("PolyCollection::forEach handle()", bigCount, [&] {
+        uint64_t sum = 0;
+        collection.forEach([&](const auto& message) { sum += message.handle(); });
+        return sum;
+    });
+}
+
+static void columnar(bench::Harness& harness) {
+    mt19937 random(10);
+    vector<string> names(1000);
+    for (string& name : names) { // 20 to 30 characters: every Employee's name is on the heap
+        size_t length = 20 + random() % 11;
+        for (size_t i = 0; i < length; ++i) name += static_cast<char>('a' + random() % 26);
+    }
+    vector<Employee> source;
+    source.reserve(itemCount);
+    for (size_t i = 0; i < itemCount; ++i) {
+        source.emplace_back(names[random() % names.size()], 18 + static_cast<int>(random() % 50), 30000.0 + random() % 90000);
+    }
+
+    harness.run("vector<Employee> build", itemCount, [&] {
+        vector<Employee> objects;
+        objects.reserve(source.size());
+        for (const Employee& employee : source) objects.push_back(employee);
+        return objects.size();
+    });
+    harness.run("EmployeeTable::appendAll", itemCount, [&] {
+        EmployeeTable table;
+        table.appendAll(source);
+        return table.size();
+    });
+
+    EmployeeTable table;
+    table.appendAll(source);
+    harness.run("vector<Employee> salary, ages 30-39", itemCount, [&] {
+        double total = 0;
+        for (const Employee& employee : source) {
+            if (employee.getAge() >= 30 && employee.getAge() <= 39) total += employee.getSalary();
+        }
+        return total;
+    });
+    harness.run("EmployeeTable::salaryInAgeRange(30, 39)", itemCount, [&] { return table.salaryInAgeRange(30, 39).total; });
+    harness.run("vector<Employee> salary per 10-year band", itemCount, [&] {
+        vector<double> bands(7, 0.0);
+        for (const Employee& employee : source) bands[employee.getAge() / 10] += employee.getSalary();
+        return bands[3];
+    });
+    harness.run("EmployeeTable::salaryByAgeBand(10)", itemCount, [&] { return table.salaryByAgeBand(10)[3]; });
+}
+
+struct PlainAccount {
+    string owner;
+    double balance;
+};
+
+__attribute__((noinline)) static void deposit(PlainAccount& account, double amount) { account.balance += amount; }
+
+static void transactions(bench::Harness& harness) {
+    using Bank::Transactions::Deposit;
+    using Bank::Transactions::TransactionEngine;
+    constexpr size_t accountCount = itemCount;
+    constexpr size_t batchSize = 1024;
+    mt19937_64 random(11);
+    vector<Deposit> deposits(bigCount);
+    for (size_t i = 0; i < bigCount; ++i) {
+        deposits[i] = Deposit{i, random() % accountCount, static_cast<double>(random() % 10000) / 100};
+    }
+
+    vector<PlainAccount> plain(accountCount);
+    for (size_t i = 0; i < accountCount; ++i) plain[i] = PlainAccount{"Owner " + to_string(i), 1000.0};
+    harness.run("one call per deposit", bigCount, [&] {
+        for (const Deposit& d : deposits) deposit(plain[d.accountId], d.amount);
+        return plain[0].balance;
+    });
+    harness.run(
+        "TransactionEngine, 2 workers", bigCount,
+        [&] {
+            auto engine = make_unique<TransactionEngine>(2);
+            for (const PlainAccount& account : plain) engine->openAccount(account.owner, 1000.0);
+            return engine;
+        },
+        [&](unique_ptr<TransactionEngine>& engine) {
+            for (size_t i = 0; i < bigCount; i += batchSize) engine->submit(deposits.data() + i, min(batchSize, bigCount - i));
+            engine->drain();
+            return engine->balance(0);
+        });
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        bench::Harness harness("baseline", argc, argv);
+        sequences(harness);
+        wrappers(harness);
+        trees(harness);
+        associative(harness);
+        queuesAndSorting(harness);
+
+        callableScale = 2 + argc;
+        TaskPool pool;
+        parallelAndSimd(harness, pool);
+        strings(harness);
+        matrices(harness, pool);
+        pointers(harness);
+        observers(harness, pool);
+        errors(harness);
+        complexArrays(harness);
+        callables(harness);
+        dispatch(harness);
+        columnar(harness);
+        transactions(harness);
+        return harness.finish();
+    } catch (const exception& error) {
+        cerr << "baseline: " << error.what() << endl;
+        return 2;
+    }
+}
@@ -0,0 +1,314 @@
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <algorithm> // For std::max
+#include <atomic>
+#include <condition_variable>
+#include <cstddef> // For size_t
+#include <deque>
+#include <exception> // For std::exception_ptr
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <type_traits> // For std::invoke_result_t
+#include <utility> // For std::move
+#include <vector>
+#include "WorkStealingDeque.h"
+
+/*
+Notes about the work-stealing task pool:
+
+1. **Per-Worker Queues**:
+   - Every worker thread has its own Chase-Lev deque of tasks (WorkStealingDeque.h). A worker
+     pushes the tasks it spawns onto the bottom of its own deque and takes from the bottom
+     (newest first), without any lock, which keeps a fork-join computation depth-first and its
+     data warm in that core's cache.
+   - Threads outside the pool can't push onto a worker's deque (it has a single owner), so
+     their tasks go to a shared injection queue behind a mutex that every worker checks.
+
+2. **Stealing**:
+   - A worker with an empty deque looks at the injection queue, then picks a random other
+     worker and steals the *oldest* task from the top of its deque. Old tasks are usually the
+     biggest pieces of work, so one steal moves a lot of work and steals stay rare.
+
+3. **Sleeping**:
+   - Idle workers sleep on a condition variable. spawn() only takes the sleep lock to wake
+     one when some worker is actually asleep, so a busy pool spawns without locking at all.
+
+4. **Fork-Join with TaskGroup**:
+   - TaskGroup::run() spawns a task, TaskGroup::wait() waits for all tasks of the group.
+   - A waiting thread doesn't block: it keeps running (or stealing) tasks until its group is
+     done. So tasks may spawn and wait on subtasks without ever deadlocking the pool, and
+     the calling (non-worker) thread helps out too.
+   - The first exception thrown by a task of the group is rethrown from wait().
+
+5. **Executor Interface**:
+   - submit(f) queues f and returns a std::future for its result (or exception).
+   - parallel_for(first, last, body) runs body(i) for every i in [first, last), split in
+     chunks that idle workers steal, and returns when all are done.
+   - wait_all() helps until every task submitted to the pool has finished. Call it from
+     outside the pool: a task waiting for all tasks would wait for itself.
+   - An exception thrown by a task queued with plain spawn() (TaskGroup and submit catch
+     their own) is caught where the task ran, so a worker never dies of it and the task still
+     counts as finished. The first such exception is rethrown from the next wait_all().
+*/
+
+class TaskPool {
+private:
+    using Task = std::function<void()>;
+
+    std::vector<std::unique_ptr<WorkStealingDeque<Task*>>> deques; // One per worker
+    std::mutex injectionLock;
+    std::deque<Task*> injected; // Tasks spawned by threads outside the pool
+    std::vector<std::thread> threads;
+    std::atomic<bool> stopping;
+    std::atomic<size_t> queuedTasks; // Tasks sitting in any queue, so idle workers know when to wake up
+    std::atomic<size_t> unfinishedTasks; // Spawned and not finished yet, for wait_all()
+    std::atomic<size_t> sleepingWorkers;
+    std::mutex sleepLock;
+    std::condition_variable wakeUp;
+    std::mutex errorLock;
+    std::exception_ptr firstError; // First exception of a spawn()ed task, for wait_all()
+
+    // Which deque of which pool the current thread owns (none for outside threads)
+    static TaskPool*& currentPool() {
+        static thread_local TaskPool* pool = nullptr;
+        return pool;
+    }
+    static size_t& currentIndex() {
+        static thread_local size_t index = 0;
+        return index;
+    }
+
+    bool isWorker() const {
+        return currentPool() == this;
+    }
+
+    bool popInjected(Task*& task) {
+        std::lock_guard<std::mutex> guard(injectionLock);
+        if (injected.empty()) return false;
+        task = injected.front();
+        injected.pop_front();
+        return true;
+    }
+
+    bool findTask(Task*& task) {
+        bool worker = isWorker();
+        if (worker && deques[currentIndex()]->take(task)) {
+            return true;
+        }
+        if (popInjected(task)) {
+            return true;
+        }
+        static thread_local std::minstd_rand random(std::random_device{}());
+        size_t count = deques.size();
+        size_t start = random() % count;
+        for (size_t i = 0; i < count; ++i) {
+            size_t victim = (start + i) % count; // Random victim, then everyone else in turn
+            if (worker && victim == currentIndex()) continue;
+            if (deques[victim]->steal(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(size_t index) {
+        currentPool() = this;
+        currentIndex() = index;
+        while (true) {
+            if (runOne()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> guard(sleepLock);
+            sleepingWorkers++; // Before checking queuedTasks; spawn() checks in the opposite order
+            wakeUp.wait(guard, [this] { return stopping.load() || queuedTasks.load() > 0; });
+            sleepingWorkers--;
+            if (stopping.load() && queuedTasks.load() == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    // threadCount = 0 uses one worker per hardware thread
+    explicit TaskPool(size_t threadCount = 0) : stopping(false), queuedTasks(0), unfinishedTasks(0), sleepingWorkers(0) {
+        if (threadCount == 0) {
+            threadCount = std::thread::hardware_concurrency();
+            if (threadCount == 0) threadCount = 1;
+        }
+        for (size_t i = 0; i < threadCount; ++i) {
+            deques.push_back(std::make_unique<WorkStealingDeque<Task*>>());
+        }
+        for (size_t i = 0; i < threadCount; ++i) {
+            threads.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    // Runs every task still queued, then joins the workers
+    ~TaskPool() {
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    size_t threadCount() const {
+        return threads.size();
+    }
+
+    // Queue a task on the calling worker's own deque (the injection queue for outside threads)
+    void spawn(Task task) {
+        Task* queued = new Task(std::move(task));
+        unfinishedTasks++;
+        queuedTasks++; // Counted before it is visible, so the count never drops below zero
+        if (isWorker()) {
+            deques[currentIndex()]->push(queued);
+        } else {
+            std::lock_guard<std::mutex> guard(injectionLock);
+            injected.push_back(queued);
+        }
+        if (sleepingWorkers.load() > 0) {
+            std::lock_guard<std::mutex> guard(sleepLock); // A sleeper is either waiting or still checking queuedTasks
+            wakeUp.notify_one();
+        }
+    }
+
+    // Run one queued task (own deque first, then injected, then stolen); false if there was none
+    bool runOne() {
+        Task* task;
+        if (!findTask(task)) {
+            return false;
+        }
+        queuedTasks--;
+        std::unique_ptr<Task> owned(task);
+        try {
+            (*owned)();
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(errorLock);
+            if (!firstError) firstError = std::current_exception();
+        }
+        unfinishedTasks--;
+        return true;
+    }
+
+    // Queue func() and get its result (or its exception) through the future
+    template <typename Func>
+    auto submit(Func&& func) -> std::future<std::invoke_result_t<std::decay_t<Func>&>> {
+        using Result = std::invoke_result_t<std::decay_t<Func>&>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+        std::future<Result> result = packaged->get_future();
+        spawn([packaged] { (*packaged)(); });
+        return result;
+    }
+
+    // Help run tasks until every task spawned on the pool has finished (outside threads only),
+    // then rethrow the first exception a spawn()ed task threw
+    void wait_all() {
+        while (unfinishedTasks.load() > 0) {
+            if (!runOne()) {
+                std::this_thread::yield(); // The rest are running on workers
+            }
+        }
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> guard(errorLock);
+            std::swap(error, firstError);
+        }
+        if (error) std::rethrow_exception(error);
+    }
+
+    // body(i) for every i in [first, last), grainSize indices per task (0: about 8 chunks per worker)
+    template <typename Body>
+    void parallel_for(size_t first, size_t last, Body&& body, size_t grainSize = 0);
+};
+
+// A set of tasks that can be waited for together
+class TaskGroup {
+private:
+    TaskPool& pool;
+    std::atomic<size_t> pending;
+    std::mutex errorLock;
+    std::exception_ptr firstError;
+
+public:
+    explicit TaskGroup(TaskPool& pool) : pool(pool), pending(0) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() {
+        waitQuietly(); // Tasks refer to the group, so it can't go away before they finish
+    }
+
+    template <typename Func>
+    void run(Func&& func) {
+        pending++;
+        pool.spawn([this, func = std::forward<Func>(func)]() mutable {
+            try {
+                func();
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(errorLock);
+                if (!firstError) firstError = std::current_exception();
+            }
+            pending--;
+        });
+    }
+
+    // Help run tasks until every task of this group has finished
+    void waitQuietly() {
+        while (pending.load() > 0) {
+            if (!pool.runOne()) {
+                std::this_thread::yield(); // Our remaining tasks are running on other workers
+            }
+        }
+    }
+
+    // Like waitQuietly(), then rethrow the first exception a task threw
+    void wait() {
+        waitQuietly();
+        if (firstError) {
+            std::exception_ptr error = firstError;
+            firstError = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+namespace task_pool_detail {
+
+// Split [first, last) in halves until a piece is at most grainSize, running one half as a task
+template <typename Body>
+void splitRange(TaskGroup& group, size_t first, size_t last, size_t grainSize, Body& body) {
+    while (last - first > grainSize) {
+        size_t middle = first + (last - first) / 2;
+        group.run([&group, middle, last, grainSize, &body] { splitRange(group, middle, last, grainSize, body); });
+        last = middle;
+    }
+    for (size_t i = first; i < last; ++i) {
+        body(i);
+    }
+}
+
+} // namespace task_pool_detail
+
+template <typename Body>
+void TaskPool::parallel_for(size_t first, size_t last, Body&& body, size_t grainSize) {
+    if (first >= last) return;
+    if (grainSize == 0) grainSize = std::max<size_t>(1, (last - first) / (threadCount() * 8));
+    TaskGroup group(*this);
+    task_pool_detail::splitRange(group, first, last, grainSize, body);
+    group.wait();
+}
+
+#endif // TASK_POOL_H
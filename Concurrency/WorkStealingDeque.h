@@ -0,0 +1,127 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef> // For size_t
+#include <cstdint> // For int64_t
+#include <memory> // For std::unique_ptr
+#include <type_traits> // For std::is_trivially_copyable
+#include <utility> // For std::move
+#include <vector>
+
+/*
+Notes about the Chase-Lev work-stealing deque:
+
+1. **One Owner, Many Thieves**:
+   - The owning thread pushes and takes at the bottom (newest first), any other thread steals
+     at the top (oldest first). The owner's push and take are plain loads and stores plus one
+     fence; the only compare-and-swap is on `top`, and the owner needs it only when it takes
+     the very last element, where it may race with a thief.
+   - Compared to a std::deque behind a mutex, the owner never waits for a lock and thieves
+     never block the owner (or each other, beyond a failed compare-and-swap).
+
+2. **Growing**:
+   - The elements live in a circular array indexed by `top`/`bottom` modulo its size, a power
+     of two so the modulo is a mask (the initial capacity is rounded up). When the owner
+     finds it full, it copies the live range into an array twice the size and publishes that. A thief may still be reading the old array, so old arrays are only freed with the
+     deque (they add up to less than the current one).
+
+3. **Elements**:
+   - T must be trivially copyable (a thief reads it before it knows whether it won the race),
+     in practice a pointer or index. The memory orders follow "Correct and Efficient
+     Work-Stealing for Weak Memory Models" (Lê, Pop, Cohen, Zappa Nardelli, 2013).
+*/
+
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "elements are copied before a steal is confirmed");
+
+private:
+    struct Array {
+        const int64_t capacity;
+        const int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Array(int64_t capacity) : capacity(capacity), mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+        T get(int64_t index) const { return slots[index & mask].load(std::memory_order_relaxed); }
+        void put(int64_t index, T value) { slots[index & mask].store(value, std::memory_order_relaxed); }
+    };
+
+    alignas(64) std::atomic<int64_t> top; // Thieves' end
+    alignas(64) std::atomic<int64_t> bottom; // Owner's end
+    std::atomic<Array*> array;
+    std::vector<std::unique_ptr<Array>> arrays; // Current and retired arrays, touched by the owner only
+
+    Array* grow(Array* old, int64_t first, int64_t last) {
+        arrays.push_back(std::make_unique<Array>(old->capacity * 2));
+        Array* bigger = arrays.back().get();
+        for (int64_t i = first; i < last; ++i) {
+            bigger->put(i, old->get(i));
+        }
+        array.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+public:
+    // capacity is rounded up to a power of two (slots are found by masking); the deque grows past it as needed
+    explicit WorkStealingDeque(size_t capacity = 256) : top(0), bottom(0) {
+        int64_t rounded = 2;
+        while (static_cast<size_t>(rounded) < capacity) rounded *= 2;
+        arrays.push_back(std::make_unique<Array>(rounded));
+        array.store(arrays.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    bool empty() const {
+        return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+    }
+
+    // Owner only
+    void push(T value) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        Array* current = array.load(std::memory_order_relaxed);
+        if (b - t > current->capacity - 1) {
+            current = grow(current, t, b);
+        }
+        current->put(b, value);
+        std::atomic_thread_fence(std::memory_order_release); // The element before the new bottom
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only: the newest element, false if there is none
+    bool take(T& value) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Array* current = array.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed); // Reserve the bottom element...
+        std::atomic_thread_fence(std::memory_order_seq_cst); // ...before looking at what thieves did
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) { // Empty
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        value = current->get(b);
+        if (t == b) { // The last element: thieves may be after it too
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread: the oldest element, false if there is none or another thread got it first
+    bool steal(T& value) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) return false;
+        Array* current = array.load(std::memory_order_acquire);
+        value = current->get(t);
+        return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+};
+
+#endif // WORK_STEALING_DEQUE_H
@@ -0,0 +1,78 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "TaskPool.h"
+
+using namespace std;
+
+/*
+Benchmark: fork-join scaling of the TaskPool
+
+- fib: naive recursive Fibonacci(36) that spawns one of its two calls as a task down to
+  n = 18 (about 6K tasks), the classic stress test for spawn/take/steal.
+- parallel_for: 4M iterations of a few floating point operations each, split by the default
+  grain size.
+- Both run on 1, 2, 4, ... workers up to the hardware thread count (or the first argument),
+  and the speedup is against the plain sequential loop / recursion.
+
+Build: g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+*/
+
+static volatile double sink; // Keeps the optimizer from deleting the work
+
+template <typename Func>
+double milliseconds(Func&& func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+static long fibSequential(int n) {
+    return n < 2 ? n : fibSequential(n - 1) + fibSequential(n - 2);
+}
+
+static long fibParallel(TaskPool& pool, int n) {
+    if (n <= 18) return fibSequential(n);
+    long left = 0;
+    TaskGroup group(pool);
+    group.run([&] { left = fibParallel(pool, n - 1); });
+    long right = fibParallel(pool, n - 2);
+    group.wait();
+    return left + right;
+}
+
+static double work(size_t i) {
+    double x = static_cast<double>(i);
+    return sqrt(x) * sin(x) + cos(x * 0.5);
+}
+
+int main(int argc, char** argv) {
+    size_t maxWorkers = argc > 1 ? strtoul(argv[1], nullptr, 10) : thread::hardware_concurrency();
+    if (maxWorkers == 0) maxWorkers = 1;
+    const int fibN = 36;
+    const size_t iterations = 4000000;
+    vector<double> results(iterations);
+
+    double fibBase = milliseconds([&] { sink = fibSequential(fibN); });
+    double forBase = milliseconds([&] {
+        for (size_t i = 0; i < iterations; ++i) results[i] = work(i);
+    });
+    cout << "Sequential: fib " << fibBase << " ms, loop " << forBase << " ms" << endl;
+
+    for (size_t workers = 1;; workers *= 2) {
+        if (workers > maxWorkers) workers = maxWorkers;
+        TaskPool pool(workers);
+        double fibMs = milliseconds([&] { sink = fibParallel(pool, fibN); });
+        double forMs = milliseconds([&] { pool.parallel_for(0, iterations, [&](size_t i) { results[i] = work(i); }); });
+        cout << workers << " worker(s): fib " << fibMs << " ms (x" << fibBase / fibMs << "), parallel_for " << forMs
+             << " ms (x" << forBase / forMs << ")" << endl;
+        if (workers == maxWorkers) break;
+    }
+    sink = results[iterations / 2];
+    return 0;
+}
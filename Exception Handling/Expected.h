@@ -0,0 +1,108 @@
+#ifndef EXPECTED_H
+#define EXPECTED_H
+
+#include <cstdint> // For uint8_t
+#include <stdexcept> // For std::logic_error
+#include <type_traits>
+#include <utility> // For std::move, std::forward
+#include <variant>
+
+/*
+Notes about Expected:
+
+1. **What It Is For**:
+   - A function returns Expected<T, Error>: either the T it computed or the Error that stopped
+     it. The caller tests it like a pointer (`if (result)`) and reads `*result` or
+     `result.error()`. Nothing is thrown, so a failure costs a branch and a small return
+     value, not a stack unwind (which takes microseconds and gets worse the deeper the stack).
+   - Use it where failures are routine (rejected records, malformed input); keep exceptions
+     for the truly exceptional ones, where the unwind cost never shows.
+
+2. **Error Without Allocating**:
+   - Error is an ErrorCode plus a `const char*` message that must point to a string with
+     static storage (a literal). Making, copying and returning one allocates nothing, unlike
+     an exception carrying a std::string.
+   - Any other error type works too: Expected<T, MyError>.
+
+3. **The Interface**:
+   - The names follow C++23's std::expected (has_value, value, error, value_or), so code can
+     switch to it later by changing the type. A failure is returned as
+     `return makeUnexpected(Error{...});`.
+   - value() on an Expected holding an error throws std::logic_error: it is a bug in the
+     caller, who should have checked first. operator* does not check.
+   - The storage is a std::variant, so Expected<int, Error> is trivially copyable.
+*/
+
+enum class ErrorCode : uint8_t {
+    InvalidArgument,
+    OutOfRange,
+    Overflow,
+    OutOfMemory,
+    Custom,
+};
+
+struct Error {
+    ErrorCode code;
+    const char* message; // A string literal: never copied, never freed
+};
+
+// Wraps an error so Expected can tell it from a value (even when T and E are the same type)
+template <typename E>
+struct Unexpected {
+    E error;
+};
+
+template <typename E>
+Unexpected<std::decay_t<E>> makeUnexpected(E&& error) {
+    return Unexpected<std::decay_t<E>>{std::forward<E>(error)};
+}
+
+template <typename T, typename E = Error>
+class Expected {
+private:
+    std::variant<T, Unexpected<E>> storage;
+
+    void check() const {
+        if (!has_value()) throw std::logic_error("Expected::value: holds an error");
+    }
+
+public:
+    using value_type = T;
+    using error_type = E;
+
+    Expected(const T& value) : storage(std::in_place_index<0>, value) {}
+    Expected(T&& value) : storage(std::in_place_index<0>, std::move(value)) {}
+    Expected(Unexpected<E> error) : storage(std::in_place_index<1>, std::move(error)) {}
+
+    bool has_value() const noexcept { return storage.index() == 0; }
+    explicit operator bool() const noexcept { return has_value(); }
+
+    T& value() & {
+        check();
+        return *std::get_if<0>(&storage);
+    }
+    const T& value() const& {
+        check();
+        return *std::get_if<0>(&storage);
+    }
+    T&& value() && {
+        check();
+        return std::move(*std::get_if<0>(&storage));
+    }
+
+    // Unchecked: only after has_value()
+    T& operator*() & noexcept { return *std::get_if<0>(&storage); }
+    const T& operator*() const& noexcept { return *std::get_if<0>(&storage); }
+    T* operator->() noexcept { return std::get_if<0>(&storage); }
+    const T* operator->() const noexcept { return std::get_if<0>(&storage); }
+
+    // Unchecked: only when !has_value()
+    const E& error() const noexcept { return std::get_if<1>(&storage)->error; }
+
+    template <typename U>
+    T value_or(U&& fallback) const& {
+        return has_value() ? **this : static_cast<T>(std::forward<U>(fallback));
+    }
+};
+
+#endif // EXPECTED_H
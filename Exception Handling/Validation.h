@@ -0,0 +1,58 @@
+#ifndef VALIDATION_H
+#define VALIDATION_H
+
+#include <stdexcept> // For std::invalid_argument, std::overflow_error
+#include <string>
+#include "Expected.h"
+
+/*
+Notes about Validation:
+
+1. **Two Ways to Reject a Value**:
+   - checkValue throws: std::invalid_argument for negative values, MyCustomException for zero,
+     std::overflow_error above 100. That is what processData did inline.
+   - tryCheckValue makes the same decisions and returns them as an Expected<int>, with the
+     matching ErrorCode and a literal message. Nothing is thrown or allocated.
+   - Both are here so processData, tryProcessData and the benchmark all validate the same
+     way.
+*/
+
+// Custom exception class inheriting from std::exception
+class MyCustomException : public std::exception {
+public:
+    MyCustomException(const std::string& message) : msg_(message) {}
+
+    // Override the what() function to provide an error message
+    const char* what() const noexcept override {
+        return msg_.c_str();
+    }
+
+private:
+    std::string msg_;
+};
+
+// Returns value if it is valid, throws otherwise
+inline int checkValue(int value) {
+    if (value < 0) {
+        throw std::invalid_argument("Negative value is not allowed."); // Standard exception
+    } else if (value == 0) {
+        throw MyCustomException("Zero is not permitted."); // Custom exception
+    } else if (value > 100) {
+        throw std::overflow_error("Value exceeds the allowable range."); // Runtime error
+    }
+    return value;
+}
+
+// The same checks, reported through the return value
+inline Expected<int> tryCheckValue(int value) noexcept {
+    if (value < 0) {
+        return makeUnexpected(Error{ErrorCode::InvalidArgument, "Negative value is not allowed."});
+    } else if (value == 0) {
+        return makeUnexpected(Error{ErrorCode::Custom, "Zero is not permitted."});
+    } else if (value > 100) {
+        return makeUnexpected(Error{ErrorCode::Overflow, "Value exceeds the allowable range."});
+    }
+    return value;
+}
+
+#endif // VALIDATION_H
@@ -0,0 +1,99 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "Expected.h"
+#include "Validation.h"
+
+using namespace std;
+
+/*
+Benchmark: rejecting records with exceptions vs with Expected
+
+- 4M records, of which 0%, 1% or 10% are invalid (negative, zero or above 100, in equal
+  parts); the valid ones are summed, the rejected ones counted.
+- Exceptions: checkValue throws and the loop catches std::exception. Expected:
+  tryCheckValue returns Expected<int> and the loop checks it.
+- Both checks sit behind a function the optimizer may not inline, like a validation step
+  one call away from the loop that drives it. Results are million records per second, best
+  of 5 runs.
+- With no failures at all the exception path can come out slightly ahead: a try block costs
+  nothing until something is thrown, and it returns a plain int in a register, while an
+  Expected<int> (24 bytes) is returned through memory. From 1% on the unwinding dominates.
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static volatile int64_t sink; // Keeps the optimizer from deleting the loops
+
+constexpr size_t recordCount = 1 << 22;
+
+__attribute__((noinline)) static int validateThrowing(int value) { return checkValue(value); }
+
+__attribute__((noinline)) static Expected<int> validateExpected(int value) noexcept { return tryCheckValue(value); }
+
+static vector<int> makeRecords(double failureRate) {
+    mt19937 random(2024);
+    uniform_real_distribution<double> chance(0.0, 1.0);
+    const int invalid[] = {-7, 0, 250};
+    vector<int> records(recordCount);
+    for (int& value : records) {
+        value = chance(random) < failureRate ? invalid[random() % 3] : 1 + static_cast<int>(random() % 100);
+    }
+    return records;
+}
+
+template <typename Body>
+double millionPerSecond(Body body) {
+    double best = 1e300;
+    for (int run = 0; run < 5; ++run) {
+        auto start = chrono::steady_clock::now();
+        body();
+        best = min(best, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+    }
+    return recordCount / best / 1e6;
+}
+
+int main() {
+    for (double failureRate : {0.0, 0.01, 0.10}) {
+        vector<int> records = makeRecords(failureRate);
+        int64_t sumThrowing = 0, sumExpected = 0;
+        size_t rejectedThrowing = 0, rejectedExpected = 0;
+
+        double throwing = millionPerSecond([&] {
+            int64_t sum = 0;
+            size_t rejected = 0;
+            for (int value : records) {
+                try {
+                    sum += validateThrowing(value);
+                } catch (const exception& e) {
+                    rejected += e.what()[0] != '\0';
+                }
+            }
+            sumThrowing = sum;
+            rejectedThrowing = rejected;
+        });
+        double expected = millionPerSecond([&] {
+            int64_t sum = 0;
+            size_t rejected = 0;
+            for (int value : records) {
+                Expected<int> result = validateExpected(value);
+                if (result) {
+                    sum += *result;
+                } else {
+                    rejected += result.error().message[0] != '\0';
+                }
+            }
+            sumExpected = sum;
+            rejectedExpected = rejected;
+        });
+        sink = sumThrowing + sumExpected;
+
+        cout << failureRate * 100 << "% invalid (" << rejectedExpected << " rejected), million records/s: exceptions "
+             << throwing << ", Expected " << expected << " (" << expected / throwing << "x)" << endl;
+        if (sumThrowing != sumExpected || rejectedThrowing != rejectedExpected) cout << "  MISMATCH" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,368 @@
+#ifndef TRANSACTION_ENGINE_H
+#define TRANSACTION_ENGINE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef> // For size_t
+#include <cstdint> // For uint64_t
+#include <iterator> // For std::size
+#include <memory> // For std::unique_ptr
+#include <ostream>
+#include <stdexcept> // For std::invalid_argument, std::out_of_range, std::logic_error
+#include <string>
+#include <thread>
+#include <vector>
+#include "../STL/Allocators/CacheLineAllocator.h"
+#include "../STL/Stack&Queue/RingBuffer.h"
+
+/*
+Notes about the transaction engine:
+
+1. **Shards Instead of Locks**:
+   - Every account belongs to exactly one worker thread (its shard): account id % workers.
+     Only that worker ever writes its balance, so applying a deposit is a plain `+=` with no
+     mutex and no atomic, and the balances of one worker never share a cache line with
+     another worker's (no false sharing).
+   - A shard keeps its balances in one contiguous, cache-line aligned array, indexed by
+     id / workers; the owners' names are in a separate array the hot path never touches.
+
+2. **Batches**:
+   - submit(deposits, count) splits a batch by shard and hands each part to its worker through
+     a single-producer single-consumer ring buffer (RingBuffer.h), one index update per part.
+     Workers pop up to 256 deposits at a time. When a ring is full, submit() waits for the
+     worker (back-pressure) instead of growing a queue.
+   - submit() and everything else except the workers is for one thread (the one that owns the
+     engine). drain() waits until every submitted deposit is applied (and logged); only then are
+     balance(), openAccount() and the latency numbers safe to use, and they throw
+     std::logic_error otherwise.
+
+3. **Logging Off the Hot Path**:
+   - With a log stream, each worker puts a small fixed-size record per deposit into its own
+     ring buffer and one logger thread formats and writes them. A worker never waits for the
+     logger: when its log ring is full the record is dropped and counted (droppedLogRecords()).
+   - Without a log stream (the default) there are no log rings and no logger thread at all.
+   - Compare Transaction::processTransaction in main.cpp, which prints two lines with std::endl
+     (a flush each) for every deposit, inside the deposit itself.
+
+4. **Latency**:
+   - Every deposit carries the time its batch was submitted; a worker reads the clock once per
+     popped chunk and adds submit-to-applied times to its own histogram (power-of-two ranges,
+     8 steps each, so within 12.5%). latencyPercentile(0.99) merges them.
+*/
+
+namespace Bank {
+    namespace Transactions {
+        struct Deposit {
+            uint64_t transactionId;
+            uint64_t accountId;
+            double amount;
+        };
+
+        namespace engine_detail {
+            inline uint64_t nowNs() {
+                return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+
+            // Counts of values in ranges [2^k, 2^(k+1)), each split in 8 equal steps
+            class LatencyHistogram {
+            private:
+                static constexpr int steps = 8;
+                uint64_t counts[64 * steps] = {};
+
+                static size_t bucketOf(uint64_t ns) {
+                    if (ns < steps) return static_cast<size_t>(ns);
+                    int top = 63 - __builtin_clzll(ns);
+                    return static_cast<size_t>((top - 2) * steps + ((ns >> (top - 3)) & (steps - 1)));
+                }
+
+                // The largest value that lands in bucket
+                static uint64_t upperBound(size_t bucket) {
+                    if (bucket < steps) return bucket;
+                    int top = static_cast<int>(bucket / steps) + 2;
+                    uint64_t step = uint64_t(1) << (top - 3);
+                    return (uint64_t(1) << top) + (bucket % steps + 1) * step - 1;
+                }
+
+            public:
+                void record(uint64_t ns) { ++counts[bucketOf(ns)]; }
+
+                void add(const LatencyHistogram& other) {
+                    for (size_t i = 0; i < std::size(counts); ++i) counts[i] += other.counts[i];
+                }
+
+                uint64_t total() const {
+                    uint64_t sum = 0;
+                    for (uint64_t count : counts) sum += count;
+                    return sum;
+                }
+
+                // Smallest bucket bound that at least fraction of the values are at or below
+                uint64_t percentile(double fraction) const {
+                    uint64_t all = total();
+                    if (all == 0) return 0;
+                    uint64_t wanted = static_cast<uint64_t>(fraction * static_cast<double>(all - 1)) + 1, seen = 0;
+                    for (size_t i = 0; i < std::size(counts); ++i) {
+                        seen += counts[i];
+                        if (seen >= wanted) return upperBound(i);
+                    }
+                    return upperBound(std::size(counts) - 1);
+                }
+
+                void clear() {
+                    for (uint64_t& count : counts) count = 0;
+                }
+            };
+
+            struct Queued {
+                uint64_t transactionId;
+                size_t slot; // Index in the shard's balances
+                double amount;
+                uint64_t submittedNs;
+            };
+
+            struct LogRecord {
+                uint64_t transactionId;
+                uint64_t accountId;
+                double amount;
+                double balance;
+            };
+        } // namespace engine_detail
+
+        class TransactionEngine {
+        private:
+            static constexpr size_t queueCapacity = 1 << 14;
+            static constexpr size_t logCapacity = 1 << 14;
+            static constexpr size_t chunkSize = 256; // Deposits a worker pops at once
+
+            using Queued = engine_detail::Queued;
+            using LogRecord = engine_detail::LogRecord;
+
+            // Written by the owning thread only (staging, pushed); on lines of its own
+            struct alignas(64) ProducerSide {
+                std::vector<Queued> staging; // This batch's deposits for the shard
+                size_t next = 0; // First one of staging not in the ring yet
+                size_t pushed = 0; // All deposits ever put in the ring
+            };
+
+            struct alignas(64) Shard {
+                ProducerSide producer;
+                SpscRingBuffer<Queued> queue{queueCapacity};
+                std::unique_ptr<SpscRingBuffer<LogRecord>> log; // Only with a log stream
+                // Only the worker writes these (until drain() hands them back to the owner)
+                alignas(64) std::vector<double, CacheLineAllocator<double>> balances;
+                std::vector<std::string> owners; // Not used on the hot path
+                engine_detail::LatencyHistogram latency;
+                std::atomic<size_t> applied{0};
+                std::atomic<size_t> logged{0}; // Records put in the log ring
+                std::atomic<size_t> dropped{0}; // Records that didn't fit
+            };
+
+            std::vector<std::unique_ptr<Shard>> shards;
+            std::vector<std::thread> workers;
+            std::thread logger;
+            std::ostream* logStream;
+            std::atomic<bool> stopping{false};
+            alignas(64) std::atomic<size_t> written{0}; // Log records the logger has written
+            size_t accounts = 0;
+
+            static void backOff(unsigned& idlePolls) {
+                if (++idlePolls < 64) {
+                    std::this_thread::yield();
+                } else {
+                    std::this_thread::sleep_for(std::chrono::microseconds(20)); // Idle: stop burning the core
+                }
+            }
+
+            void work(size_t shardIndex) {
+                Shard& shard = *shards[shardIndex];
+                const size_t workerCount = shards.size();
+                Queued chunk[chunkSize];
+                unsigned idlePolls = 0;
+                while (true) {
+                    size_t count = shard.queue.try_pop_batch(chunk, chunkSize);
+                    if (count == 0) {
+                        if (stopping.load(std::memory_order_acquire)) return; // drain() ran before stopping
+                        backOff(idlePolls);
+                        continue;
+                    }
+                    idlePolls = 0;
+                    double* balances = shard.balances.data();
+                    if (!shard.log) {
+                        for (size_t i = 0; i < count; ++i) balances[chunk[i].slot] += chunk[i].amount;
+                    } else {
+                        size_t logged = 0;
+                        for (size_t i = 0; i < count; ++i) {
+                            const Queued& item = chunk[i];
+                            balances[item.slot] += item.amount;
+                            uint64_t accountId = item.slot * workerCount + shardIndex;
+                            logged += shard.log->try_push(LogRecord{item.transactionId, accountId, item.amount, balances[item.slot]});
+                        }
+                        shard.logged.fetch_add(logged, std::memory_order_release);
+                        shard.dropped.fetch_add(count - logged, std::memory_order_relaxed);
+                    }
+                    uint64_t now = engine_detail::nowNs();
+                    for (size_t i = 0; i < count; ++i) {
+                        shard.latency.record(now > chunk[i].submittedNs ? now - chunk[i].submittedNs : 0);
+                    }
+                    shard.applied.fetch_add(count, std::memory_order_release); // Publishes the balances to drain()
+                }
+            }
+
+            void writeLog() {
+                LogRecord records[chunkSize];
+                unsigned idlePolls = 0;
+                while (true) {
+                    size_t count = 0;
+                    for (auto& shard : shards) {
+                        size_t popped = shard->log->try_pop_batch(records, chunkSize);
+                        for (size_t i = 0; i < popped; ++i) {
+                            *logStream << "Processed Transaction ID: T" << records[i].transactionId << " for account "
+                                       << records[i].accountId << ", amount: " << records[i].amount
+                                       << ". New Balance: " << records[i].balance << '\n';
+                        }
+                        written.fetch_add(popped, std::memory_order_release);
+                        count += popped;
+                    }
+                    if (count == 0) {
+                        if (stopping.load(std::memory_order_acquire)) break;
+                        backOff(idlePolls);
+                    } else {
+                        idlePolls = 0;
+                    }
+                }
+                logStream->flush();
+            }
+
+            bool idle() const {
+                size_t logged = 0;
+                for (const auto& shard : shards) {
+                    if (shard->applied.load(std::memory_order_acquire) != shard->producer.pushed) return false;
+                    logged += shard->logged.load(std::memory_order_acquire);
+                }
+                return !logStream || written.load(std::memory_order_acquire) == logged;
+            }
+
+            void requireIdle(const char* what) const {
+                if (!idle()) throw std::logic_error(std::string("TransactionEngine::") + what + ": call drain() first");
+            }
+
+        public:
+            // workerCount threads, one shard each; with a log stream, one more thread writes the log
+            explicit TransactionEngine(size_t workerCount, std::ostream* log = nullptr) : logStream(log) {
+                if (workerCount == 0) throw std::invalid_argument("TransactionEngine: needs at least one worker");
+                for (size_t i = 0; i < workerCount; ++i) {
+                    shards.push_back(std::make_unique<Shard>());
+                    if (logStream) shards.back()->log = std::make_unique<SpscRingBuffer<LogRecord>>(logCapacity);
+                }
+                for (size_t i = 0; i < workerCount; ++i) workers.emplace_back([this, i] { work(i); });
+                if (logStream) logger = std::thread([this] { writeLog(); });
+            }
+
+            TransactionEngine(const TransactionEngine&) = delete;
+            TransactionEngine& operator=(const TransactionEngine&) = delete;
+
+            ~TransactionEngine() {
+                drain();
+                stopping.store(true, std::memory_order_release);
+                for (std::thread& worker : workers) worker.join();
+                if (logger.joinable()) logger.join();
+            }
+
+            size_t workerCount() const { return shards.size(); }
+            size_t accountCount() const { return accounts; }
+
+            // Returns the new account's id (0, 1, 2, ...); only while idle
+            uint64_t openAccount(const std::string& owner, double initialDeposit) {
+                requireIdle("openAccount");
+                Shard& shard = *shards[accounts % shards.size()];
+                shard.balances.push_back(initialDeposit);
+                shard.owners.push_back(owner);
+                return accounts++;
+            }
+
+            // Queues every deposit of the batch; waits only if a worker's ring is full.
+            // Throws std::out_of_range (queuing nothing) if an account id doesn't exist.
+            void submit(const Deposit* deposits, size_t count) {
+                for (size_t i = 0; i < count; ++i) {
+                    if (deposits[i].accountId >= accounts) throw std::out_of_range("TransactionEngine::submit: no such account");
+                }
+                const size_t workerCount = shards.size();
+                uint64_t now = engine_detail::nowNs();
+                for (size_t i = 0; i < count; ++i) {
+                    const Deposit& deposit = deposits[i];
+                    shards[deposit.accountId % workerCount]->producer.staging.push_back(
+                        Queued{deposit.transactionId, static_cast<size_t>(deposit.accountId / workerCount), deposit.amount, now});
+                }
+                // Round-robin over the shards so one full ring doesn't hold up the others
+                size_t remaining = count;
+                unsigned idlePolls = 0;
+                while (remaining > 0) {
+                    size_t progress = 0;
+                    for (auto& shard : shards) {
+                        ProducerSide& producer = shard->producer;
+                        size_t left = producer.staging.size() - producer.next;
+                        if (left == 0) continue;
+                        size_t pushed = shard->queue.try_push_batch(producer.staging.data() + producer.next, left);
+                        producer.next += pushed;
+                        producer.pushed += pushed;
+                        progress += pushed;
+                    }
+                    remaining -= progress;
+                    if (progress == 0) backOff(idlePolls);
+                    else idlePolls = 0;
+                }
+                for (auto& shard : shards) {
+                    shard->producer.staging.clear();
+                    shard->producer.next = 0;
+                }
+            }
+
+            void submit(const std::vector<Deposit>& deposits) { submit(deposits.data(), deposits.size()); }
+
+            // Waits until every submitted deposit is applied (and logged, with a log stream)
+            void drain() const {
+                unsigned idlePolls = 0;
+                while (!idle()) backOff(idlePolls);
+            }
+
+            double balance(uint64_t accountId) const {
+                requireIdle("balance");
+                if (accountId >= accounts) throw std::out_of_range("TransactionEngine::balance: no such account");
+                return shards[accountId % shards.size()]->balances[accountId / shards.size()];
+            }
+
+            const std::string& owner(uint64_t accountId) const {
+                if (accountId >= accounts) throw std::out_of_range("TransactionEngine::owner: no such account");
+                return shards[accountId % shards.size()]->owners[accountId / shards.size()];
+            }
+
+            size_t applied() const {
+                size_t total = 0;
+                for (const auto& shard : shards) total += shard->applied.load(std::memory_order_acquire);
+                return total;
+            }
+
+            size_t droppedLogRecords() const {
+                size_t total = 0;
+                for (const auto& shard : shards) total += shard->dropped.load(std::memory_order_relaxed);
+                return total;
+            }
+
+            // Submit-to-applied time in ns that the given fraction of deposits (0.99: p99) stayed within
+            uint64_t latencyPercentile(double fraction) const {
+                requireIdle("latencyPercentile");
+                engine_detail::LatencyHistogram all;
+                for (const auto& shard : shards) all.add(shard->latency);
+                return all.percentile(fraction);
+            }
+
+            void resetLatency() {
+                requireIdle("resetLatency");
+                for (auto& shard : shards) shard->latency.clear();
+            }
+        };
+    } // namespace Transactions
+} // namespace Bank
+
+#endif // TRANSACTION_ENGINE_H
@@ -0,0 +1,102 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "TransactionEngine.h"
+
+using namespace std;
+
+/*
+Benchmark: applying deposits with the TransactionEngine
+
+- 1M accounts, 8M deposits to random accounts, submitted in batches of 1024 by one thread.
+- Baseline: one thread calling a deposit function per transaction on a vector of
+  {owner, balance} objects, like Transaction::processTransaction without the printing.
+- Engine: 1, 8 and 32 worker threads (or the thread counts given as arguments). Throughput is
+  deposits per second from the first submit() to the end of drain(); latency is
+  submit-to-applied time per deposit (p50 / p99, from the engine's histograms).
+- Run with "log" (before the thread counts) to log every deposit through the async logger
+  into a stream that discards its output, which measures formatting, not the disk.
+- The batches are submitted as fast as possible, so latency is mostly time spent queued
+  behind earlier deposits (up to a full ring per worker). With more threads than cores the
+  numbers mostly measure the scheduler, and the single submitting thread sets the limit.
+
+Build: g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+*/
+
+using namespace Bank::Transactions;
+
+static volatile double sink; // Keeps the optimizer from deleting the loops
+
+constexpr size_t accountCount = 1 << 20;
+constexpr size_t depositCount = 8 << 20;
+constexpr size_t batchSize = 1024;
+
+// A stream buffer that accepts and forgets everything
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    streamsize xsputn(const char*, streamsize count) override { return count; }
+};
+
+struct PlainAccount {
+    string owner;
+    double balance;
+};
+
+__attribute__((noinline)) static void deposit(PlainAccount& account, double amount) { account.balance += amount; }
+
+int main(int argc, char* argv[]) {
+    int first = 1;
+    bool logging = argc > 1 && strcmp(argv[1], "log") == 0;
+    if (logging) ++first;
+    vector<size_t> threadCounts;
+    for (int i = first; i < argc; ++i) threadCounts.push_back(strtoul(argv[i], nullptr, 10));
+    if (threadCounts.empty()) threadCounts = {1, 8, 32};
+
+    mt19937_64 random(2024);
+    vector<Deposit> deposits(depositCount);
+    for (size_t i = 0; i < depositCount; ++i) {
+        deposits[i] = Deposit{i, random() % accountCount, static_cast<double>(random() % 10000) / 100};
+    }
+
+    vector<PlainAccount> plain(accountCount);
+    for (size_t i = 0; i < accountCount; ++i) plain[i] = PlainAccount{"Owner " + to_string(i), 1000.0};
+    auto start = chrono::steady_clock::now();
+    for (const Deposit& d : deposits) deposit(plain[d.accountId], d.amount);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "one call per deposit, 1 thread: " << depositCount / seconds / 1e6 << " M deposits/s" << endl;
+
+    NullBuffer nullBuffer;
+    ostream nullStream(&nullBuffer);
+    for (size_t threads : threadCounts) {
+        if (threads == 0) continue;
+        TransactionEngine engine(threads, logging ? &nullStream : nullptr);
+        for (size_t i = 0; i < accountCount; ++i) engine.openAccount(plain[i].owner, 1000.0);
+
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < depositCount; i += batchSize) engine.submit(deposits.data() + i, min(batchSize, depositCount - i));
+        engine.drain();
+        seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        // Same deposits in the same order per account, so the same sums as the baseline's
+        for (size_t i = 0; i < accountCount; i += 4099) {
+            if (engine.balance(i) != plain[i].balance) {
+                cout << "MISMATCH at account " << i << endl;
+                break;
+            }
+        }
+        sink = engine.balance(0);
+        cout << "engine, " << threads << " worker(s)" << (logging ? " + logger" : "") << ": " << depositCount / seconds / 1e6
+             << " M deposits/s, latency p50 " << engine.latencyPercentile(0.5) / 1000.0 << " us, p99 "
+             << engine.latencyPercentile(0.99) / 1000.0 << " us";
+        if (logging) cout << ", " << engine.droppedLogRecords() << " log records dropped";
+        cout << endl;
+    }
+    return 0;
+}
@@ -40,6 +40,11 @@
  *      different modules or components (e.g., Banking, E-commerce, 
  *      etc.), which helps facilitate code maintenance and collaboration.
  * 
+ *    - TransactionEngine.h adds to the same `Bank::Transactions` namespace
+ *      from another file: a namespace can be reopened anywhere. The engine
+ *      applies batches of deposits on worker threads, each owning a shard
+ *      of the accounts, and logs on a thread of its own (benchmark.cpp).
+ * 
  * 7. **Accessing Namespaces:**
  *    - You can access a member of a namespace using the scope resolution 
  *      operator `::`. For example: `Bank::Accounts::openAccount()`.
@@ -56,6 +61,8 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
+#include "TransactionEngine.h"
 
 namespace Bank {
     // Nested namespace for account-related functionality
@@ -116,5 +123,17 @@ int main() {
     // Processing a transaction
     Transactions::Transaction::processTransaction("T001", 500.0, account1); // Deposit
 
+    // Processing a batch of deposits with the engine: 2 worker threads, log written to std::cout
+    {
+        Transactions::TransactionEngine engine(2, &std::cout);
+        uint64_t alice = engine.openAccount("Alice", 1000.0);
+        uint64_t bob = engine.openAccount("Bob", 250.0);
+        std::vector<Transactions::Deposit> batch = {{2, alice, 500.0}, {3, bob, 75.0}, {4, alice, 20.0}};
+        engine.submit(batch);
+        engine.drain(); // Every deposit applied and logged
+        std::cout << engine.owner(alice) << ": " << engine.balance(alice) << ", "
+                  << engine.owner(bob) << ": " << engine.balance(bob) << std::endl;
+    }
+
     return 0;
 }
@@ -0,0 +1,76 @@
+#ifndef EMPLOYEE_H
+#define EMPLOYEE_H
+
+#include <iostream>
+#include <string>
+
+class Employee {
+private:
+    std::string name;
+    int age;
+    double salary;
+
+    // Static member variable to keep track of the number of employees
+    static int employeeCount;
+
+public:
+    // Default constructor
+    Employee() {
+        name = "Unknown";
+        age = 0;
+        salary = 0.0;
+        employeeCount++; // Increment employee count when an object is created
+    }
+
+    // Parameterized constructor
+    Employee(std::string empName, int empAge, double empSalary) {
+        name = empName;
+        age = empAge;
+        salary = empSalary;
+        employeeCount++;
+    }
+
+    // Copy constructor
+    Employee(const Employee &other) {
+        // Copy all data from the other object to this object
+        name = other.name;
+        age = other.age;
+        salary = other.salary;
+        employeeCount++;
+        // Note: Copy constructors perform a shallow copy unless you implement a deep copy (for dynamic memory).
+    }
+
+    // Destructor
+    ~Employee() {
+        employeeCount--; // Decrement employee count when an object is destroyed
+        // Destructors are useful for cleaning up resources like memory (if dynamically allocated).
+    }
+
+    // Static function to get the total number of Employee objects
+    static int getEmployeeCount() {
+        return employeeCount;
+    }
+
+    // Getters (used by EmployeeTable::appendAll)
+    const std::string& getName() const { return name; }
+    int getAge() const { return age; }
+    double getSalary() const { return salary; }
+
+    // Function to display employee details
+    void displayDetails() const {
+        std::cout << "Name: " << name << ", Age: " << age << ", Salary: " << salary << std::endl;
+    }
+
+    // Function to set employee details (example of public setter method)
+    void setDetails(std::string empName, int empAge, double empSalary) {
+        name = empName;
+        age = empAge;
+        salary = empSalary;
+    }
+};
+
+// Definition and initialization of static member outside the class
+// (inline, C++17: the header can be included by several .cpp files without duplicate definitions)
+inline int Employee::employeeCount = 0;
+
+#endif // EMPLOYEE_H
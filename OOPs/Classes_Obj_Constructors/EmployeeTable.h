@@ -0,0 +1,243 @@
+#ifndef EMPLOYEE_TABLE_H
+#define EMPLOYEE_TABLE_H
+
+#include <cstddef> // For size_t
+#include <cstdint> // For uint32_t
+#include <iterator> // For std::size
+#include <limits>
+#include <stdexcept> // For std::invalid_argument, std::length_error
+#include <string_view>
+#include <vector>
+#include "../../STL/Algorithms/SimdKernels.h" // For simd::activeLevel(), simd::summarize and the intrinsics headers
+#include "../../STL/Allocators/CacheLineAllocator.h"
+#include "StringPool.h"
+
+/*
+Notes about EmployeeTable:
+
+1. **Columns Instead of Objects (SoA)**:
+   - A vector<Employee> stores name, age and salary together per employee: 48 bytes per
+     object plus, for names longer than 15 characters, a heap block. A query over ages and
+     salaries still pulls every one of those bytes through the cache.
+   - EmployeeTable keeps one contiguous array per field (a column): ages (4 bytes each),
+     salaries (8) and name ids (4), the names themselves once each in a StringPool. Summing
+     salaries by age reads 12 bytes per employee, and the ages come 8 to a SIMD register.
+
+2. **Queries**:
+   - salaryInAgeRange(minAge, maxAge): total salary and head count for an inclusive age
+     range, in one pass. With AVX2 (picked at run time) or NEON, 8 (NEON: 4) ages are
+     compared at once and the comparison masks the matching salaries before they are added,
+     so there is no branch per employee.
+   - rowsInAgeRange: the matching row numbers (for reading their other columns), from the
+     same comparisons (AVX2) or a branchless loop.
+   - salaryByAgeBand(width): total salary per band of `width` years (0-9, 10-19, ...), one
+     pass with a band lookup table instead of a division per employee.
+   - The vector versions add salaries in a different order than a left-to-right loop, so
+     totals can differ from it in the last bits.
+
+3. **Appending**:
+   - append(name, age, salary) adds one row; appendAll(employees) reserves once and adds any
+     range of objects with getName(), getAge() and getSalary() (like Employee). Ages must not
+     be negative (std::invalid_argument).
+   - There is no per-object counter like Employee::employeeCount: size() is the count.
+*/
+
+namespace employee_detail {
+
+struct SalaryTotal {
+    double total = 0;
+    size_t employees = 0;
+};
+
+namespace scalar {
+
+inline SalaryTotal salaryInAgeRange(const int* ages, const double* salaries, size_t count, int minAge, int maxAge) {
+    SalaryTotal result;
+    for (size_t i = 0; i < count; ++i) {
+        bool match = ages[i] >= minAge && ages[i] <= maxAge;
+        result.total += match ? salaries[i] : 0.0;
+        result.employees += match;
+    }
+    return result;
+}
+
+// Writes the numbers of the matching rows (first + index) to rows, returns how many; no branch per row
+inline size_t selectInAgeRange(const int* ages, size_t count, int minAge, int maxAge, uint32_t* rows, size_t first) {
+    size_t found = 0;
+    for (size_t i = 0; i < count; ++i) {
+        rows[found] = static_cast<uint32_t>(first + i);
+        found += ages[i] >= minAge && ages[i] <= maxAge;
+    }
+    return found;
+}
+
+} // namespace scalar
+
+#if SIMD_HAS_AVX2_DISPATCH
+namespace avx2 {
+
+#define EMPLOYEE_SIMD __attribute__((target("avx2")))
+
+EMPLOYEE_SIMD inline SalaryTotal salaryInAgeRange(const int* ages, const double* salaries, size_t count, int minAge, int maxAge) {
+    const __m256i below = _mm256_set1_epi32(minAge), above = _mm256_set1_epi32(maxAge);
+    __m256d sum0 = _mm256_setzero_pd(), sum1 = _mm256_setzero_pd();
+    size_t matches = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i age = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ages + i));
+        __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(below, age), _mm256_cmpgt_epi32(age, above));
+        __m256i inside = _mm256_xor_si256(outside, _mm256_set1_epi32(-1));
+        matches += static_cast<size_t>(__builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(inside))));
+        // Widen the eight 32-bit lane masks to two sets of four 64-bit ones, one per salary vector
+        __m256d mask0 = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(inside)));
+        __m256d mask1 = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(inside, 1)));
+        sum0 = _mm256_add_pd(sum0, _mm256_and_pd(mask0, _mm256_loadu_pd(salaries + i)));
+        sum1 = _mm256_add_pd(sum1, _mm256_and_pd(mask1, _mm256_loadu_pd(salaries + i + 4)));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, _mm256_add_pd(sum0, sum1));
+    SalaryTotal rest = scalar::salaryInAgeRange(ages + i, salaries + i, count - i, minAge, maxAge);
+    rest.total += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    rest.employees += matches;
+    return rest;
+}
+
+EMPLOYEE_SIMD inline size_t selectInAgeRange(const int* ages, size_t count, int minAge, int maxAge, uint32_t* rows) {
+    const __m256i below = _mm256_set1_epi32(minAge), above = _mm256_set1_epi32(maxAge);
+    size_t found = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i age = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ages + i));
+        __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(below, age), _mm256_cmpgt_epi32(age, above));
+        unsigned mask = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(outside))) & 0xFF;
+        while (mask != 0) { // One step per match, none for a block without any
+            rows[found++] = static_cast<uint32_t>(i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+    return found + scalar::selectInAgeRange(ages + i, count - i, minAge, maxAge, rows + found, i);
+}
+
+#undef EMPLOYEE_SIMD
+
+} // namespace avx2
+#endif // SIMD_HAS_AVX2_DISPATCH
+
+#if SIMD_HAS_NEON
+namespace neon {
+
+inline SalaryTotal salaryInAgeRange(const int* ages, const double* salaries, size_t count, int minAge, int maxAge) {
+    const int32x4_t below = vdupq_n_s32(minAge), above = vdupq_n_s32(maxAge);
+    float64x2_t sum0 = vdupq_n_f64(0.0), sum1 = vdupq_n_f64(0.0);
+    uint32x4_t matches = vdupq_n_u32(0);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        int32x4_t age = vld1q_s32(ages + i);
+        uint32x4_t inside = vandq_u32(vcgeq_s32(age, below), vcleq_s32(age, above));
+        matches = vsubq_u32(matches, inside); // A match is all ones (-1): subtracting it counts it
+        // Sign-extending widens the all-ones 32-bit masks to all-ones 64-bit ones
+        uint64x2_t mask0 = vreinterpretq_u64_s64(vmovl_s32(vget_low_s32(vreinterpretq_s32_u32(inside))));
+        uint64x2_t mask1 = vreinterpretq_u64_s64(vmovl_s32(vget_high_s32(vreinterpretq_s32_u32(inside))));
+        sum0 = vaddq_f64(sum0, vreinterpretq_f64_u64(vandq_u64(mask0, vreinterpretq_u64_f64(vld1q_f64(salaries + i)))));
+        sum1 = vaddq_f64(sum1, vreinterpretq_f64_u64(vandq_u64(mask1, vreinterpretq_u64_f64(vld1q_f64(salaries + i + 2)))));
+    }
+    SalaryTotal rest = scalar::salaryInAgeRange(ages + i, salaries + i, count - i, minAge, maxAge);
+    rest.total += vaddvq_f64(vaddq_f64(sum0, sum1));
+    rest.employees += vaddvq_u32(matches);
+    return rest;
+}
+
+} // namespace neon
+#endif // SIMD_HAS_NEON
+
+inline SalaryTotal salaryInAgeRange(const int* ages, const double* salaries, size_t count, int minAge, int maxAge) {
+#if SIMD_HAS_AVX2_DISPATCH
+    if (simd::activeLevel() == simd::Level::Avx2) return avx2::salaryInAgeRange(ages, salaries, count, minAge, maxAge);
+#elif SIMD_HAS_NEON
+    if (simd::activeLevel() == simd::Level::Neon) return neon::salaryInAgeRange(ages, salaries, count, minAge, maxAge);
+#endif
+    return scalar::salaryInAgeRange(ages, salaries, count, minAge, maxAge);
+}
+
+inline size_t selectInAgeRange(const int* ages, size_t count, int minAge, int maxAge, uint32_t* rows) {
+#if SIMD_HAS_AVX2_DISPATCH
+    if (simd::activeLevel() == simd::Level::Avx2) return avx2::selectInAgeRange(ages, count, minAge, maxAge, rows);
+#endif
+    return scalar::selectInAgeRange(ages, count, minAge, maxAge, rows, 0);
+}
+
+} // namespace employee_detail
+
+class EmployeeTable {
+public:
+    using SalaryTotal = employee_detail::SalaryTotal;
+
+private:
+    StringPool namePool;
+    std::vector<StringPool::Id> nameIds;
+    std::vector<int, CacheLineAllocator<int>> ages;
+    std::vector<double, CacheLineAllocator<double>> salaries;
+
+public:
+    size_t size() const { return ages.size(); }
+    bool empty() const { return ages.empty(); }
+
+    void reserve(size_t rows) {
+        nameIds.reserve(rows);
+        ages.reserve(rows);
+        salaries.reserve(rows);
+    }
+
+    // Returns the new row's number
+    size_t append(std::string_view name, int age, double salary) {
+        if (age < 0) throw std::invalid_argument("EmployeeTable: negative age");
+        if (size() >= std::numeric_limits<uint32_t>::max()) throw std::length_error("EmployeeTable: too many rows");
+        nameIds.push_back(namePool.intern(name));
+        ages.push_back(age);
+        salaries.push_back(salary);
+        return size() - 1;
+    }
+
+    // Every element of employees (anything with getName(), getAge() and getSalary()), with one reserve
+    template <typename Range>
+    void appendAll(const Range& employees) {
+        reserve(size() + std::size(employees));
+        for (const auto& employee : employees) append(employee.getName(), employee.getAge(), employee.getSalary());
+    }
+
+    std::string_view name(size_t row) const { return namePool[nameIds[row]]; }
+    int age(size_t row) const { return ages[row]; }
+    double salary(size_t row) const { return salaries[row]; }
+
+    // The columns themselves, size() elements each
+    const int* ageColumn() const { return ages.data(); }
+    const double* salaryColumn() const { return salaries.data(); }
+    const StringPool::Id* nameColumn() const { return nameIds.data(); }
+    const StringPool& names() const { return namePool; }
+
+    // Total salary and head count of the employees aged minAge to maxAge (both included)
+    SalaryTotal salaryInAgeRange(int minAge, int maxAge) const {
+        return employee_detail::salaryInAgeRange(ages.data(), salaries.data(), size(), minAge, maxAge);
+    }
+
+    // Row numbers of the employees aged minAge to maxAge, in order
+    std::vector<uint32_t> rowsInAgeRange(int minAge, int maxAge) const {
+        std::vector<uint32_t> rows(size() + 1); // The scalar loop writes one past the last match
+        rows.resize(employee_detail::selectInAgeRange(ages.data(), size(), minAge, maxAge, rows.data()));
+        return rows;
+    }
+
+    // totals[b] is the salary of everyone aged b * width to b * width + width - 1
+    std::vector<double> salaryByAgeBand(int width) const {
+        if (width <= 0) throw std::invalid_argument("EmployeeTable: band width must be positive");
+        if (empty()) return {};
+        int oldest = simd::summarize(ages.data(), size()).max;
+        std::vector<uint32_t> bandOf(static_cast<size_t>(oldest) + 1);
+        for (int age = 0; age <= oldest; ++age) bandOf[age] = static_cast<uint32_t>(age / width);
+        std::vector<double> totals(oldest / width + 1);
+        for (size_t i = 0; i < size(); ++i) totals[bandOf[ages[i]]] += salaries[i];
+        return totals;
+    }
+};
+
+#endif // EMPLOYEE_TABLE_H
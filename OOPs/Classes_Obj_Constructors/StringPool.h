@@ -0,0 +1,123 @@
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <cstddef> // For size_t
+#include <cstdint> // For uint32_t
+#include <cstring> // For std::memcpy
+#include <limits>
+#include <memory> // For std::unique_ptr
+#include <stdexcept> // For std::length_error
+#include <string_view>
+#include <unordered_map>
+#include <utility> // For std::move, std::swap
+#include <vector>
+
+/*
+Notes about StringPool:
+
+1. **Interning**:
+   - intern(text) stores every distinct string once and returns a small id for it (0, 1, 2, ...
+     in order of first appearance); interning the same text again returns the same id.
+     Columns then store the 4-byte id instead of a 32-byte std::string plus its heap block.
+   - Comparing two interned strings is comparing their ids.
+
+2. **Storage**:
+   - The characters go into 64 KB chunks, back to back; a chunk is never moved or freed while
+     the pool lives, so the string_views that operator[] returns stay valid (unlike pointers into
+     a growing std::string or vector<char>). Strings longer than a chunk get a chunk of
+     their own.
+*/
+
+class StringPool {
+public:
+    using Id = uint32_t;
+    static constexpr Id npos = std::numeric_limits<Id>::max();
+
+private:
+    static constexpr size_t chunkSize = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> chunks;
+    char* free = nullptr; // Next unused byte of the current chunk
+    size_t freeBytes = 0;
+    size_t storedBytes = 0;
+    std::vector<std::string_view> strings; // Id -> text, pointing into chunks
+    std::unordered_map<std::string_view, Id> ids;
+
+    std::string_view store(std::string_view text) {
+        if (text.size() > freeBytes) {
+            if (text.size() > chunkSize) { // Its own chunk; the current one stays current
+                chunks.emplace_back(new char[text.size()]);
+                std::memcpy(chunks.back().get(), text.data(), text.size());
+                return std::string_view(chunks.back().get(), text.size());
+            }
+            chunks.emplace_back(new char[chunkSize]);
+            free = chunks.back().get();
+            freeBytes = chunkSize;
+        }
+        if (!text.empty()) std::memcpy(free, text.data(), text.size());
+        std::string_view stored(free, text.size());
+        free += text.size();
+        freeBytes -= text.size();
+        return stored;
+    }
+
+public:
+    StringPool() = default;
+
+    // Copies intern the strings again in the same order (so the ids stay the same): the views
+    // of the other pool point into its chunks
+    StringPool(const StringPool& other) {
+        for (std::string_view text : other.strings) intern(text);
+    }
+
+    // Moving keeps the chunks where they are, so the views stay valid; the source is left empty
+    StringPool(StringPool&& other) noexcept
+        : chunks(std::move(other.chunks)), free(other.free), freeBytes(other.freeBytes), storedBytes(other.storedBytes),
+          strings(std::move(other.strings)), ids(std::move(other.ids)) {
+        other.chunks.clear();
+        other.free = nullptr;
+        other.freeBytes = 0;
+        other.storedBytes = 0;
+        other.strings.clear();
+        other.ids.clear();
+    }
+
+    StringPool& operator=(StringPool other) noexcept { // Copy or move, then swap
+        swap(other);
+        return *this;
+    }
+
+    void swap(StringPool& other) noexcept {
+        std::swap(chunks, other.chunks);
+        std::swap(free, other.free);
+        std::swap(freeBytes, other.freeBytes);
+        std::swap(storedBytes, other.storedBytes);
+        std::swap(strings, other.strings);
+        std::swap(ids, other.ids);
+    }
+
+    Id intern(std::string_view text) {
+        auto found = ids.find(text);
+        if (found != ids.end()) return found->second;
+        if (strings.size() >= npos) throw std::length_error("StringPool: too many strings");
+        std::string_view stored = store(text);
+        Id id = static_cast<Id>(strings.size());
+        strings.push_back(stored);
+        ids.emplace(stored, id);
+        storedBytes += text.size();
+        return id;
+    }
+
+    // The id of text, npos if it was never interned
+    Id find(std::string_view text) const {
+        auto found = ids.find(text);
+        return found == ids.end() ? npos : found->second;
+    }
+
+    std::string_view operator[](Id id) const { return strings[id]; }
+
+    size_t size() const { return strings.size(); }
+    size_t bytes() const { return storedBytes; } // Characters stored, all strings together
+};
+
+#endif // STRING_POOL_H
@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeTable.h"
+#include "../../Benchmarks/AllocationCounter.h"
+
+using namespace std;
+
+/*
+Benchmark: a vector<Employee> against an EmployeeTable (one array per field)
+
+- 1M employees, aged 18 to 67, with 1000 distinct names of 20 to 30 characters (too long for
+  std::string's small buffer, so every Employee has a heap block for its name).
+- Build: pushing the employees into a vector<Employee> (reserved), against
+  EmployeeTable::appendAll of that vector. Counts heap allocations
+  (Benchmarks/AllocationCounter.h).
+- Age range: total salary of the employees aged 30 to 39, a loop over the objects against
+  salaryInAgeRange.
+- Age bands: total salary per 10-year band, a loop over the objects against salaryByAgeBand.
+- Memory: bytes held by each, the names' heap blocks included.
+- Results are ms per query, best of 10 passes. Run with "scalar" to turn the SIMD kernels off.
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static volatile double sink; // Keeps the optimizer from deleting the loops
+
+constexpr size_t employeeCount = 1 << 20;
+constexpr int nameCount = 1000;
+
+// ms per call of body, best of 10 passes
+template <typename Body>
+double bestMs(Body body) {
+    double best = 1e300;
+    for (int pass = 0; pass < 10; ++pass) {
+        auto start = chrono::steady_clock::now();
+        sink = body();
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+static bool nearlyEqual(double a, double b) { return fabs(a - b) <= 1e-9 * max(1.0, fabs(b)); }
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && strcmp(argv[1], "scalar") == 0) simd::useScalar(true);
+
+    mt19937 random(2024);
+    vector<string> names(nameCount);
+    for (string& name : names) {
+        size_t length = 20 + random() % 11;
+        for (size_t i = 0; i < length; ++i) name += static_cast<char>('a' + random() % 26);
+    }
+
+    // Build
+    vector<Employee> source;
+    source.reserve(employeeCount);
+    for (size_t i = 0; i < employeeCount; ++i) {
+        source.emplace_back(names[random() % nameCount], 18 + static_cast<int>(random() % 50), 30000.0 + random() % 90000);
+    }
+
+    size_t allocationsBefore = bench::allocationsSoFar().calls;
+    auto start = chrono::steady_clock::now();
+    vector<Employee> objects;
+    objects.reserve(employeeCount);
+    for (const Employee& employee : source) objects.push_back(employee);
+    double objectBuildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    size_t objectAllocations = bench::allocationsSoFar().calls - allocationsBefore;
+
+    allocationsBefore = bench::allocationsSoFar().calls;
+    start = chrono::steady_clock::now();
+    EmployeeTable table;
+    table.appendAll(source);
+    double tableBuildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    size_t tableAllocations = bench::allocationsSoFar().calls - allocationsBefore;
+
+    cout << "Build 1M: vector<Employee> " << objectBuildMs << " ms (" << objectAllocations << " allocations), EmployeeTable "
+         << tableBuildMs << " ms (" << tableAllocations << " allocations)" << endl;
+
+    // Age range
+    double objectTotal = 0;
+    double objectRangeMs = bestMs([&] {
+        double total = 0;
+        for (const Employee& employee : objects) {
+            if (employee.getAge() >= 30 && employee.getAge() <= 39) total += employee.getSalary();
+        }
+        objectTotal = total;
+        return total;
+    });
+    double tableTotal = 0;
+    double tableRangeMs = bestMs([&] {
+        tableTotal = table.salaryInAgeRange(30, 39).total;
+        return tableTotal;
+    });
+    cout << "Salary, ages 30-39: vector<Employee> " << objectRangeMs << " ms, EmployeeTable " << tableRangeMs << " ms" << endl;
+    if (!nearlyEqual(tableTotal, objectTotal)) cout << "MISMATCH: " << tableTotal << " != " << objectTotal << endl;
+
+    // Age bands
+    vector<double> objectBands, tableBands;
+    double objectBandMs = bestMs([&] {
+        objectBands.assign(7, 0.0);
+        for (const Employee& employee : objects) objectBands[employee.getAge() / 10] += employee.getSalary();
+        return objectBands[3];
+    });
+    double tableBandMs = bestMs([&] {
+        tableBands = table.salaryByAgeBand(10);
+        return tableBands[3];
+    });
+    cout << "Salary per 10-year band: vector<Employee> " << objectBandMs << " ms, EmployeeTable " << tableBandMs << " ms" << endl;
+    for (size_t band = 0; band < objectBands.size(); ++band) {
+        if (band >= tableBands.size() || !nearlyEqual(tableBands[band], objectBands[band])) {
+            cout << "MISMATCH in band " << band << endl;
+            break;
+        }
+    }
+
+    // Memory: the objects, plus each name's heap block (its capacity + 1 for the terminator)
+    size_t objectBytes = objects.capacity() * sizeof(Employee);
+    for (const Employee& employee : objects) objectBytes += employee.getName().capacity() + 1;
+    size_t tableBytes = table.size() * (sizeof(StringPool::Id) + sizeof(int) + sizeof(double)) + table.names().bytes();
+    cout << "Memory: vector<Employee> " << objectBytes / (1024 * 1024) << " MB, EmployeeTable " << tableBytes / (1024 * 1024)
+         << " MB (columns + names, without the pool's index)" << endl;
+    return 0;
+}
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <string>
+#include "Employee.h"
+#include "EmployeeTable.h"
 using namespace std;
 
 /*
@@ -30,70 +32,13 @@ using namespace std;
     5. Static Members:
        - Static variables belong to the class, not to any object instance.
        - Static methods can access static variables but not non-static members directly.
-*/
-
-class Employee {
-private:
-    string name;
-    int age;
-    double salary;
-
-    // Static member variable to keep track of the number of employees
-    static int employeeCount;
-
-public:
-    // Default constructor
-    Employee() {
-        name = "Unknown";
-        age = 0;
-        salary = 0.0;
-        employeeCount++; // Increment employee count when an object is created
-    }
-
-    // Parameterized constructor
-    Employee(string empName, int empAge, double empSalary) {
-        name = empName;
-        age = empAge;
-        salary = empSalary;
-        employeeCount++;
-    }
-
-    // Copy constructor
-    Employee(const Employee &other) {
-        // Copy all data from the other object to this object
-        name = other.name;
-        age = other.age;
-        salary = other.salary;
-        employeeCount++;
-        // Note: Copy constructors perform a shallow copy unless you implement a deep copy (for dynamic memory).
-    }
-
-    // Destructor
-    ~Employee() {
-        employeeCount--; // Decrement employee count when an object is destroyed
-        // Destructors are useful for cleaning up resources like memory (if dynamically allocated).
-    }
 
-    // Static function to get the total number of Employee objects
-    static int getEmployeeCount() {
-        return employeeCount;
-    }
-
-    // Function to display employee details
-    void displayDetails() const {
-        cout << "Name: " << name << ", Age: " << age << ", Salary: " << salary << endl;
-    }
-
-    // Function to set employee details (example of public setter method)
-    void setDetails(string empName, int empAge, double empSalary) {
-        name = empName;
-        age = empAge;
-        salary = empSalary;
-    }
-};
-
-// Definition and initialization of static member outside the class
-int Employee::employeeCount = 0;
+    6. Columns Instead of Objects:
+       - A query that reads a few fields of many objects ("total salary of everyone in their
+         thirties") pulls the whole objects through the cache. EmployeeTable (EmployeeTable.h)
+         stores one array per field and each distinct name once (StringPool.h), and runs such
+         queries with SIMD. benchmark.cpp compares it with a vector<Employee>.
+*/
 
 int main() {
     // Creating objects using the default constructor
@@ -121,5 +66,16 @@ int main() {
     // Final employee count after emp4 is destroyed
     cout << "Total Employees (after block): " << Employee::getEmployeeCount() << endl;
 
+    {
+        // The same data as columns: the table keeps a row per employee, not Employee objects
+        Employee team[] = {emp2, Employee("Carol", 41, 91000.0), Employee("Dave", 35, 68000.0), Employee("Alice", 52, 99000.0)};
+        EmployeeTable table;
+        table.appendAll(team);
+        EmployeeTable::SalaryTotal thirties = table.salaryInAgeRange(30, 39);
+        cout << "Employees aged 30-39: " << thirties.employees << ", total salary: " << thirties.total << endl;
+        for (uint32_t row : table.rowsInAgeRange(40, 59)) cout << "Aged 40-59: " << table.name(row) << endl;
+        cout << "Rows: " << table.size() << ", distinct names: " << table.names().size() << endl;
+    }
+
     return 0;
 }
@@ -0,0 +1,130 @@
+#ifndef STATIC_DISPATCH_H
+#define STATIC_DISPATCH_H
+
+#include <cstddef> // For size_t
+#include <iostream>
+#include <tuple>
+#include <utility> // For std::move
+#include <variant>
+#include <vector>
+
+/*
+Notes about the alternatives to virtual dispatch:
+
+1. **CRTP (Curiously Recurring Template Pattern)**:
+   - StaticBase<Derived> knows its derived class at compile time, so show() is a direct call
+     the compiler can inline: no vtable pointer in the object, no indirect call.
+   - The price: there is no common base type. A StaticBase<StaticDerived> and a
+     StaticBase<StaticAnotherDerived> are unrelated classes, so "a vector of any of them" is
+     not possible. PolyCollection keeps one vector per type instead and visits them type by
+     type: every loop is a loop over one concrete type (fast), but the insertion order across
+     types is lost.
+
+2. **std::variant + std::visit**:
+   - AnyDerived is one of a closed set of types, stored by value (no new, no pointer) and
+     dispatched by a switch on the stored index that the compiler generates. The set is fixed
+     where the variant is declared; adding a type means recompiling every visitor, which also
+     checks that every visitor handles it.
+   - Keeps the order of a mixed collection, unlike PolyCollection.
+
+3. **Which One**:
+   - Open set of types (plugins, types added by other modules): virtual functions.
+   - Closed set, mixed order matters (a message queue): variant.
+   - Closed set, order doesn't matter (update every entity of every kind): PolyCollection.
+   - benchmark.cpp measures all of them, plus function and member-function pointer tables.
+*/
+
+// CRTP version of Base: show() has a default, info() must be provided (like the pure virtual one)
+template <typename Derived>
+class StaticBase {
+public:
+    void show() { static_cast<Derived&>(*this).doShow(); }
+    void info() { static_cast<Derived&>(*this).doInfo(); }
+
+protected:
+    void doShow() {
+        std::cout << "Base Class Show" << std::endl; // Used unless Derived has its own doShow
+    }
+
+    ~StaticBase() = default; // Not deleted through StaticBase, so no virtual destructor needed
+};
+
+class StaticDerived : public StaticBase<StaticDerived> {
+    friend class StaticBase<StaticDerived>;
+
+    void doShow() { std::cout << "Derived Class Show" << std::endl; }
+    void doInfo() { std::cout << "Derived Class Info" << std::endl; }
+};
+
+class StaticAnotherDerived : public StaticBase<StaticAnotherDerived> {
+    friend class StaticBase<StaticAnotherDerived>;
+
+    void doShow() { std::cout << "Another Derived Class Show" << std::endl; }
+    void doInfo() { std::cout << "Another Derived Class Info" << std::endl; }
+};
+
+// Works with every StaticBase; one copy of the function is compiled per derived class
+template <typename Derived>
+void describe(StaticBase<Derived>& object) {
+    object.show();
+    object.info();
+}
+
+// One vector per type; forEach visits all elements of the first type, then the second, ...
+template <typename... Types>
+class PolyCollection {
+private:
+    std::tuple<std::vector<Types>...> parts;
+
+public:
+    template <typename T>
+    void add(T value) {
+        std::get<std::vector<T>>(parts).push_back(std::move(value));
+    }
+
+    template <typename T>
+    std::vector<T>& all() {
+        return std::get<std::vector<T>>(parts);
+    }
+
+    size_t size() const {
+        return std::apply([](const auto&... part) { return (part.size() + ... + size_t(0)); }, parts);
+    }
+
+    // func(element) with the element's concrete type: no virtual call, the body can be inlined
+    template <typename Func>
+    void forEach(Func&& func) {
+        std::apply([&](auto&... part) { (forEachIn(part, func), ...); }, parts);
+    }
+
+private:
+    template <typename T, typename Func>
+    static void forEachIn(std::vector<T>& part, Func& func) {
+        for (T& element : part) func(element);
+    }
+};
+
+// variant version: plain classes without a common base, combined in AnyDerived
+class VariantDerived {
+public:
+    void show() { std::cout << "Derived Class Show" << std::endl; }
+    void info() { std::cout << "Derived Class Info" << std::endl; }
+};
+
+class VariantAnotherDerived {
+public:
+    void show() { std::cout << "Another Derived Class Show" << std::endl; }
+    void info() { std::cout << "Another Derived Class Info" << std::endl; }
+};
+
+using AnyDerived = std::variant<VariantDerived, VariantAnotherDerived>;
+
+inline void show(AnyDerived& object) {
+    std::visit([](auto& alternative) { alternative.show(); }, object);
+}
+
+inline void info(AnyDerived& object) {
+    std::visit([](auto& alternative) { alternative.info(); }, object);
+}
+
+#endif // STATIC_DISPATCH_H
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <variant>
+#include <vector>
+#include "StaticDispatch.h"
+
+using namespace std;
+
+/*
+Benchmark: five ways to dispatch a message to the handler for its kind
+
+- 1M messages of 4 kinds, each with a 32-bit payload; the handlers are the operations of
+  P2M _P2NM/main.cpp (add ten, multiply by two, subtract five) plus one more, and their
+  results are summed.
+- virtual: vector<unique_ptr<Message>>, one virtual handle() per message (the Base / Derived
+  way: one heap object per message, one indirect call).
+- member pointers: {kind, payload} records and a table of pointers to Handlers member
+  functions (like &Calculator::addTen), called with (handlers.*table[kind])(payload).
+- function pointers: the same records and a table of free functions.
+- variant: vector<variant<...>> by value, std::visit (a switch the compiler generates).
+- CRTP: a PolyCollection with one vector per kind; each loop calls a known type, inlined.
+- Sorted: all messages of one kind, then the next kind. Shuffled: kinds in random order, so
+  the indirect branches (virtual, pointers) and the variant's switch are mispredicted about
+  3 times out of 4. CRTP visits by kind either way (it can't keep a mixed order), so its two
+  numbers are the same work.
+- Results are ns per message, best of 5 passes.
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static volatile uint64_t sink; // Keeps the optimizer from deleting the loops
+
+constexpr size_t messageCount = 1 << 20;
+constexpr int kindCount = 4;
+
+// --- virtual ---
+struct Message {
+    uint32_t payload;
+    explicit Message(uint32_t payload) : payload(payload) {}
+    virtual uint64_t handle() const = 0;
+    virtual ~Message() {}
+};
+
+struct AddTenMessage : Message {
+    using Message::Message;
+    uint64_t handle() const override { return payload + 10; }
+};
+
+struct MultiplyByTwoMessage : Message {
+    using Message::Message;
+    uint64_t handle() const override { return uint64_t(payload) * 2; }
+};
+
+struct SubtractFiveMessage : Message {
+    using Message::Message;
+    uint64_t handle() const override { return payload - 5; }
+};
+
+struct TripleMessage : Message {
+    using Message::Message;
+    uint64_t handle() const override { return uint64_t(payload) * 3 + 1; }
+};
+
+// --- member and free function pointers ---
+struct Record {
+    uint8_t kind;
+    uint32_t payload;
+};
+
+class Handlers {
+public:
+    uint32_t ten = 10, five = 5; // Some state, like a real handler object has
+
+    uint64_t addTen(uint32_t payload) const { return payload + ten; }
+    uint64_t multiplyByTwo(uint32_t payload) const { return uint64_t(payload) * 2; }
+    uint64_t subtractFive(uint32_t payload) const { return payload - five; }
+    uint64_t triple(uint32_t payload) const { return uint64_t(payload) * 3 + 1; }
+};
+
+static uint64_t addTen(uint32_t payload) { return payload + 10; }
+static uint64_t multiplyByTwo(uint32_t payload) { return uint64_t(payload) * 2; }
+static uint64_t subtractFive(uint32_t payload) { return payload - 5; }
+static uint64_t triple(uint32_t payload) { return uint64_t(payload) * 3 + 1; }
+
+// --- variant and CRTP ---
+template <typename Derived>
+struct MessageBase {
+    uint32_t payload;
+    uint64_t handle() const { return static_cast<const Derived&>(*this).apply(payload); }
+};
+
+struct AddTen : MessageBase<AddTen> {
+    static uint64_t apply(uint32_t payload) { return payload + 10; }
+};
+
+struct MultiplyByTwo : MessageBase<MultiplyByTwo> {
+    static uint64_t apply(uint32_t payload) { return uint64_t(payload) * 2; }
+};
+
+struct SubtractFive : MessageBase<SubtractFive> {
+    static uint64_t apply(uint32_t payload) { return payload - 5; }
+};
+
+struct Triple : MessageBase<Triple> {
+    static uint64_t apply(uint32_t payload) { return uint64_t(payload) * 3 + 1; }
+};
+
+using AnyMessage = variant<AddTen, MultiplyByTwo, SubtractFive, Triple>;
+
+// ns per message, best of 5 passes
+template <typename Body>
+double nsPerMessage(Body body) {
+    double best = 1e300;
+    for (int pass = 0; pass < 5; ++pass) {
+        auto start = chrono::steady_clock::now();
+        sink = body();
+        best = min(best, chrono::duration<double, nano>(chrono::steady_clock::now() - start).count());
+    }
+    return best / messageCount;
+}
+
+static void run(const char* order, const vector<Record>& records) {
+    vector<unique_ptr<Message>> messages;
+    vector<AnyMessage> variants;
+    PolyCollection<AddTen, MultiplyByTwo, SubtractFive, Triple> collection;
+    for (const Record& record : records) {
+        switch (record.kind) {
+            case 0:
+                messages.push_back(make_unique<AddTenMessage>(record.payload));
+                variants.push_back(AddTen{{record.payload}});
+                collection.add(AddTen{{record.payload}});
+                break;
+            case 1:
+                messages.push_back(make_unique<MultiplyByTwoMessage>(record.payload));
+                variants.push_back(MultiplyByTwo{{record.payload}});
+                collection.add(MultiplyByTwo{{record.payload}});
+                break;
+            case 2:
+                messages.push_back(make_unique<SubtractFiveMessage>(record.payload));
+                variants.push_back(SubtractFive{{record.payload}});
+                collection.add(SubtractFive{{record.payload}});
+                break;
+            default:
+                messages.push_back(make_unique<TripleMessage>(record.payload));
+                variants.push_back(Triple{{record.payload}});
+                collection.add(Triple{{record.payload}});
+                break;
+        }
+    }
+
+    double virtualCalls = nsPerMessage([&] {
+        uint64_t sum = 0;
+        for (const auto& message : messages) sum += message->handle();
+        return sum;
+    });
+
+    Handlers handlers;
+    uint64_t (Handlers::*memberTable[kindCount])(uint32_t) const = {&Handlers::addTen, &Handlers::multiplyByTwo,
+                                                                     &Handlers::subtractFive, &Handlers::triple};
+    double memberPointers = nsPerMessage([&] {
+        uint64_t sum = 0;
+        for (const Record& record : records) sum += (handlers.*memberTable[record.kind])(record.payload);
+        return sum;
+    });
+
+    uint64_t (*functionTable[kindCount])(uint32_t) = {addTen, multiplyByTwo, subtractFive, triple};
+    double functionPointers = nsPerMessage([&] {
+        uint64_t sum = 0;
+        for (const Record& record : records) sum += functionTable[record.kind](record.payload);
+        return sum;
+    });
+
+    double visits = nsPerMessage([&] {
+        uint64_t sum = 0;
+        for (const AnyMessage& message : variants) {
+            sum += visit([](const auto& alternative) { return alternative.handle(); }, message);
+        }
+        return sum;
+    });
+
+    double crtp = nsPerMessage([&] {
+        uint64_t sum = 0;
+        collection.forEach([&](const auto& message) { sum += message.handle(); });
+        return sum;
+    });
+
+    cout << order << ", ns/message: virtual " << virtualCalls << ", member pointers " << memberPointers
+         << ", function pointers " << functionPointers << ", variant " << visits << ", CRTP " << crtp << endl;
+}
+
+int main() {
+    mt19937 random(2024);
+    vector<Record> records(messageCount);
+    for (Record& record : records) {
+        record.kind = static_cast<uint8_t>(random() % kindCount);
+        record.payload = static_cast<uint32_t>(random() % 100000);
+    }
+    vector<Record> sorted = records;
+    stable_sort(sorted.begin(), sorted.end(), [](const Record& a, const Record& b) { return a.kind < b.kind; });
+
+    run("sorted  ", sorted);
+    run("shuffled", records);
+    return 0;
+}
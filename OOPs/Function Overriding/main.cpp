@@ -1,4 +1,5 @@
 #include <iostream>
+#include "StaticDispatch.h"
 using namespace std;
 
 // *********************
@@ -36,6 +37,8 @@ using namespace std;
 //    - Serves as a blueprint for derived classes that must implement the pure virtual functions.
 
 // 7. **Example Demonstrating Virtual Functions and Pure Virtual Functions**:
+//    - The same hierarchy without virtual calls is in StaticDispatch.h: a CRTP version (StaticBase)
+//      and a std::variant version (AnyDerived). benchmark.cpp compares what each call costs.
 
 class Base {
 public:
@@ -89,6 +92,22 @@ int main() {
     basePtr->info(); // Output: Another Derived Class Info
     delete basePtr; // Cleanup
 
+    // CRTP: the derived class is known at compile time, show() and info() are direct calls
+    StaticDerived staticDerived;
+    describe(staticDerived); // Output: Derived Class Show, Derived Class Info
+
+    PolyCollection<StaticDerived, StaticAnotherDerived> collection; // One vector per type
+    collection.add(StaticAnotherDerived());
+    collection.add(StaticDerived());
+    collection.forEach([](auto& object) { describe(object); }); // All StaticDerived first, then StaticAnotherDerived
+
+    // variant: a closed set of types in one vector, by value and in insertion order
+    vector<AnyDerived> objects = {VariantAnotherDerived(), VariantDerived()};
+    for (AnyDerived& object : objects) {
+        show(object); // Output: Another Derived Class Show, then Derived Class Show
+        info(object);
+    }
+
     return 0;
 }
 
@@ -98,3 +117,5 @@ int main() {
 // - Use `virtual` to enable dynamic binding for overridden functions.
 // - If the `virtual` keyword is not used, the function called is determined at compile time based on the pointer type.
 // - Pure virtual functions enforce implementation in derived classes, creating an abstract class.
+// - When the set of derived classes is closed, CRTP (StaticBase, PolyCollection) or std::variant
+//   (AnyDerived) give the same behavior without virtual calls.
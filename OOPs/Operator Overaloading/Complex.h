@@ -0,0 +1,105 @@
+#ifndef COMPLEX_H
+#define COMPLEX_H
+
+#include <iostream>
+#include <stdexcept> // For std::out_of_range
+
+class Complex
+{
+private:
+    double real; // Real part
+    double imag; // Imaginary part
+
+public:
+    // Constructor
+    Complex(double r = 0.0, double i = 0.0) : real(r), imag(i) {}
+    Complex(const Complex &other) = default;
+
+    double getReal() const { return real; }
+    double getImag() const { return imag; }
+
+    void display()
+    {
+        std::cout << *this << std::endl;
+    }
+
+    // Arithmetic Operator (Member Function)
+    Complex operator+(const Complex &other) const
+    {
+        return Complex(real + other.real, imag + other.imag); // Addition
+    }
+
+    // Arithmetic Operator (Member Function)
+    Complex operator*(const Complex &other) const
+    {
+        return Complex(real * other.real - imag * other.imag, real * other.imag + imag * other.real); // Multiplication
+    }
+
+    // Relational Operator (Member Function)
+    bool operator==(const Complex &other) const
+    {
+        return (real == other.real && imag == other.imag); // Equality
+    }
+
+    // Assignment Operator (Member Function)
+    Complex& operator=(const Complex &other)
+    {
+        if (this != &other)
+        {
+            real = other.real; // Assignment
+            imag = other.imag;
+        }
+        return *this;
+    }
+
+    // Increment Operator (Member Function)
+    Complex& operator++()
+    { // Prefix Increment
+        ++real;
+        return *this;
+    }
+
+    // Function Call Operator (Member Function)
+    double operator()(int index)
+    {
+        if (index == 0)
+            return real; // Return real part
+        else if (index == 1)
+            return imag;                          // Return imaginary part
+        throw std::out_of_range("Index out of range"); // Handle invalid index
+    }
+
+    // Pointer Dereference Operator (Member Function)
+    double& operator*()
+    {
+        return real; // Dereference to real part
+    }
+
+    // Pointer Member Operator (Non-Member Function)
+    Complex* operator->()
+    {
+        return this; // Pointer to real part
+    }
+
+    // Logical Operator (Non-Member Function)
+    friend bool operator&&(const Complex& c1, const Complex& c2)
+    {
+        return (c1.real != 0 && c1.imag != 0) && (c2.real != 0 && c2.imag != 0); // Logical AND
+    }
+
+    // Input Operator (Non-Member Function)
+    friend std::istream& operator>>(std::istream& is, Complex& c)
+    {
+        is >> c.real >> c.imag; // Input
+        return is;
+    }
+
+    // Output Operator (Non-Member Function)
+    friend std::ostream& operator<<(std::ostream& os, const Complex& c)
+    {
+        os << c.real << (c.imag >= 0 ? "+" : "") << c.imag << "i"; // Output
+        return os;
+    }
+};
+
+#endif // COMPLEX_H
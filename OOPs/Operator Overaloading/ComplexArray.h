@@ -0,0 +1,475 @@
+#ifndef COMPLEX_ARRAY_H
+#define COMPLEX_ARRAY_H
+
+#include <array>
+#include <cstddef> // For size_t
+#include <initializer_list>
+#include <stdexcept> // For std::invalid_argument, std::out_of_range
+#include <type_traits> // For std::conditional_t, std::is_same
+#include <vector>
+#include "../../STL/Algorithms/SimdKernels.h" // For simd::activeLevel() and the intrinsics headers
+#include "../../STL/Allocators/CacheLineAllocator.h"
+#include "Complex.h"
+
+/*
+Notes about ComplexArray:
+
+1. **Storage (SoA)**:
+   - An array of Complex stores real, imag, real, imag, ... (array of structures). A vector
+     register loaded from it holds both parts mixed, and a complex multiply has to shuffle
+     them apart first.
+   - ComplexArray keeps all real parts in one array and all imaginary parts in another
+     (structure of arrays), so 4 real parts are one AVX2 load, and a complex multiply is just
+     multiplies and FMAs on the two lanes.
+   - Elements are read as Complex values (a[i]) and written with set(i, c).
+
+2. **Expression Templates**:
+   - `d = a + b * c` on arrays does not compute b * c into a temporary array and add a to
+     it. The operators only build a small expression object (Sum<ComplexArray,
+     Product<ComplexArray, ComplexArray>>) that remembers its operands; assigning it to an
+     array evaluates the whole expression in one pass over the inputs.
+   - The pass goes block by block: the parts of the expression are computed for 256
+     elements at a time into buffers on the stack (4 KB each, they stay in L1), so no
+     intermediate ever goes to memory. A sum whose one side is a product (a + b * c,
+     a - b * c) is done by one fused multiply-add kernel.
+   - Expressions hold the arrays by reference: evaluate them in the statement that builds
+     them, don't keep one in an `auto` variable past the arrays it uses.
+   - The destination may be one of the operands (a = a + b * c): every element is only read
+     before it is written.
+
+3. **SIMD Kernels**:
+   - add, subtract, multiply and multiplyAdd come in scalar, AVX2 + FMA (picked at run time,
+     like Matrix) and NEON versions; simd::useScalar(true) forces the scalar ones.
+   - The FMA versions round a * b + c once instead of twice, so results can differ from
+     Complex's operators (and from the scalar kernels) in the last bit.
+*/
+
+class ComplexArray;
+
+template <typename E>
+struct ComplexExpr {
+    const E& self() const { return static_cast<const E&>(*this); }
+    size_t size() const { return self().size(); }
+};
+
+namespace complex_detail {
+
+constexpr size_t block = 256; // Elements per evaluation step
+
+// Where a part of an expression put the values of one block
+struct Lanes {
+    const double* real;
+    const double* imag;
+};
+
+struct Buffer {
+    alignas(64) double real[block];
+    alignas(64) double imag[block];
+};
+
+// Expressions store arrays by reference and everything else (the small expression nodes) by value
+template <typename E>
+using Stored = std::conditional_t<std::is_same<E, ComplexArray>::value, const ComplexArray&, E>;
+
+// Scratch buffers needed to evaluate E as an operand: leaves need none, the others one for their result plus their own
+template <typename E>
+constexpr size_t buffersFor() {
+    return E::isLeaf ? 0 : 1 + E::scratch;
+}
+
+template <typename E>
+Lanes evaluate(const E& expr, size_t first, size_t count, Buffer* scratch) {
+    if constexpr (E::isLeaf) {
+        return expr.lanes(first, count, nullptr, nullptr, nullptr);
+    } else {
+        return expr.lanes(first, count, scratch + 1, scratch->real, scratch->imag);
+    }
+}
+
+namespace scalar {
+
+inline void add(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        real[i] = x.real[i] + y.real[i];
+        imag[i] = x.imag[i] + y.imag[i];
+    }
+}
+
+inline void subtract(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        real[i] = x.real[i] - y.real[i];
+        imag[i] = x.imag[i] - y.imag[i];
+    }
+}
+
+inline void multiply(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        double r = x.real[i] * y.real[i] - x.imag[i] * y.imag[i];
+        double m = x.real[i] * y.imag[i] + x.imag[i] * y.real[i];
+        real[i] = r;
+        imag[i] = m;
+    }
+}
+
+// acc + x * y, or acc - x * y
+inline void multiplyAdd(Lanes acc, Lanes x, Lanes y, bool subtract, double* real, double* imag, size_t count) {
+    double sign = subtract ? -1.0 : 1.0;
+    for (size_t i = 0; i < count; ++i) {
+        double r = acc.real[i] + sign * (x.real[i] * y.real[i] - x.imag[i] * y.imag[i]);
+        double m = acc.imag[i] + sign * (x.real[i] * y.imag[i] + x.imag[i] * y.real[i]);
+        real[i] = r;
+        imag[i] = m;
+    }
+}
+
+} // namespace scalar
+
+// x86 kernels, built for AVX2 + FMA; COMPLEX_DISPATCH picks them only if simd::hasAvx2Fma()
+#if SIMD_HAS_AVX2_DISPATCH
+#define COMPLEX_SIMD __attribute__((target("avx2,fma")))
+
+namespace avx2 {
+
+// The kernels load every input of element i before storing element i, so the output may be an input
+COMPLEX_SIMD inline void add(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(real + i, _mm256_add_pd(_mm256_loadu_pd(x.real + i), _mm256_loadu_pd(y.real + i)));
+        _mm256_storeu_pd(imag + i, _mm256_add_pd(_mm256_loadu_pd(x.imag + i), _mm256_loadu_pd(y.imag + i)));
+    }
+    scalar::add(Lanes{x.real + i, x.imag + i}, Lanes{y.real + i, y.imag + i}, real + i, imag + i, count - i);
+}
+
+COMPLEX_SIMD inline void subtract(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(real + i, _mm256_sub_pd(_mm256_loadu_pd(x.real + i), _mm256_loadu_pd(y.real + i)));
+        _mm256_storeu_pd(imag + i, _mm256_sub_pd(_mm256_loadu_pd(x.imag + i), _mm256_loadu_pd(y.imag + i)));
+    }
+    scalar::subtract(Lanes{x.real + i, x.imag + i}, Lanes{y.real + i, y.imag + i}, real + i, imag + i, count - i);
+}
+
+COMPLEX_SIMD inline void multiply(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d xr = _mm256_loadu_pd(x.real + i), xi = _mm256_loadu_pd(x.imag + i);
+        __m256d yr = _mm256_loadu_pd(y.real + i), yi = _mm256_loadu_pd(y.imag + i);
+        _mm256_storeu_pd(real + i, _mm256_fmsub_pd(xr, yr, _mm256_mul_pd(xi, yi)));
+        _mm256_storeu_pd(imag + i, _mm256_fmadd_pd(xr, yi, _mm256_mul_pd(xi, yr)));
+    }
+    scalar::multiply(Lanes{x.real + i, x.imag + i}, Lanes{y.real + i, y.imag + i}, real + i, imag + i, count - i);
+}
+
+COMPLEX_SIMD inline void multiplyAdd(Lanes acc, Lanes x, Lanes y, bool subtract, double* real, double* imag, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d ar = _mm256_loadu_pd(acc.real + i), ai = _mm256_loadu_pd(acc.imag + i);
+        __m256d xr = _mm256_loadu_pd(x.real + i), xi = _mm256_loadu_pd(x.imag + i);
+        __m256d yr = _mm256_loadu_pd(y.real + i), yi = _mm256_loadu_pd(y.imag + i);
+        if (subtract) { // acc - x * y: real acc - xr yr + xi yi, imag acc - xr yi - xi yr
+            _mm256_storeu_pd(real + i, _mm256_fmadd_pd(xi, yi, _mm256_fnmadd_pd(xr, yr, ar)));
+            _mm256_storeu_pd(imag + i, _mm256_fnmadd_pd(xi, yr, _mm256_fnmadd_pd(xr, yi, ai)));
+        } else { // acc + x * y: real acc + xr yr - xi yi, imag acc + xr yi + xi yr
+            _mm256_storeu_pd(real + i, _mm256_fnmadd_pd(xi, yi, _mm256_fmadd_pd(xr, yr, ar)));
+            _mm256_storeu_pd(imag + i, _mm256_fmadd_pd(xi, yr, _mm256_fmadd_pd(xr, yi, ai)));
+        }
+    }
+    scalar::multiplyAdd(Lanes{acc.real + i, acc.imag + i}, Lanes{x.real + i, x.imag + i}, Lanes{y.real + i, y.imag + i},
+                        subtract, real + i, imag + i, count - i);
+}
+
+} // namespace avx2
+
+#undef COMPLEX_SIMD
+#endif // SIMD_HAS_AVX2_DISPATCH
+
+#if SIMD_HAS_NEON
+namespace neon {
+
+inline void add(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        vst1q_f64(real + i, vaddq_f64(vld1q_f64(x.real + i), vld1q_f64(y.real + i)));
+        vst1q_f64(imag + i, vaddq_f64(vld1q_f64(x.imag + i), vld1q_f64(y.imag + i)));
+    }
+    scalar::add(Lanes{x.real + i, x.imag + i}, Lanes{y.real + i, y.imag + i}, real + i, imag + i, count - i);
+}
+
+inline void subtract(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        vst1q_f64(real + i, vsubq_f64(vld1q_f64(x.real + i), vld1q_f64(y.real + i)));
+        vst1q_f64(imag + i, vsubq_f64(vld1q_f64(x.imag + i), vld1q_f64(y.imag + i)));
+    }
+    scalar::subtract(Lanes{x.real + i, x.imag + i}, Lanes{y.real + i, y.imag + i}, real + i, imag + i, count - i);
+}
+
+inline void multiply(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        float64x2_t xr = vld1q_f64(x.real + i), xi = vld1q_f64(x.imag + i);
+        float64x2_t yr = vld1q_f64(y.real + i), yi = vld1q_f64(y.imag + i);
+        vst1q_f64(real + i, vfmsq_f64(vmulq_f64(xr, yr), xi, yi)); // vfmsq_f64(c, a, b) = c - a * b
+        vst1q_f64(imag + i, vfmaq_f64(vmulq_f64(xr, yi), xi, yr)); // vfmaq_f64(c, a, b) = c + a * b
+    }
+    scalar::multiply(Lanes{x.real + i, x.imag + i}, Lanes{y.real + i, y.imag + i}, real + i, imag + i, count - i);
+}
+
+inline void multiplyAdd(Lanes acc, Lanes x, Lanes y, bool subtract, double* real, double* imag, size_t count) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        float64x2_t ar = vld1q_f64(acc.real + i), ai = vld1q_f64(acc.imag + i);
+        float64x2_t xr = vld1q_f64(x.real + i), xi = vld1q_f64(x.imag + i);
+        float64x2_t yr = vld1q_f64(y.real + i), yi = vld1q_f64(y.imag + i);
+        if (subtract) {
+            vst1q_f64(real + i, vfmaq_f64(vfmsq_f64(ar, xr, yr), xi, yi));
+            vst1q_f64(imag + i, vfmsq_f64(vfmsq_f64(ai, xr, yi), xi, yr));
+        } else {
+            vst1q_f64(real + i, vfmsq_f64(vfmaq_f64(ar, xr, yr), xi, yi));
+            vst1q_f64(imag + i, vfmaq_f64(vfmaq_f64(ai, xr, yi), xi, yr));
+        }
+    }
+    scalar::multiplyAdd(Lanes{acc.real + i, acc.imag + i}, Lanes{x.real + i, x.imag + i}, Lanes{y.real + i, y.imag + i},
+                        subtract, real + i, imag + i, count - i);
+}
+
+} // namespace neon
+#endif // SIMD_HAS_NEON
+
+// The dispatching entry points: the best version for this CPU
+#if SIMD_HAS_AVX2_DISPATCH
+#define COMPLEX_DISPATCH(call) return simd::hasAvx2Fma() ? avx2::call : scalar::call
+#elif SIMD_HAS_NEON
+#define COMPLEX_DISPATCH(call) return simd::activeLevel() == simd::Level::Neon ? neon::call : scalar::call
+#else
+#define COMPLEX_DISPATCH(call) return scalar::call
+#endif
+
+inline void add(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    COMPLEX_DISPATCH(add(x, y, real, imag, count));
+}
+
+inline void subtract(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    COMPLEX_DISPATCH(subtract(x, y, real, imag, count));
+}
+
+inline void multiply(Lanes x, Lanes y, double* real, double* imag, size_t count) {
+    COMPLEX_DISPATCH(multiply(x, y, real, imag, count));
+}
+
+inline void multiplyAdd(Lanes acc, Lanes x, Lanes y, bool subtract, double* real, double* imag, size_t count) {
+    COMPLEX_DISPATCH(multiplyAdd(acc, x, y, subtract, real, imag, count));
+}
+
+#undef COMPLEX_DISPATCH
+
+inline void checkSizes(size_t left, size_t right) {
+    if (left != right) throw std::invalid_argument("ComplexArray operands have different sizes");
+}
+
+// Every element the same value (the Complex side of array * Complex)
+class Broadcast : public ComplexExpr<Broadcast> {
+private:
+    Complex value;
+    size_t count;
+
+public:
+    static constexpr bool isLeaf = false;
+    static constexpr size_t scratch = 0;
+
+    Broadcast(const Complex& value, size_t count) : value(value), count(count) {}
+
+    size_t size() const { return count; }
+
+    Lanes lanes(size_t, size_t blockCount, Buffer*, double* real, double* imag) const {
+        for (size_t i = 0; i < blockCount; ++i) {
+            real[i] = value.getReal();
+            imag[i] = value.getImag();
+        }
+        return Lanes{real, imag};
+    }
+};
+
+template <typename L, typename R>
+class Product : public ComplexExpr<Product<L, R>> {
+private:
+    Stored<L> left;
+    Stored<R> right;
+
+public:
+    static constexpr bool isLeaf = false;
+    static constexpr size_t scratch = buffersFor<L>() + buffersFor<R>();
+
+    Product(const L& left, const R& right) : left(left), right(right) { checkSizes(left.size(), right.size()); }
+
+    size_t size() const { return left.size(); }
+
+    Lanes lanes(size_t first, size_t count, Buffer* buffers, double* real, double* imag) const {
+        Lanes x = evaluate(left, first, count, buffers);
+        Lanes y = evaluate(right, first, count, buffers + buffersFor<L>());
+        multiply(x, y, real, imag, count);
+        return Lanes{real, imag};
+    }
+
+    // acc + this (or acc - this) in one FMA pass, instead of the product into a buffer and then the sum
+    Lanes addTo(Lanes acc, bool subtract, size_t first, size_t count, Buffer* buffers, double* real, double* imag) const {
+        Lanes x = evaluate(left, first, count, buffers);
+        Lanes y = evaluate(right, first, count, buffers + buffersFor<L>());
+        multiplyAdd(acc, x, y, subtract, real, imag, count);
+        return Lanes{real, imag};
+    }
+};
+
+template <typename E>
+struct IsProduct : std::false_type {};
+
+template <typename L, typename R>
+struct IsProduct<Product<L, R>> : std::true_type {};
+
+template <typename L, typename R, bool Subtract>
+class Sum : public ComplexExpr<Sum<L, R, Subtract>> {
+private:
+    Stored<L> left;
+    Stored<R> right;
+
+public:
+    static constexpr bool isLeaf = false;
+    static constexpr size_t scratch = buffersFor<L>() + buffersFor<R>();
+
+    Sum(const L& left, const R& right) : left(left), right(right) { checkSizes(left.size(), right.size()); }
+
+    size_t size() const { return left.size(); }
+
+    Lanes lanes(size_t first, size_t count, Buffer* buffers, double* real, double* imag) const {
+        if constexpr (IsProduct<R>::value) { // a + b * c, a - b * c
+            Lanes acc = evaluate(left, first, count, buffers);
+            return right.addTo(acc, Subtract, first, count, buffers + buffersFor<L>(), real, imag);
+        } else if constexpr (IsProduct<L>::value && !Subtract) { // b * c + a
+            Lanes acc = evaluate(right, first, count, buffers + buffersFor<L>());
+            return left.addTo(acc, false, first, count, buffers, real, imag);
+        } else {
+            Lanes x = evaluate(left, first, count, buffers);
+            Lanes y = evaluate(right, first, count, buffers + buffersFor<L>());
+            if (Subtract) {
+                subtract(x, y, real, imag, count);
+            } else {
+                add(x, y, real, imag, count);
+            }
+            return Lanes{real, imag};
+        }
+    }
+};
+
+} // namespace complex_detail
+
+class ComplexArray : public ComplexExpr<ComplexArray> {
+private:
+    std::vector<double, CacheLineAllocator<double>> realParts;
+    std::vector<double, CacheLineAllocator<double>> imagParts;
+
+    template <typename E>
+    void assign(const E& expr) {
+        using namespace complex_detail;
+        std::array<Buffer, E::scratch> buffers;
+        for (size_t first = 0; first < size(); first += block) {
+            size_t count = size() - first < block ? size() - first : block;
+            expr.lanes(first, count, buffers.data(), realParts.data() + first, imagParts.data() + first);
+        }
+    }
+
+public:
+    static constexpr bool isLeaf = true;
+    static constexpr size_t scratch = 0;
+
+    ComplexArray() = default;
+
+    explicit ComplexArray(size_t size, const Complex& fill = Complex()) : realParts(size, fill.getReal()), imagParts(size, fill.getImag()) {}
+
+    ComplexArray(std::initializer_list<Complex> values) {
+        realParts.reserve(values.size());
+        imagParts.reserve(values.size());
+        for (const Complex& value : values) push_back(value);
+    }
+
+    // ComplexArray d = a + b * c;
+    template <typename E>
+    ComplexArray(const ComplexExpr<E>& expr) : realParts(expr.size()), imagParts(expr.size()) {
+        assign(expr.self());
+    }
+
+    ComplexArray(const ComplexArray&) = default;
+    ComplexArray(ComplexArray&&) = default;
+    ComplexArray& operator=(const ComplexArray&) = default;
+    ComplexArray& operator=(ComplexArray&&) = default;
+
+    // d = a + b * c; d must already have the size of the expression
+    template <typename E>
+    ComplexArray& operator=(const ComplexExpr<E>& expr) {
+        complex_detail::checkSizes(size(), expr.size());
+        assign(expr.self());
+        return *this;
+    }
+
+    template <typename E>
+    ComplexArray& operator+=(const ComplexExpr<E>& expr) {
+        return *this = complex_detail::Sum<ComplexArray, E, false>(*this, expr.self());
+    }
+
+    size_t size() const { return realParts.size(); }
+    bool empty() const { return realParts.empty(); }
+
+    void push_back(const Complex& value) {
+        realParts.push_back(value.getReal());
+        imagParts.push_back(value.getImag());
+    }
+
+    Complex operator[](size_t index) const { return Complex(realParts[index], imagParts[index]); }
+
+    Complex at(size_t index) const {
+        if (index >= size()) throw std::out_of_range("ComplexArray index out of range");
+        return (*this)[index];
+    }
+
+    void set(size_t index, const Complex& value) {
+        realParts[index] = value.getReal();
+        imagParts[index] = value.getImag();
+    }
+
+    // The two lanes, for kernels of your own
+    double* realData() { return realParts.data(); }
+    const double* realData() const { return realParts.data(); }
+    double* imagData() { return imagParts.data(); }
+    const double* imagData() const { return imagParts.data(); }
+
+    complex_detail::Lanes lanes(size_t first, size_t, complex_detail::Buffer*, double*, double*) const {
+        return complex_detail::Lanes{realParts.data() + first, imagParts.data() + first};
+    }
+};
+
+template <typename L, typename R>
+complex_detail::Sum<L, R, false> operator+(const ComplexExpr<L>& left, const ComplexExpr<R>& right) {
+    return complex_detail::Sum<L, R, false>(left.self(), right.self());
+}
+
+template <typename L, typename R>
+complex_detail::Sum<L, R, true> operator-(const ComplexExpr<L>& left, const ComplexExpr<R>& right) {
+    return complex_detail::Sum<L, R, true>(left.self(), right.self());
+}
+
+template <typename L, typename R>
+complex_detail::Product<L, R> operator*(const ComplexExpr<L>& left, const ComplexExpr<R>& right) {
+    return complex_detail::Product<L, R>(left.self(), right.self());
+}
+
+// Every element times the same Complex
+template <typename E>
+complex_detail::Product<E, complex_detail::Broadcast> operator*(const ComplexExpr<E>& left, const Complex& right) {
+    return complex_detail::Product<E, complex_detail::Broadcast>(left.self(), complex_detail::Broadcast(right, left.size()));
+}
+
+template <typename E>
+complex_detail::Product<complex_detail::Broadcast, E> operator*(const Complex& left, const ComplexExpr<E>& right) {
+    return complex_detail::Product<complex_detail::Broadcast, E>(complex_detail::Broadcast(left, right.size()), right.self());
+}
+
+#endif // COMPLEX_ARRAY_H
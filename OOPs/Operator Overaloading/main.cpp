@@ -1,5 +1,7 @@
 #include <iostream>
 #include <cstring>
+#include "Complex.h"
+#include "ComplexArray.h"
 
 using namespace std;
 
@@ -41,95 +43,14 @@ using namespace std;
             - You need to access private or protected members of other classes.
             - The operator’s functionality is more intuitive when defined outside the class.
 
-*/
+    4. **Operators That Build Expressions (Expression Templates):**
+        - `Complex` (Complex.h) returns a new value from every `+` and `*`. Over whole arrays that
+          means one temporary array per operator: `a + b * c` writes `b * c` out and reads it back.
+        - `ComplexArray` (ComplexArray.h) overloads the same operators to return a description of
+          the computation instead. Assigning it to an array runs the whole expression in one
+          pass, with SIMD kernels on separate real and imaginary lanes.
 
-class Complex
-{
-private:
-    double real; // Real part
-    double imag; // Imaginary part
-
-public:
-    // Constructor
-    Complex(double r = 0.0, double i = 0.0) : real(r), imag(i) {}
-
-    void display()
-    {
-        cout << *this << endl;
-    }
-
-    // Arithmetic Operator (Member Function)
-    Complex operator+(const Complex &other) const
-    {
-        return Complex(real + other.real, imag + other.imag); // Addition
-    }
-
-    // Relational Operator (Member Function)
-    bool operator==(const Complex &other) const
-    {
-        return (real == other.real && imag == other.imag); // Equality
-    }
-
-    // Assignment Operator (Member Function)
-    Complex& operator=(const Complex &other)
-    {
-        if (this != &other)
-        {
-            real = other.real; // Assignment
-            imag = other.imag;
-        }
-        return *this;
-    }
-
-    // Increment Operator (Member Function)
-    Complex& operator++()
-    { // Prefix Increment
-        ++real;
-        return *this;
-    }
-
-    // Function Call Operator (Member Function)
-    double operator()(int index)
-    {
-        if (index == 0)
-            return real; // Return real part
-        else if (index == 1)
-            return imag;                          // Return imaginary part
-        throw out_of_range("Index out of range"); // Handle invalid index
-    }
-
-    // Pointer Dereference Operator (Member Function)
-    double& operator*()
-    {
-        return real; // Dereference to real part
-    }
-
-    // Pointer Member Operator (Non-Member Function)
-    Complex* operator->()
-    {
-        return this; // Pointer to real part
-    }
-
-    // Logical Operator (Non-Member Function)
-    friend bool operator&&(const Complex& c1, const Complex& c2)
-    {
-        return (c1.real != 0 && c1.imag != 0) && (c2.real != 0 && c2.imag != 0); // Logical AND
-    }
-
-    // Input Operator (Non-Member Function)
-    friend istream& operator>>(istream& is, Complex& c)
-    {
-        is >> c.real >> c.imag; // Input
-        return is;
-    }
-
-    // Output Operator (Non-Member Function)
-    friend ostream& operator<<(ostream& os, const Complex& c)
-    {
-        os << c.real << (c.imag >= 0 ? "+" : "") << c.imag << "i"; // Output
-        return os;
-    }
-};
+*/
 
 int main()
 {
@@ -140,6 +61,13 @@ int main()
     Complex c3 = c1 + c2;
     cout << "c1 + c2 = " << c3 << endl;
 
+    // Testing Arithmetic Operator on whole arrays (evaluated in one pass)
+    ComplexArray a = {Complex(1, 1), Complex(2, 0), Complex(0, 3)};
+    ComplexArray b = {Complex(1, 0), Complex(0, 1), Complex(2, 2)};
+    ComplexArray d = a + b * a;
+    for (size_t i = 0; i < d.size(); ++i)
+        cout << "a[" << i << "] + b[" << i << "] * a[" << i << "] = " << d[i] << endl;
+
     // Testing Logical Operator
     cout << "c1 && c2: " << (c1 && c2) << endl; // Logical AND
 
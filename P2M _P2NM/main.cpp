@@ -35,6 +35,12 @@
  * | Inline Usage          | Not possible                         | Directly definable inline        |
  * | Type Safety           | Basic type checking                  | Stronger type inference and safety |
  * 
+ * 5. **Cost of the Indirect Call**:
+ *    - A call through a function or member-function pointer can't be inlined, and when the target
+ *      changes from call to call (a table of handlers indexed by message kind) the CPU mispredicts
+ *      it. OOPs/Function Overriding/benchmark.cpp compares pointer tables with virtual calls,
+ *      std::variant and CRTP for exactly that use.
+ * 
  * Examples:
  *    - Pointer to non-member function
  *    - Pointer to member function
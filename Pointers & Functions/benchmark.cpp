@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../STL/Algorithms/ParallelAlgorithms.h"
+
+using namespace std;
+
+/*
+Benchmark: the findMaxElement and processLargeArray loops over big int arrays
+
+- 64M ints (256 MB) by default; pass the number of millions as the first argument
+  (e.g. `./benchmark 256` for 1 GB).
+- Each kernel runs as the original scalar loop from main.cpp, as the SIMD kernel forced to
+  its scalar version, as the SIMD kernel (AVX2 / NEON, picked at run time), and split over
+  a TaskPool with one worker per hardware thread. Values are GB/s, best of 5 runs.
+- At this size both kernels are limited by memory bandwidth, not by the CPU: the SIMD
+  version mostly pays off when the data is in cache, and the parallel one when a single core
+  can't use all the bandwidth (on most servers it can't).
+
+Build: g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+*/
+
+static volatile int64_t sink; // Keeps the optimizer from deleting the work
+
+template <typename Func>
+double bestGBs(size_t bytes, Func&& func) {
+    double best = 1e300;
+    for (int run = 0; run < 5; ++run) {
+        auto start = chrono::steady_clock::now();
+        func();
+        auto end = chrono::steady_clock::now();
+        best = min(best, chrono::duration<double>(end - start).count());
+    }
+    return bytes / best / 1e9;
+}
+
+// The loop findMaxElement had
+static const int* scalarMax(const int* arr, size_t size) {
+    const int* maxElem = arr;
+    for (size_t i = 1; i < size; i++) {
+        if (arr[i] > *maxElem) maxElem = &arr[i];
+    }
+    return maxElem;
+}
+
+// The same read-only pass processLargeArray makes, written as a plain loop
+static simd::Summary scalarSummary(const int* arr, size_t size) {
+    simd::Summary summary;
+    for (size_t i = 0; i < size; i++) {
+        summary.sum += arr[i];
+        summary.min = min(summary.min, arr[i]);
+        summary.max = max(summary.max, arr[i]);
+    }
+    return summary;
+}
+
+template <typename Loop, typename Kernel, typename Parallel>
+void row(const char* name, size_t bytes, Loop&& loop, Kernel&& kernel, Parallel&& parallelVersion) {
+    double loopGBs = bestGBs(bytes, loop);
+    simd::useScalar(true);
+    double scalarGBs = bestGBs(bytes, kernel);
+    simd::useScalar(false);
+    double simdGBs = bestGBs(bytes, kernel);
+    double parallelGBs = bestGBs(bytes, parallelVersion);
+    cout << "  " << name << ": loop " << loopGBs << ", kernel scalar " << scalarGBs << ", kernel "
+         << simd::levelName(simd::activeLevel()) << " " << simdGBs << ", parallel " << parallelGBs << " GB/s" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = (argc > 1 ? strtoull(argv[1], nullptr, 10) : 64) << 20;
+    vector<int> data(count);
+    mt19937 random(7);
+    for (int& value : data) value = static_cast<int>(random());
+    TaskPool pool;
+    size_t bytes = count * sizeof(int);
+    cout << count << " ints, " << pool.threadCount() << " threads" << endl;
+
+    const int* first = data.data();
+    const int* last = first + count;
+    row("findMaxElement   ", bytes,
+        [&] { sink = *scalarMax(first, count); },
+        [&] { sink = first[simd::maxElement(first, count)]; },
+        [&] { sink = *parallel::max_element(pool, first, last); });
+    row("processLargeArray", bytes,
+        [&] { sink = scalarSummary(first, count).sum; },
+        [&] { sink = simd::summarize(first, count).sum; },
+        [&] { sink = parallel::summarize(pool, first, last).sum; });
+    return 0;
+}
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <string>
+#include "../Arrays & Strings/StringUtils.h"
+#include "../STL/Algorithms/ParallelAlgorithms.h"
 using namespace std;
 
 /*
@@ -33,10 +35,13 @@ Additional Notes about Concepts Used:
 1. Pointers:
    - Pointers are variables that hold memory addresses. They are useful for dynamically managing memory and manipulating data.
    - In this code, we use pointers to find the maximum element in an array and perform operations on it.
+   - findMaxElement still returns a pointer into the array, but finds the element with simd::maxElement (8 lanes
+     at a time with AVX2, 4 with NEON); arrays of millions of elements are also split over all cores.
 
 2. References:
    - References allow you to create an alias for an existing variable, enabling direct manipulation without copying the variable.
    - The function reverseString demonstrates how to modify a string by passing it as a reference.
+     It hands the string's buffer to string_utils::reverse, which reverses it in place without a copy.
 
 3. Returning References:
    - Functions can return references, enabling modification of the original variable from the caller's context.
@@ -45,6 +50,7 @@ Additional Notes about Concepts Used:
 4. Const References:
    - Using const references helps prevent modification of the argument while still allowing efficient access to the data.
    - The processLargeArray function uses const reference for a large array to avoid unnecessary copying.
+     It reads the array once to get its sum, minimum and maximum (simd::summarize, in parallel for big arrays).
 
 5. Inline Functions:
    - Inline functions are suggested to the compiler for optimization by replacing calls with the actual function code.
@@ -59,6 +65,14 @@ Additional Notes about Concepts Used:
    - The complexSwap function showcases how to swap two values using pointers and arithmetic operations.
 */
 
+// Arrays at least this big are split over every core (see STL/Algorithms/ParallelAlgorithms.h)
+const int parallelThreshold = 1 << 22;
+
+TaskPool& sharedPool() {
+    static TaskPool pool; // One worker per hardware thread, started on first use
+    return pool;
+}
+
 // Function Declarations
 int* findMaxElement(int* arr, int size);
 void reverseString(string &str);
@@ -148,26 +162,15 @@ int main() {
 // 1. Pointers - Find the maximum element in an array using a pointer
 int* findMaxElement(int* arr, int size) {
     if (size <= 0) return nullptr;
-    int* maxElem = arr; // Pointer to the first element
-    for (int i = 1; i < size; i++) {
-        if (arr[i] > *maxElem) {
-            maxElem = &arr[i]; // Update maxElem to point to the new maximum
-        }
+    if (size >= parallelThreshold) {
+        return parallel::max_element(sharedPool(), arr, arr + size);
     }
-    return maxElem;
+    return arr + simd::maxElement(arr, size); // Pointer to the first largest element
 }
 
 // 2. Reverse a string using a reference
 void reverseString(string &str) {
-    int left = 0;
-    int right = str.length() - 1;
-    while (left < right) {
-        char temp = str[left];
-        str[left] = str[right];
-        str[right] = temp;
-        left++;
-        right--;
-    }
+    string_utils::reverse(str); // Swaps 32-byte blocks from both ends instead of one byte pair at a time
 }
 
 
@@ -185,11 +188,16 @@ int& accessElement(int arr[], int size, int index) {
 
 // 4. Using const reference for large data
 void processLargeArray(const int arr[], int size) {
+    if (size <= 0) return;
+    simd::Summary summary = size >= parallelThreshold ? parallel::summarize(sharedPool(), arr, arr + size)
+                                                      : simd::summarize(arr, size);
     cout << "\nProcessing large array (const reference passed): ";
-    for (int i = 0; i < size; i++) {
-        cout << arr[i] << " "; // Accessing elements safely without modification
+    if (size <= 32) {
+        for (int i = 0; i < size; i++) {
+            cout << arr[i] << " "; // Accessing elements safely without modification
+        }
     }
-    cout << endl;
+    cout << "\nSum: " << summary.sum << ", min: " << summary.min << ", max: " << summary.max << endl;
 }
 
 // 5. Inline function for complex calculations (calculating area of a circle)
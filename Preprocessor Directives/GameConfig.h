@@ -0,0 +1,124 @@
+#ifndef GAME_CONFIG_H
+#define GAME_CONFIG_H
+
+#include <array>
+#include <cstddef> // For size_t
+#include <iostream>
+#include <stdexcept> // For std::out_of_range
+
+/*
+Notes about typed compile-time configuration:
+
+1. **Why Not Macros**:
+   - `#if difficulty == 2` is evaluated by the preprocessor, which knows nothing about the
+     variable `int difficulty`: an identifier that isn't a macro becomes 0, so the test is
+     `0 == 2` and the #else branch is always compiled, without a warning.
+   - `#undef MAX_HEALTH` / `#define MAX_HEALTH 150` changes the value for the rest of the
+     file, including code that meant the old one, and the macro has no type and no scope.
+
+2. **constexpr Values and Tables**:
+   - Limits are `static constexpr` members of a configuration type, with their types, in
+     a namespace. difficultyTable is computed by a constexpr function while compiling: the
+     program contains the finished table, and static_asserts check it before anything runs.
+   - The same table answers run-time questions (settingsFor(difficulty) with an int read at
+     run time) with an array lookup, and throws std::out_of_range for an unknown level.
+
+3. **Toggles as Template Parameters**:
+   - GameConfig<Difficulty, Debug> chooses at compile time. Code that takes the
+     configuration as a template parameter tests `if constexpr (Config::debug)`: the
+     disabled branch is discarded, but still has to be valid C++, so it can't rot
+     unnoticed the way an #ifdef'd block can.
+   - debugLog<Config>(...) compiles to nothing when debug is off. Its arguments are still
+     evaluated (like any function call's); put anything expensive inside debugOnly<Config>(f),
+     whose lambda isn't even called.
+   - The build's NDEBUG is read once, into the constexpr bool `debugBuild`; nothing else
+     looks at a macro.
+*/
+
+namespace game_config {
+
+#ifdef NDEBUG
+inline constexpr bool debugBuild = false;
+#else
+inline constexpr bool debugBuild = true;
+#endif
+
+enum class Difficulty { Easy = 1, Normal = 2, Hard = 3 };
+
+inline constexpr int difficultyCount = 3;
+
+struct DifficultySettings {
+    Difficulty difficulty;
+    const char* name;
+    int maxHealth; // The player's health cap
+    int bossHealth;
+    int damagePercent; // Damage taken, in percent of the base damage
+};
+
+namespace detail {
+
+// Each level: 25 less health for the player, 50 more for the boss, 25% more damage taken
+constexpr std::array<DifficultySettings, difficultyCount> makeDifficultyTable() {
+    constexpr const char* names[difficultyCount] = {"Easy", "Normal", "Hard"};
+    std::array<DifficultySettings, difficultyCount> table{};
+    for (int level = 1; level <= difficultyCount; ++level) {
+        DifficultySettings& settings = table[static_cast<size_t>(level - 1)];
+        settings.difficulty = static_cast<Difficulty>(level);
+        settings.name = names[level - 1];
+        settings.maxHealth = 125 - 25 * (level - 1);
+        settings.bossHealth = 100 + 50 * (level - 1);
+        settings.damagePercent = 75 + 25 * (level - 1);
+    }
+    return table;
+}
+
+} // namespace detail
+
+// Built by the compiler; indexed by level - 1
+inline constexpr std::array<DifficultySettings, difficultyCount> difficultyTable = detail::makeDifficultyTable();
+
+static_assert(difficultyTable[1].maxHealth == 100 && difficultyTable[1].bossHealth == 150,
+              "Normal keeps the demo's original limits");
+static_assert(difficultyTable[0].maxHealth > difficultyTable[difficultyCount - 1].maxHealth,
+              "harder levels give the player less health");
+
+constexpr const DifficultySettings& settingsFor(Difficulty difficulty) {
+    return difficultyTable[static_cast<size_t>(difficulty) - 1];
+}
+
+// For a level only known at run time (read from input, a save file, ...)
+inline const DifficultySettings& settingsFor(int level) {
+    if (level < 1 || level > difficultyCount) throw std::out_of_range("settingsFor: no such difficulty level");
+    return difficultyTable[static_cast<size_t>(level - 1)];
+}
+
+template <Difficulty Level, bool Debug = debugBuild>
+struct GameConfig {
+    static constexpr Difficulty difficulty = Level;
+    static constexpr bool debug = Debug;
+    static constexpr const DifficultySettings& settings = settingsFor(Level);
+    static constexpr int maxHealth = settings.maxHealth;
+    static constexpr int bossHealth = settings.bossHealth;
+
+    // Damage after the level's scaling, computed at compile time for constant arguments
+    static constexpr int scaledDamage(int baseDamage) { return baseDamage * settings.damagePercent / 100; }
+};
+
+// Prints "[DEBUG] " and args when Config::debug; otherwise an empty inline function
+template <typename Config, typename... Args>
+void debugLog(const Args&... args) {
+    if constexpr (Config::debug) {
+        std::cout << "[DEBUG] ";
+        (std::cout << ... << args) << std::endl;
+    }
+}
+
+// Calls func() only when Config::debug, for instrumentation too costly to even evaluate otherwise
+template <typename Config, typename Func>
+void debugOnly(Func&& func) {
+    if constexpr (Config::debug) func();
+}
+
+} // namespace game_config
+
+#endif // GAME_CONFIG_H
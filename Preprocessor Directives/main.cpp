@@ -24,20 +24,45 @@
  *    - `__FILE__`: Contains the name of the current source file.
  *    - `__LINE__`: Contains the current line number in the source file.
  *
+ * 5. **Typed Configuration Instead of Macro Toggles**
+ *    - Macros have no type or scope and the preprocessor can't see variables: `#if difficulty == 2`
+ *      with a variable named difficulty compares 0 == 2. GameConfig.h keeps limits and feature
+ *      flags as constexpr values and template parameters, with lookup tables built at compile time.
+ *
  * This example illustrates these directives with practical use cases.
  */
 
 
+#include <algorithm> // For std::min
 #include <iostream>
 #include <string>
+#include "../Arrays & Strings/StringUtils.h"
+#include "GameConfig.h"
 
 // Practical usage of preprocessor directives in C++
 // Shows how they can be used dynamically and practically within the code
 
+// The configuration is a template parameter: each GameConfig gets its own copy of this function,
+// with the debug lines either compiled in or discarded
+template <typename Config>
+void startGame(const std::string& playerName, int playerHealth) {
+    int health = std::min(playerHealth, Config::maxHealth); // Capped by the level
+    std::cout << game_config::settingsFor(Config::difficulty).name << " mode: health " << health << " out of "
+              << Config::maxHealth << ", boss health " << Config::bossHealth << std::endl;
+    game_config::debugLog<Config>("Player name: ", playerName);
+    game_config::debugLog<Config>("A hit of 20 does ", Config::scaledDamage(20));
+    game_config::debugOnly<Config>([&] {
+        for (const game_config::DifficultySettings& level : game_config::difficultyTable) {
+            std::cout << "[DEBUG] " << level.name << ": max health " << level.maxHealth << std::endl;
+        }
+    });
+}
+
 int main() {
     // 1. #define - Defining Constants and Macros locally within the code context
     #define MAX_HEALTH 100
-    #define GREETING(name) ("Hello, " + name + "! Welcome to the game.")
+    // concat sizes the result once; "Hello, " + name + "..." would allocate a temporary per +
+    #define GREETING(name) (string_utils::concat("Hello, ", name, "! Welcome to the game."))
 
     std::string playerName = "Hero";
     std::cout << GREETING(playerName) << std::endl; // Using the macro to greet the player
@@ -72,15 +97,27 @@ int main() {
     std::cout << "Current line number: " << __LINE__ << std::endl;
 
     // 5. Conditional Compilation using #if, #elif, and #else
-    int difficulty = 2; // Adjust difficulty level
+    // #if only sees macros: it works with a macro like GAME_DIFFICULTY, not with a variable
+    #define GAME_DIFFICULTY 2 // Adjust difficulty level
 
-    #if difficulty == 1
+    #if GAME_DIFFICULTY == 1
         std::cout << "Easy mode activated." << std::endl;
-    #elif difficulty == 2
+    #elif GAME_DIFFICULTY == 2
         std::cout << "Normal mode activated." << std::endl;
     #else
         std::cout << "Hard mode activated." << std::endl;
     #endif
 
+    // A run-time level is looked up in the table the compiler built (no preprocessor involved)
+    int difficulty = 2; // Adjust difficulty level
+    std::cout << game_config::settingsFor(difficulty).name << " mode activated." << std::endl;
+
+    // 6. Typed compile-time configuration: limits and toggles are constexpr, per GameConfig type
+    using NormalGame = game_config::GameConfig<game_config::Difficulty::Normal, true>; // Debug lines on
+    using HardGame = game_config::GameConfig<game_config::Difficulty::Hard, false>; // Debug lines compiled out
+    static_assert(NormalGame::maxHealth == 100 && HardGame::bossHealth == 200, "checked while compiling");
+    startGame<NormalGame>(playerName, playerHealth);
+    startGame<HardGame>(playerName, playerHealth);
+
     return 0;
 }
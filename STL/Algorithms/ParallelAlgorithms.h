@@ -0,0 +1,460 @@
+#ifndef PARALLEL_ALGORITHMS_H
+#define PARALLEL_ALGORITHMS_H
+
+#include <algorithm> // For std::sort, std::merge, std::max_element, std::min, std::max
+#include <atomic>
+#include <cstddef> // For size_t
+#include <functional> // For std::plus, std::less
+#include <iterator> // For std::make_move_iterator
+#include <memory> // For std::addressof, std::make_shared
+#include <type_traits>
+#include <utility> // For std::pair, std::move
+#include <vector>
+#include "../../Concurrency/TaskPool.h"
+#include "SimdKernels.h"
+#include "SortKernels.h"
+
+/*
+Notes about the parallel algorithms:
+
+1. **Shape**:
+   - sort, reduce, transform, find, find_if, count, count_if, max_element and inclusive_scan
+     (plus summarize: sum, min and max of an int array), each taking
+     the TaskPool to run on and either a pointer range (first, last) or a whole container:
+     std::vector, SimpleVector, std::array or anything else that stores its elements in one
+     contiguous block. Container versions of find return the container's iterator.
+   - Inputs below a few tens of thousands of elements (or a pool with one worker) just run
+     the sequential loop: splitting them would cost more than it saves.
+
+2. **SIMD Inside Every Chunk**:
+   - For int and float, reduce (with std::plus), find, count and inclusive_scan (with
+     std::plus) run the SimdKernels.h loops on each chunk: AVX2 or NEON when the CPU has it,
+     the scalar loop otherwise, picked at run time. So do max_element on int with the default
+     comparison and summarize.
+   - transform and the *_if versions call a user function per element; the plain loop they
+     run is what the compiler vectorizes when that function is simple enough.
+
+3. **Sort**:
+   - A parallel merge sort: the range is cut into a power-of-two number of runs that are
+     std::sort-ed in parallel, then merged pairwise round by round. Each merge is itself split
+     into independent pieces with a "merge path" binary search, so the last rounds (one or
+     two huge merges) still keep every worker busy. Not stable, like std::sort.
+   - int with the default comparison merges with the AVX2 kernel of SortKernels.h.
+
+4. **Order of Operations**:
+   - reduce and inclusive_scan combine chunks left to right, so op only has to be associative
+     (not commutative); for float the result can still differ from a sequential loop in the
+     last bits, because the additions are grouped differently.
+   - int sums with std::plus wrap around on overflow, chunk totals included (they are added
+     as unsigned, like inside the kernels). With another op, or accumulating into a wider U,
+     overflow is the op's business.
+   - find returns the *first* match: chunks after an earlier match stop early, chunks before
+     it keep searching.
+*/
+
+namespace parallel {
+
+namespace detail {
+
+constexpr size_t sequentialCutoff = 1 << 15; // Below this, don't bother splitting
+constexpr size_t findBlock = 1 << 14; // find/find_if check for an earlier match this often
+
+// Pieces for count elements: a few per worker, none smaller than minimum
+inline size_t pieceCount(const TaskPool& pool, size_t count, size_t minimum = sequentialCutoff / 4) {
+    size_t pieces = pool.threadCount() * 4;
+    return std::max<size_t>(1, std::min(pieces, count / minimum));
+}
+
+inline bool runSequentially(const TaskPool& pool, size_t count) {
+    return pool.threadCount() <= 1 || count < sequentialCutoff;
+}
+
+// [begin(), end()) of a contiguous container as pointers
+template <typename Container>
+auto pointers(Container& container) {
+    auto* first = container.begin() == container.end() ? nullptr : std::addressof(*container.begin());
+    return std::make_pair(first, first + (container.end() - container.begin()));
+}
+
+template <typename Container>
+using EnableIfContainer = decltype(std::declval<Container&>().begin(), std::declval<Container&>().end());
+
+template <typename T, typename Op>
+constexpr bool simdPlus = simd::supported<std::remove_const_t<T>> &&
+                          (std::is_same<Op, std::plus<>>::value || std::is_same<Op, std::plus<std::remove_const_t<T>>>::value);
+
+// op(a, b), except that int sums of the SIMD path wrap around like the kernels' (see SimdKernels.h)
+template <typename T, typename U, typename Op>
+U combine(const U& a, const U& b, Op& op) {
+    if constexpr (simdPlus<T, Op> && std::is_same<U, std::remove_const_t<T>>::value && std::is_integral<U>::value) {
+        using Unsigned = std::make_unsigned_t<U>;
+        return static_cast<U>(static_cast<Unsigned>(a) + static_cast<Unsigned>(b));
+    } else {
+        return op(a, b);
+    }
+}
+
+// op-fold of a non-empty range, accumulated as U
+template <typename U, typename T, typename Op>
+U foldChunk(const T* first, const T* last, Op& op) {
+    if constexpr (simdPlus<T, Op> && std::is_same<U, std::remove_const_t<T>>::value) {
+        return simd::sum(first, static_cast<size_t>(last - first));
+    } else {
+        U result = static_cast<U>(*first);
+        for (++first; first != last; ++first) result = op(result, *first);
+        return result;
+    }
+}
+
+// Scan [first, last) into out, starting from carry if there is one; returns the last value
+template <typename T, typename Op>
+T scanChunk(const T* first, const T* last, T* out, const T* carry, Op& op) {
+    if constexpr (simdPlus<T, Op>) {
+        return simd::inclusiveScan(first, out, static_cast<size_t>(last - first), carry ? *carry : T());
+    } else {
+        T running = carry ? op(*carry, *first) : *first;
+        *out = running;
+        for (++first, ++out; first != last; ++first, ++out) {
+            running = op(running, *first);
+            *out = running;
+        }
+        return running;
+    }
+}
+
+// Where the first `diagonal` elements of merge(a, b) split between a and b: the number taken from a
+template <typename T, typename Compare>
+size_t mergePath(const T* a, size_t aCount, const T* b, size_t bCount, size_t diagonal, Compare& comp) {
+    size_t low = diagonal > bCount ? diagonal - bCount : 0;
+    size_t high = std::min(diagonal, aCount);
+    while (low < high) {
+        size_t i = low + (high - low) / 2;
+        size_t j = diagonal - i;
+        if (j > 0 && i < aCount && !comp(b[j - 1], a[i])) {
+            low = i + 1; // a[i] goes out before b[j - 1], so more of a is in this prefix
+        } else {
+            high = i;
+        }
+    }
+    return low;
+}
+
+// Merge runs [first, middle) and [middle, last) of source into target (same offsets), in pieces.
+// All split points are found before any piece starts moving elements out of source.
+template <typename T, typename Compare>
+void mergeRuns(TaskGroup& group, T* source, T* target, size_t first, size_t middle, size_t last, size_t pieces, Compare& comp) {
+    const T* a = source + first;
+    const T* b = source + middle;
+    size_t aCount = middle - first, bCount = last - middle, total = last - first;
+    auto splits = std::make_shared<std::vector<size_t>>(pieces + 1); // Elements taken from a before each piece
+    for (size_t piece = 0; piece <= pieces; ++piece) {
+        (*splits)[piece] = mergePath(a, aCount, b, bCount, total * piece / pieces, comp);
+    }
+    for (size_t piece = 0; piece < pieces; ++piece) {
+        group.run([=, &comp] {
+            size_t from = total * piece / pieces, to = total * (piece + 1) / pieces;
+            size_t aFrom = (*splits)[piece], aTo = (*splits)[piece + 1];
+            if constexpr (std::is_same<T, int>::value && (std::is_same<Compare, std::less<>>::value ||
+                                                          std::is_same<Compare, std::less<int>>::value)) {
+                simd::merge(source + first + aFrom, aTo - aFrom, source + middle + (from - aFrom), (to - from) - (aTo - aFrom),
+                            target + first + from); // Vectorized merge (SortKernels.h)
+                return;
+            }
+            std::merge(std::make_move_iterator(source + first + aFrom), std::make_move_iterator(source + first + aTo),
+                       std::make_move_iterator(source + middle + (from - aFrom)),
+                       std::make_move_iterator(source + middle + (to - aTo)), target + first + from, comp);
+        });
+    }
+}
+
+// Index of the first match in [0, count): search(from, to) scans one block and returns to if it has none
+template <typename Search>
+size_t firstMatch(TaskPool& pool, size_t count, Search search) {
+    if (runSequentially(pool, count)) {
+        return search(0, count);
+    }
+    std::atomic<size_t> found(count);
+    size_t blocks = (count + findBlock - 1) / findBlock;
+    pool.parallel_for(0, blocks, [&](size_t block) {
+        size_t from = block * findBlock, to = std::min(count, from + findBlock);
+        if (found.load(std::memory_order_relaxed) <= from) return; // An earlier match exists
+        size_t index = search(from, to);
+        if (index == to) return;
+        size_t best = found.load(std::memory_order_relaxed);
+        while (index < best && !found.compare_exchange_weak(best, index, std::memory_order_relaxed)) {
+        }
+    });
+    return found.load();
+}
+
+} // namespace detail
+
+template <typename T, typename Compare = std::less<>>
+void sort(TaskPool& pool, T* first, T* last, Compare comp = Compare()) {
+    size_t count = static_cast<size_t>(last - first);
+    if (!std::is_default_constructible<T>::value || detail::runSequentially(pool, count)) {
+        std::sort(first, last, comp); // (The merge buffer needs default-constructed slots)
+        return;
+    }
+    if constexpr (std::is_default_constructible<T>::value) {
+        size_t runs = 1;
+        while (runs < pool.threadCount() * 2 && count / (runs * 2) >= detail::sequentialCutoff / 4) runs *= 2;
+        auto bound = [&](size_t run) { return count * run / runs; };
+
+        pool.parallel_for(0, runs, [&](size_t run) { std::sort(first + bound(run), first + bound(run + 1), comp); }, 1);
+
+        std::vector<T> buffer(count);
+        T* source = first;
+        T* target = buffer.data();
+        for (size_t width = 1; width < runs; width *= 2) {
+            size_t merges = runs / (width * 2);
+            size_t pieces = std::max<size_t>(1, pool.threadCount() * 2 / merges);
+            TaskGroup group(pool);
+            for (size_t run = 0; run < runs; run += width * 2) {
+                detail::mergeRuns(group, source, target, bound(run), bound(run + width), bound(run + width * 2), pieces, comp);
+            }
+            group.wait();
+            std::swap(source, target);
+        }
+        if (source != first) {
+            pool.parallel_for(0, count, [&](size_t i) { first[i] = std::move(source[i]); });
+        }
+    }
+}
+
+// init op first[0] op first[1] op ..., accumulated as U; op must be associative
+template <typename T, typename U, typename Op = std::plus<>>
+U reduce(TaskPool& pool, const T* first, const T* last, U init, Op op = Op()) {
+    size_t count = static_cast<size_t>(last - first);
+    if (count == 0) return init;
+    size_t pieces = detail::runSequentially(pool, count) ? 1 : detail::pieceCount(pool, count);
+    std::vector<U> partial(pieces, init);
+    auto chunk = [&](size_t piece) {
+        partial[piece] = detail::foldChunk<U>(first + count * piece / pieces, first + count * (piece + 1) / pieces, op);
+    };
+    if (pieces == 1) {
+        chunk(0);
+    } else {
+        pool.parallel_for(0, pieces, chunk, 1);
+    }
+    for (const U& value : partial) init = detail::combine<T>(init, value, op);
+    return init;
+}
+
+// out[i] = func(first[i]); out may be first
+template <typename T, typename U, typename Func>
+U* transform(TaskPool& pool, const T* first, const T* last, U* out, Func func) {
+    size_t count = static_cast<size_t>(last - first);
+    size_t pieces = detail::runSequentially(pool, count) ? 1 : detail::pieceCount(pool, count);
+    auto chunk = [&](size_t piece) {
+        size_t from = count * piece / pieces, to = count * (piece + 1) / pieces;
+        for (size_t i = from; i < to; ++i) out[i] = func(first[i]);
+    };
+    if (pieces == 1) {
+        chunk(0);
+    } else {
+        pool.parallel_for(0, pieces, chunk, 1);
+    }
+    return out + count;
+}
+
+// First element for which pred is true, last if none
+template <typename T, typename Pred>
+T* find_if(TaskPool& pool, T* first, T* last, Pred pred) {
+    return first + detail::firstMatch(pool, static_cast<size_t>(last - first), [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i) {
+            if (pred(first[i])) return i;
+        }
+        return to;
+    });
+}
+
+template <typename T>
+T* find(TaskPool& pool, T* first, T* last, const std::remove_const_t<T>& value) {
+    using Value = std::remove_const_t<T>;
+    if constexpr (simd::supported<Value>) {
+        return first + detail::firstMatch(pool, static_cast<size_t>(last - first), [&](size_t from, size_t to) {
+            return from + simd::find<Value>(first + from, to - from, value);
+        });
+    } else {
+        return find_if(pool, first, last, [&value](const Value& element) { return element == value; });
+    }
+}
+
+template <typename T, typename Pred>
+size_t count_if(TaskPool& pool, const T* first, const T* last, Pred pred) {
+    size_t count = static_cast<size_t>(last - first);
+    size_t pieces = detail::runSequentially(pool, count) ? 1 : detail::pieceCount(pool, count);
+    std::vector<size_t> partial(pieces, 0);
+    auto chunk = [&](size_t piece) {
+        size_t matches = 0;
+        for (size_t i = count * piece / pieces, to = count * (piece + 1) / pieces; i < to; ++i) {
+            matches += pred(first[i]) ? 1 : 0;
+        }
+        partial[piece] = matches;
+    };
+    if (pieces == 1) {
+        chunk(0);
+    } else {
+        pool.parallel_for(0, pieces, chunk, 1);
+    }
+    size_t total = 0;
+    for (size_t matches : partial) total += matches;
+    return total;
+}
+
+template <typename T>
+size_t count(TaskPool& pool, const T* first, const T* last, const std::remove_const_t<T>& value) {
+    if constexpr (simd::supported<T>) {
+        size_t count = static_cast<size_t>(last - first);
+        size_t pieces = detail::runSequentially(pool, count) ? 1 : detail::pieceCount(pool, count);
+        std::vector<size_t> partial(pieces, 0);
+        auto chunk = [&](size_t piece) {
+            size_t from = count * piece / pieces, to = count * (piece + 1) / pieces;
+            partial[piece] = simd::count(first + from, to - from, value);
+        };
+        if (pieces == 1) {
+            chunk(0);
+        } else {
+            pool.parallel_for(0, pieces, chunk, 1);
+        }
+        size_t total = 0;
+        for (size_t matches : partial) total += matches;
+        return total;
+    } else {
+        return count_if(pool, first, last, [&value](const T& element) { return element == value; });
+    }
+}
+
+// First largest element (like std::max_element), last if the range is empty
+template <typename T, typename Compare = std::less<>>
+T* max_element(TaskPool& pool, T* first, T* last, Compare comp = Compare()) {
+    size_t count = static_cast<size_t>(last - first);
+    if (count == 0) return last;
+    size_t pieces = detail::runSequentially(pool, count) ? 1 : detail::pieceCount(pool, count);
+    std::vector<T*> partial(pieces);
+    auto chunk = [&](size_t piece) {
+        T* from = first + count * piece / pieces;
+        T* to = first + count * (piece + 1) / pieces;
+        if constexpr (std::is_same<std::remove_const_t<T>, int>::value &&
+                      (std::is_same<Compare, std::less<>>::value || std::is_same<Compare, std::less<int>>::value)) {
+            partial[piece] = from + simd::maxElement(from, static_cast<size_t>(to - from));
+        } else {
+            partial[piece] = std::max_element(from, to, comp);
+        }
+    };
+    if (pieces == 1) {
+        chunk(0);
+    } else {
+        pool.parallel_for(0, pieces, chunk, 1);
+    }
+    T* best = partial[0];
+    for (T* candidate : partial) {
+        if (comp(*best, *candidate)) best = candidate; // Strictly better only: ties stay with the earlier chunk
+    }
+    return best;
+}
+
+// Sum, min and max of an int array in one pass (see simd::summarize)
+inline simd::Summary summarize(TaskPool& pool, const int* first, const int* last) {
+    size_t count = static_cast<size_t>(last - first);
+    size_t pieces = detail::runSequentially(pool, count) ? 1 : detail::pieceCount(pool, count);
+    std::vector<simd::Summary> partial(pieces);
+    auto chunk = [&](size_t piece) {
+        size_t from = count * piece / pieces, to = count * (piece + 1) / pieces;
+        partial[piece] = simd::summarize(first + from, to - from);
+    };
+    if (pieces == 1) {
+        chunk(0);
+    } else {
+        pool.parallel_for(0, pieces, chunk, 1);
+    }
+    simd::Summary total;
+    for (const simd::Summary& summary : partial) total = simd::combine(total, summary);
+    return total;
+}
+
+// out[i] = first[0] op ... op first[i]; out may be first. Returns the end of out.
+template <typename T, typename Op = std::plus<>>
+T* inclusive_scan(TaskPool& pool, const T* first, const T* last, T* out, Op op = Op()) {
+    size_t count = static_cast<size_t>(last - first);
+    if (count == 0) return out;
+    if (detail::runSequentially(pool, count)) {
+        detail::scanChunk(first, last, out, static_cast<const T*>(nullptr), op);
+        return out + count;
+    }
+    // 1. Total of every chunk but the last, 2. carries = prefix of those, 3. scan the chunks with their carry
+    size_t pieces = detail::pieceCount(pool, count);
+    auto from = [&](size_t piece) { return count * piece / pieces; };
+    std::vector<T> carries(pieces, *first);
+    pool.parallel_for(0, pieces - 1, [&](size_t piece) {
+        carries[piece + 1] = detail::foldChunk<T>(first + from(piece), first + from(piece + 1), op);
+    }, 1);
+    for (size_t piece = 2; piece < pieces; ++piece) {
+        carries[piece] = detail::combine<T>(carries[piece - 1], carries[piece], op);
+    }
+    pool.parallel_for(0, pieces, [&](size_t piece) {
+        detail::scanChunk(first + from(piece), first + from(piece + 1), out + from(piece), piece == 0 ? nullptr : &carries[piece], op);
+    }, 1);
+    return out + count;
+}
+
+// Whole-container versions
+
+template <typename Container, typename Compare = std::less<>, typename = detail::EnableIfContainer<Container>>
+void sort(TaskPool& pool, Container& container, Compare comp = Compare()) {
+    auto range = detail::pointers(container);
+    sort(pool, range.first, range.second, comp);
+}
+
+template <typename Container, typename U, typename Op = std::plus<>, typename = detail::EnableIfContainer<const Container>>
+U reduce(TaskPool& pool, const Container& container, U init, Op op = Op()) {
+    auto range = detail::pointers(container);
+    return reduce(pool, range.first, range.second, init, op);
+}
+
+template <typename Container, typename Output, typename Func, typename = detail::EnableIfContainer<const Container>>
+void transform(TaskPool& pool, const Container& container, Output& output, Func func) {
+    auto range = detail::pointers(container);
+    transform(pool, range.first, range.second, detail::pointers(output).first, func);
+}
+
+template <typename Container, typename Pred, typename = detail::EnableIfContainer<Container>>
+auto find_if(TaskPool& pool, Container& container, Pred pred) {
+    auto range = detail::pointers(container);
+    return container.begin() + (find_if(pool, range.first, range.second, pred) - range.first);
+}
+
+template <typename Container, typename Value, typename = detail::EnableIfContainer<Container>>
+auto find(TaskPool& pool, Container& container, const Value& value) {
+    auto range = detail::pointers(container);
+    return container.begin() + (find(pool, range.first, range.second, value) - range.first);
+}
+
+template <typename Container, typename Pred, typename = detail::EnableIfContainer<const Container>>
+size_t count_if(TaskPool& pool, const Container& container, Pred pred) {
+    auto range = detail::pointers(container);
+    return count_if(pool, range.first, range.second, pred);
+}
+
+template <typename Container, typename Value, typename = detail::EnableIfContainer<const Container>>
+size_t count(TaskPool& pool, const Container& container, const Value& value) {
+    auto range = detail::pointers(container);
+    return count(pool, range.first, range.second, value);
+}
+
+template <typename Container, typename Compare = std::less<>, typename = detail::EnableIfContainer<Container>>
+auto max_element(TaskPool& pool, Container& container, Compare comp = Compare()) {
+    auto range = detail::pointers(container);
+    return container.begin() + (max_element(pool, range.first, range.second, comp) - range.first);
+}
+
+template <typename Container, typename Output, typename Op = std::plus<>, typename = detail::EnableIfContainer<const Container>>
+void inclusive_scan(TaskPool& pool, const Container& container, Output& output, Op op = Op()) {
+    auto range = detail::pointers(container);
+    inclusive_scan(pool, range.first, range.second, detail::pointers(output).first, op);
+}
+
+} // namespace parallel
+
+#endif // PARALLEL_ALGORITHMS_H
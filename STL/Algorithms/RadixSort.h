@@ -0,0 +1,220 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <algorithm> // For std::stable_sort, std::sort, std::is_sorted
+#include <cstddef> // For size_t
+#include <cstdint>
+#include <type_traits> // For std::make_unsigned_t, std::is_integral
+#include <utility> // For std::move, std::swap
+#include <vector>
+
+/*
+Notes about the radix sorts:
+
+1. **Why Radix**:
+   - A comparison sort does ~n log2(n) comparisons, each one a branch the CPU mispredicts
+     about half the time on random keys. A radix sort never compares two keys: for integer
+     keys it does a fixed number of counting passes over the data, one per byte of the key.
+
+2. **LSD (radix::sort, sortByKey, sortPairs)**:
+   - Least significant byte first. One pass over the data builds the histograms of all bytes
+     at once, then one scatter pass per byte from the input into a buffer and back. A byte
+     that is the same in every key (e.g. the top bytes of small IDs, or everything in a
+     few-distinct input) is skipped entirely, and so is an input that is already sorted.
+   - Stable: equal keys keep their order, which is what makes it right for key-value data.
+     Needs a buffer as big as the input.
+   - Signed keys are sorted by flipping their sign bit, so negatives come first.
+
+3. **MSD In Place (radix::sortInPlace)**:
+   - Most significant byte first ("American flag sort"): count the top byte, then swap every
+     element into its bucket along permutation cycles, then sort each bucket by the next
+     byte. No buffer, but not stable; buckets of fewer than 128 elements go to std::sort.
+
+4. **Keys**:
+   - Any integral type (int, uint32_t, int64_t, ...). sortByKey takes a keyOf function that
+     returns the key of a record, for example of a std::pair.
+*/
+
+namespace radix {
+
+namespace detail {
+
+// The key as an unsigned number that orders the same way
+template <typename Key>
+std::make_unsigned_t<Key> orderedBits(Key key) {
+    using Bits = std::make_unsigned_t<Key>;
+    Bits bits = static_cast<Bits>(key);
+    if constexpr (std::is_signed<Key>::value) {
+        bits ^= Bits(1) << (sizeof(Key) * 8 - 1);
+    }
+    return bits;
+}
+
+template <typename Key>
+unsigned byteOf(Key key, unsigned byte) {
+    return static_cast<unsigned>((orderedBits(key) >> (byte * 8)) & 0xFF);
+}
+
+constexpr size_t smallInput = 256; // Below this a comparison sort is faster
+
+// counts[byte][value] for every byte of every key, in one pass
+template <size_t KeyBytes, typename KeyAt>
+std::vector<size_t> histograms(size_t count, KeyAt keyAt) {
+    std::vector<size_t> counts(KeyBytes * 256, 0);
+    for (size_t i = 0; i < count; ++i) {
+        auto bits = orderedBits(keyAt(i));
+        for (unsigned byte = 0; byte < KeyBytes; ++byte) {
+            ++counts[byte * 256 + ((bits >> (byte * 8)) & 0xFF)];
+        }
+    }
+    return counts;
+}
+
+// Turns one byte's counts into starting offsets; false if every key has the same value there
+inline bool offsets(size_t* counts, size_t count) {
+    size_t total = 0;
+    for (unsigned value = 0; value < 256; ++value) {
+        if (counts[value] == count) return false;
+        size_t here = counts[value];
+        counts[value] = total;
+        total += here;
+    }
+    return true;
+}
+
+template <typename T, typename KeyOf>
+void msd(T* first, T* last, unsigned byte, KeyOf& keyOf) {
+    size_t count = static_cast<size_t>(last - first);
+    if (count < 128) {
+        std::sort(first, last, [&](const T& a, const T& b) { return orderedBits(keyOf(a)) < orderedBits(keyOf(b)); });
+        return;
+    }
+    size_t starts[256] = {}, ends[256];
+    for (size_t i = 0; i < count; ++i) ++starts[byteOf(keyOf(first[i]), byte)];
+    size_t total = 0;
+    for (unsigned value = 0; value < 256; ++value) {
+        size_t here = starts[value];
+        starts[value] = total;
+        total += here;
+        ends[value] = total;
+    }
+    size_t next[256];
+    std::copy(starts, starts + 256, next);
+    for (unsigned bucket = 0; bucket < 256; ++bucket) {
+        while (next[bucket] < ends[bucket]) {
+            T& slot = first[next[bucket]];
+            unsigned value = byteOf(keyOf(slot), byte);
+            while (value != bucket) { // Follow the cycle: swap the element to where it belongs
+                std::swap(slot, first[next[value]++]);
+                value = byteOf(keyOf(slot), byte);
+            }
+            ++next[bucket];
+        }
+    }
+    if (byte == 0) return;
+    for (unsigned bucket = 0; bucket < 256; ++bucket) {
+        if (ends[bucket] - starts[bucket] > 1) msd(first + starts[bucket], first + ends[bucket], byte - 1, keyOf);
+    }
+}
+
+struct Identity {
+    template <typename Key>
+    Key operator()(Key key) const { return key; }
+};
+
+} // namespace detail
+
+// Stable LSD sort of records by an integral key
+template <typename T, typename KeyOf>
+void sortByKey(T* first, T* last, KeyOf keyOf) {
+    using Key = std::decay_t<decltype(keyOf(*first))>;
+    static_assert(std::is_integral<Key>::value, "radix sort needs integral keys");
+    constexpr size_t keyBytes = sizeof(Key);
+    size_t count = static_cast<size_t>(last - first);
+    auto keyLess = [&](const T& a, const T& b) { return detail::orderedBits(keyOf(a)) < detail::orderedBits(keyOf(b)); };
+    if (count < detail::smallInput) {
+        std::stable_sort(first, last, keyLess);
+        return;
+    }
+    if (std::is_sorted(first, last, keyLess)) return; // One cheap pass saves all the scatter passes
+    std::vector<size_t> counts = detail::histograms<keyBytes>(count, [&](size_t i) { return keyOf(first[i]); });
+    std::vector<T> buffer(count);
+    T* source = first;
+    T* target = buffer.data();
+    for (unsigned byte = 0; byte < keyBytes; ++byte) {
+        size_t* offsets = &counts[byte * 256];
+        if (!detail::offsets(offsets, count)) continue; // Same byte everywhere: already in order
+        for (size_t i = 0; i < count; ++i) {
+            target[offsets[detail::byteOf(keyOf(source[i]), byte)]++] = std::move(source[i]);
+        }
+        std::swap(source, target);
+    }
+    if (source != first) std::move(source, source + count, first);
+}
+
+// Stable LSD sort of integral keys
+template <typename Key>
+void sort(Key* first, Key* last) {
+    sortByKey(first, last, detail::Identity());
+}
+
+// Stable LSD sort of keys[0, count), moving values[i] along with keys[i]
+template <typename Key, typename Value>
+void sortPairs(Key* keys, Value* values, size_t count) {
+    static_assert(std::is_integral<Key>::value, "radix sort needs integral keys");
+    constexpr size_t keyBytes = sizeof(Key);
+    if (count < detail::smallInput) {
+        std::vector<size_t> order(count);
+        for (size_t i = 0; i < count; ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return keys[a] < keys[b]; });
+        std::vector<Key> sortedKeys(count);
+        std::vector<Value> sortedValues(count);
+        for (size_t i = 0; i < count; ++i) {
+            sortedKeys[i] = keys[order[i]];
+            sortedValues[i] = std::move(values[order[i]]);
+        }
+        std::move(sortedKeys.begin(), sortedKeys.end(), keys);
+        std::move(sortedValues.begin(), sortedValues.end(), values);
+        return;
+    }
+    std::vector<size_t> counts = detail::histograms<keyBytes>(count, [&](size_t i) { return keys[i]; });
+    std::vector<Key> keyBuffer(count);
+    std::vector<Value> valueBuffer(count);
+    Key* sourceKeys = keys;
+    Key* targetKeys = keyBuffer.data();
+    Value* sourceValues = values;
+    Value* targetValues = valueBuffer.data();
+    for (unsigned byte = 0; byte < keyBytes; ++byte) {
+        size_t* offsets = &counts[byte * 256];
+        if (!detail::offsets(offsets, count)) continue;
+        for (size_t i = 0; i < count; ++i) {
+            size_t to = offsets[detail::byteOf(sourceKeys[i], byte)]++;
+            targetKeys[to] = sourceKeys[i];
+            targetValues[to] = std::move(sourceValues[i]);
+        }
+        std::swap(sourceKeys, targetKeys);
+        std::swap(sourceValues, targetValues);
+    }
+    if (sourceKeys != keys) {
+        std::move(sourceKeys, sourceKeys + count, keys);
+        std::move(sourceValues, sourceValues + count, values);
+    }
+}
+
+// In-place MSD sort of records by an integral key (not stable, no buffer)
+template <typename T, typename KeyOf>
+void sortInPlaceByKey(T* first, T* last, KeyOf keyOf) {
+    using Key = std::decay_t<decltype(keyOf(*first))>;
+    static_assert(std::is_integral<Key>::value, "radix sort needs integral keys");
+    detail::msd(first, last, sizeof(Key) - 1, keyOf);
+}
+
+template <typename Key>
+void sortInPlace(Key* first, Key* last) {
+    detail::Identity identity;
+    detail::msd(first, last, sizeof(Key) - 1, identity);
+}
+
+} // namespace radix
+
+#endif // RADIX_SORT_H
@@ -0,0 +1,617 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <cstddef> // For size_t
+#include <cstdint> // For uint32_t, int64_t, uintptr_t
+#include <limits>
+#include <type_traits> // For std::is_same
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h> // AVX2 intrinsics, compiled per function with target("avx2")
+#define SIMD_HAS_AVX2_DISPATCH 1
+#else
+#define SIMD_HAS_AVX2_DISPATCH 0
+#endif
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h> // NEON is part of every AArch64 CPU, no runtime check needed
+#define SIMD_HAS_NEON 1
+#else
+#define SIMD_HAS_NEON 0
+#endif
+
+/*
+Notes about the SIMD kernels:
+
+1. **What Is Here**:
+   - find, count (of one value), sum and inclusiveScan over a contiguous array of int or
+     float. These are the loops a compiler does not vectorize by itself: find and count
+     because of the early exit / the compare-to-counter conversion, sum and scan for float
+     because vectorizing changes the order of the additions (compilers only do that with
+     -ffast-math).
+   - maxElement (index of the first largest element) and summarize (64-bit sum, min and max
+     in one pass), for int only. maxElement keeps the best value *and* its index per lane, so
+     it is still a single pass; the lanes are merged at the end, ties going to the lower index.
+   - ParallelAlgorithms.h splits big arrays over a TaskPool and runs these on every chunk.
+
+2. **Runtime Dispatch**:
+   - On x86 the AVX2 versions are compiled with __attribute__((target("avx2"))), so the file
+     builds without -mavx2 and the binary still runs on CPUs without AVX2: every call checks
+     (once, cached) whether the CPU has it and otherwise takes the scalar loop.
+   - On ARM64 the NEON versions are always used. Elsewhere only the scalar loops exist.
+   - useScalar(true) forces the scalar loops, to compare the two (see benchmark.cpp).
+
+3. **Alignment**:
+   - maxElement and summarize handle the elements before the first 32-byte (NEON: 16-byte)
+     boundary with the scalar loop, then use aligned loads, then the scalar loop again for the
+     rest. The other kernels use unaligned loads, which cost the same on aligned data.
+
+4. **Results**:
+   - int sums wrap around on overflow, in both versions (the scalar loop adds as unsigned).
+   - float sums and scans add in a different order than a left-to-right loop (8 lanes, then
+     the lanes together), so the last bits can differ from the scalar result.
+*/
+
+namespace simd {
+
+template <typename T>
+constexpr bool supported = std::is_same<T, int>::value || std::is_same<T, float>::value;
+
+enum class Level { Scalar, Avx2, Neon };
+
+inline bool& forceScalar() {
+    static bool force = false;
+    return force;
+}
+
+// Use only the scalar loops (true) or the best the CPU has (false, the default)
+inline void useScalar(bool scalar) {
+    forceScalar() = scalar;
+}
+
+inline Level activeLevel() {
+    if (forceScalar()) return Level::Scalar;
+#if SIMD_HAS_AVX2_DISPATCH
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+    return hasAvx2 ? Level::Avx2 : Level::Scalar;
+#elif SIMD_HAS_NEON
+    return Level::Neon;
+#else
+    return Level::Scalar;
+#endif
+}
+
+// AVX2 with FMA as well, for kernels built with target("avx2,fma") (Matrix.h, ComplexArray.h).
+// Off whenever activeLevel() is, so useScalar(true) turns those kernels off too.
+inline bool hasAvx2Fma() {
+#if SIMD_HAS_AVX2_DISPATCH
+    static const bool hasFma = __builtin_cpu_supports("fma");
+    return hasFma && activeLevel() == Level::Avx2;
+#else
+    return false;
+#endif
+}
+
+inline const char* levelName(Level level) {
+    switch (level) {
+        case Level::Avx2: return "AVX2";
+        case Level::Neon: return "NEON";
+        default: return "scalar";
+    }
+}
+
+// What summarize returns; the sum can't overflow for fewer than 2^32 elements
+struct Summary {
+    int64_t sum = 0;
+    int min = std::numeric_limits<int>::max();
+    int max = std::numeric_limits<int>::min();
+};
+
+inline Summary combine(Summary a, const Summary& b) {
+    a.sum += b.sum;
+    a.min = b.min < a.min ? b.min : a.min;
+    a.max = b.max > a.max ? b.max : a.max;
+    return a;
+}
+
+// How many elements come before the first one aligned to `bytes` (at most count)
+inline size_t unalignedHead(const int* data, size_t count, size_t bytes) {
+    size_t misaligned = reinterpret_cast<uintptr_t>(data) % bytes;
+    size_t head = misaligned == 0 ? 0 : (bytes - misaligned) / sizeof(int);
+    return head < count ? head : count;
+}
+
+namespace scalar {
+
+template <typename T>
+size_t find(const T* data, size_t count, T value) {
+    for (size_t i = 0; i < count; ++i) {
+        if (data[i] == value) return i;
+    }
+    return count;
+}
+
+template <typename T>
+size_t count(const T* data, size_t count, T value) {
+    size_t matches = 0;
+    for (size_t i = 0; i < count; ++i) {
+        matches += data[i] == value;
+    }
+    return matches;
+}
+
+inline int sum(const int* data, size_t count) {
+    uint32_t total = 0; // Unsigned, so overflow wraps like the vector version instead of being undefined
+    for (size_t i = 0; i < count; ++i) {
+        total += static_cast<uint32_t>(data[i]);
+    }
+    return static_cast<int>(total);
+}
+
+inline float sum(const float* data, size_t count) {
+    float total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+// out[i] = carry + data[0] + ... + data[i]; returns the last one (carry if count is 0)
+inline int inclusiveScan(const int* data, int* out, size_t count, int carry) {
+    uint32_t running = static_cast<uint32_t>(carry);
+    for (size_t i = 0; i < count; ++i) {
+        running += static_cast<uint32_t>(data[i]);
+        out[i] = static_cast<int>(running);
+    }
+    return static_cast<int>(running);
+}
+
+inline float inclusiveScan(const float* data, float* out, size_t count, float carry) {
+    for (size_t i = 0; i < count; ++i) {
+        carry += data[i];
+        out[i] = carry;
+    }
+    return carry;
+}
+
+// Index of the first largest element; count > 0
+inline size_t maxElement(const int* data, size_t count) {
+    size_t best = 0;
+    int bestValue = data[0]; // In a register, instead of reloading data[best] every iteration
+    for (size_t i = 1; i < count; ++i) {
+        if (data[i] > bestValue) {
+            best = i;
+            bestValue = data[i];
+        }
+    }
+    return best;
+}
+
+inline Summary summarize(const int* data, size_t count) {
+    Summary summary;
+    for (size_t i = 0; i < count; ++i) {
+        summary.sum += data[i];
+        summary.min = data[i] < summary.min ? data[i] : summary.min;
+        summary.max = data[i] > summary.max ? data[i] : summary.max;
+    }
+    return summary;
+}
+
+} // namespace scalar
+
+#if SIMD_HAS_AVX2_DISPATCH
+namespace avx2 {
+
+#define SIMD_AVX2 __attribute__((target("avx2")))
+
+SIMD_AVX2 inline unsigned equalMask(__m256i block, __m256i value) {
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, value))));
+}
+
+SIMD_AVX2 inline unsigned equalMask(__m256 block, __m256 value) {
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(block, value, _CMP_EQ_OQ)));
+}
+
+SIMD_AVX2 inline __m256i load(const int* data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)); }
+SIMD_AVX2 inline __m256 load(const float* data) { return _mm256_loadu_ps(data); }
+SIMD_AVX2 inline __m256i broadcast(int value) { return _mm256_set1_epi32(value); }
+SIMD_AVX2 inline __m256 broadcast(float value) { return _mm256_set1_ps(value); }
+
+// 32 elements per iteration: four compares OR-ed together, one branch
+template <typename T>
+SIMD_AVX2 size_t find(const T* data, size_t count, T value) {
+    auto needle = broadcast(value);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        unsigned m0 = equalMask(load(data + i), needle);
+        unsigned m1 = equalMask(load(data + i + 8), needle);
+        unsigned m2 = equalMask(load(data + i + 16), needle);
+        unsigned m3 = equalMask(load(data + i + 24), needle);
+        uint32_t mask = m0 | (m1 << 8) | (m2 << 16) | (m3 << 24);
+        if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    for (; i + 8 <= count; i += 8) {
+        unsigned mask = equalMask(load(data + i), needle);
+        if (mask != 0) return i + static_cast<size_t>(__builtin_ctz(mask));
+    }
+    return i + scalar::find(data + i, count - i, value);
+}
+
+template <typename T>
+SIMD_AVX2 size_t count(const T* data, size_t count, T value) {
+    auto needle = broadcast(value);
+    size_t matches = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        matches += static_cast<size_t>(__builtin_popcount(equalMask(load(data + i), needle)));
+    }
+    return matches + scalar::count(data + i, count - i, value);
+}
+
+SIMD_AVX2 inline int sum(const int* data, size_t count) {
+    __m256i a = _mm256_setzero_si256(), b = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) { // Two accumulators hide the add latency
+        a = _mm256_add_epi32(a, load(data + i));
+        b = _mm256_add_epi32(b, load(data + i + 8));
+    }
+    a = _mm256_add_epi32(a, b);
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a);
+    uint32_t total = 0;
+    for (int lane : lanes) total += static_cast<uint32_t>(lane);
+    total += static_cast<uint32_t>(scalar::sum(data + i, count - i));
+    return static_cast<int>(total);
+}
+
+SIMD_AVX2 inline float sum(const float* data, size_t count) {
+    __m256 a = _mm256_setzero_ps(), b = _mm256_setzero_ps(), c = _mm256_setzero_ps(), d = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) { // Four accumulators: a float add takes 4 cycles
+        a = _mm256_add_ps(a, load(data + i));
+        b = _mm256_add_ps(b, load(data + i + 8));
+        c = _mm256_add_ps(c, load(data + i + 16));
+        d = _mm256_add_ps(d, load(data + i + 24));
+    }
+    for (; i + 8 <= count; i += 8) {
+        a = _mm256_add_ps(a, load(data + i));
+    }
+    a = _mm256_add_ps(_mm256_add_ps(a, b), _mm256_add_ps(c, d));
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, a);
+    float total = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    return total + scalar::sum(data + i, count - i);
+}
+
+// Prefix sums of the 8 lanes: shift-and-add inside each 128-bit half, then carry the lower
+// half's total into the upper half
+SIMD_AVX2 inline __m256i prefix8(__m256i x) {
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+    __m256i low = _mm256_permute2x128_si256(x, x, 0x08); // [0, lower half]
+    return _mm256_add_epi32(x, _mm256_shuffle_epi32(low, 0xFF));
+}
+
+SIMD_AVX2 inline __m256 prefix8(__m256 x) {
+    x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 4)));
+    x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 8)));
+    __m256 low = _mm256_permute2f128_ps(x, x, 0x08);
+    return _mm256_add_ps(x, _mm256_shuffle_ps(low, low, 0xFF));
+}
+
+SIMD_AVX2 inline int inclusiveScan(const int* data, int* out, size_t count, int carry) {
+    __m256i running = _mm256_set1_epi32(carry);
+    const __m256i last = _mm256_set1_epi32(7);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i x = _mm256_add_epi32(prefix8(load(data + i)), running);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), x);
+        running = _mm256_permutevar8x32_epi32(x, last); // Broadcast lane 7
+    }
+    carry = _mm256_cvtsi256_si32(running);
+    return scalar::inclusiveScan(data + i, out + i, count - i, carry);
+}
+
+SIMD_AVX2 inline float inclusiveScan(const float* data, float* out, size_t count, float carry) {
+    __m256 running = _mm256_set1_ps(carry);
+    const __m256i last = _mm256_set1_epi32(7);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_add_ps(prefix8(load(data + i)), running);
+        _mm256_storeu_ps(out + i, x);
+        running = _mm256_permutevar8x32_ps(x, last);
+    }
+    carry = _mm256_cvtss_f32(running);
+    return scalar::inclusiveScan(data + i, out + i, count - i, carry);
+}
+
+SIMD_AVX2 inline __m256i loadAligned(const int* data) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(data)); }
+
+// count > 0 and below 2^31 (the indexes are tracked in 32-bit lanes)
+SIMD_AVX2 inline size_t maxElement(const int* data, size_t count) {
+    size_t head = unalignedHead(data, count, 32);
+    size_t best = 0;
+    for (size_t i = 1; i < head; ++i) {
+        if (data[i] > data[best]) best = i;
+    }
+    size_t i = head;
+    if (count - i >= 16) {
+        // Two sets of 8 lanes, each holding the largest value it has seen and where it was
+        __m256i indexA = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(i)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        __m256i indexB = _mm256_add_epi32(indexA, _mm256_set1_epi32(8));
+        __m256i maxA = loadAligned(data + i), maxB = loadAligned(data + i + 8);
+        __m256i atA = indexA, atB = indexB;
+        const __m256i step = _mm256_set1_epi32(16);
+        for (i += 16; i + 16 <= count; i += 16) {
+            indexA = _mm256_add_epi32(indexA, step);
+            indexB = _mm256_add_epi32(indexB, step);
+            __m256i a = loadAligned(data + i), b = loadAligned(data + i + 8);
+            __m256i greaterA = _mm256_cmpgt_epi32(a, maxA), greaterB = _mm256_cmpgt_epi32(b, maxB);
+            maxA = _mm256_max_epi32(a, maxA);
+            maxB = _mm256_max_epi32(b, maxB);
+            atA = _mm256_blendv_epi8(atA, indexA, greaterA); // Only a strictly greater value moves the index,
+            atB = _mm256_blendv_epi8(atB, indexB, greaterB); // so every lane keeps its first maximum
+        }
+        alignas(32) int values[16];
+        alignas(32) int indexes[16];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(values), maxA);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(values + 8), maxB);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(indexes), atA);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(indexes + 8), atB);
+        int lane = 0;
+        for (int l = 1; l < 16; ++l) {
+            if (values[l] > values[lane] || (values[l] == values[lane] && indexes[l] < indexes[lane])) lane = l;
+        }
+        if (values[lane] > data[best]) best = static_cast<size_t>(indexes[lane]);
+    }
+    for (; i < count; ++i) {
+        if (data[i] > data[best]) best = i;
+    }
+    return best;
+}
+
+SIMD_AVX2 inline Summary summarize(const int* data, size_t count) {
+    size_t head = unalignedHead(data, count, 32);
+    Summary summary = scalar::summarize(data, head);
+    size_t i = head;
+    if (count - i >= 8) {
+        __m256i minimum = broadcast(summary.min), maximum = broadcast(summary.max);
+        __m256i sumLow = _mm256_setzero_si256(), sumHigh = _mm256_setzero_si256(); // 4 int64 lanes each
+        for (; i + 8 <= count; i += 8) {
+            __m256i block = loadAligned(data + i);
+            minimum = _mm256_min_epi32(minimum, block);
+            maximum = _mm256_max_epi32(maximum, block);
+            sumLow = _mm256_add_epi64(sumLow, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+            sumHigh = _mm256_add_epi64(sumHigh, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+        }
+        alignas(32) int minimums[8];
+        alignas(32) int maximums[8];
+        alignas(32) int64_t sums[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(minimums), minimum);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(maximums), maximum);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_add_epi64(sumLow, sumHigh));
+        for (int lane = 0; lane < 8; ++lane) {
+            summary.min = minimums[lane] < summary.min ? minimums[lane] : summary.min;
+            summary.max = maximums[lane] > summary.max ? maximums[lane] : summary.max;
+        }
+        summary.sum += sums[0] + sums[1] + sums[2] + sums[3];
+    }
+    return combine(summary, scalar::summarize(data + i, count - i));
+}
+
+#undef SIMD_AVX2
+
+} // namespace avx2
+#endif // SIMD_HAS_AVX2_DISPATCH
+
+#if SIMD_HAS_NEON
+namespace neon {
+
+inline uint32x4_t equal(const int* data, int32x4_t value) { return vceqq_s32(vld1q_s32(data), value); }
+inline uint32x4_t equal(const float* data, float32x4_t value) { return vceqq_f32(vld1q_f32(data), value); }
+inline int32x4_t broadcast(int value) { return vdupq_n_s32(value); }
+inline float32x4_t broadcast(float value) { return vdupq_n_f32(value); }
+
+template <typename T>
+size_t find(const T* data, size_t count, T value) {
+    auto needle = broadcast(value);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        uint32x4_t any = vorrq_u32(vorrq_u32(equal(data + i, needle), equal(data + i + 4, needle)),
+                                   vorrq_u32(equal(data + i + 8, needle), equal(data + i + 12, needle)));
+        if (vmaxvq_u32(any) != 0) break; // The scalar loop below pins down which one
+    }
+    return i + scalar::find(data + i, count - i, value);
+}
+
+template <typename T>
+size_t count(const T* data, size_t count, T value) {
+    auto needle = broadcast(value);
+    uint32x4_t matches = vdupq_n_u32(0);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        matches = vsubq_u32(matches, equal(data + i, needle)); // A match is all ones, i.e. -1
+    }
+    return vaddvq_u32(matches) + scalar::count(data + i, count - i, value);
+}
+
+inline int sum(const int* data, size_t count) {
+    int32x4_t a = vdupq_n_s32(0), b = vdupq_n_s32(0);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        a = vaddq_s32(a, vld1q_s32(data + i));
+        b = vaddq_s32(b, vld1q_s32(data + i + 4));
+    }
+    uint32_t total = static_cast<uint32_t>(vaddvq_s32(vaddq_s32(a, b)));
+    total += static_cast<uint32_t>(scalar::sum(data + i, count - i));
+    return static_cast<int>(total);
+}
+
+inline float sum(const float* data, size_t count) {
+    float32x4_t a = vdupq_n_f32(0), b = vdupq_n_f32(0), c = vdupq_n_f32(0), d = vdupq_n_f32(0);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        a = vaddq_f32(a, vld1q_f32(data + i));
+        b = vaddq_f32(b, vld1q_f32(data + i + 4));
+        c = vaddq_f32(c, vld1q_f32(data + i + 8));
+        d = vaddq_f32(d, vld1q_f32(data + i + 12));
+    }
+    float total = vaddvq_f32(vaddq_f32(vaddq_f32(a, b), vaddq_f32(c, d)));
+    return total + scalar::sum(data + i, count - i);
+}
+
+inline int inclusiveScan(const int* data, int* out, size_t count, int carry) {
+    int32x4_t zero = vdupq_n_s32(0);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        int32x4_t x = vld1q_s32(data + i);
+        x = vaddq_s32(x, vextq_s32(zero, x, 3)); // Add the lane one to the left
+        x = vaddq_s32(x, vextq_s32(zero, x, 2)); // And the one two to the left
+        x = vaddq_s32(x, vdupq_n_s32(carry));
+        vst1q_s32(out + i, x);
+        carry = vgetq_lane_s32(x, 3);
+    }
+    return scalar::inclusiveScan(data + i, out + i, count - i, carry);
+}
+
+inline float inclusiveScan(const float* data, float* out, size_t count, float carry) {
+    float32x4_t zero = vdupq_n_f32(0);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t x = vld1q_f32(data + i);
+        x = vaddq_f32(x, vextq_f32(zero, x, 3));
+        x = vaddq_f32(x, vextq_f32(zero, x, 2));
+        x = vaddq_f32(x, vdupq_n_f32(carry));
+        vst1q_f32(out + i, x);
+        carry = vgetq_lane_f32(x, 3);
+    }
+    return scalar::inclusiveScan(data + i, out + i, count - i, carry);
+}
+
+// count > 0 and below 2^31 (the indexes are tracked in 32-bit lanes)
+inline size_t maxElement(const int* data, size_t count) {
+    size_t head = unalignedHead(data, count, 16);
+    size_t best = 0;
+    for (size_t i = 1; i < head; ++i) {
+        if (data[i] > data[best]) best = i;
+    }
+    size_t i = head;
+    if (count - i >= 8) {
+        const int32_t lanes[4] = {0, 1, 2, 3};
+        int32x4_t indexA = vaddq_s32(vdupq_n_s32(static_cast<int>(i)), vld1q_s32(lanes));
+        int32x4_t indexB = vaddq_s32(indexA, vdupq_n_s32(4));
+        int32x4_t maxA = vld1q_s32(data + i), maxB = vld1q_s32(data + i + 4);
+        int32x4_t atA = indexA, atB = indexB;
+        const int32x4_t step = vdupq_n_s32(8);
+        for (i += 8; i + 8 <= count; i += 8) {
+            indexA = vaddq_s32(indexA, step);
+            indexB = vaddq_s32(indexB, step);
+            int32x4_t a = vld1q_s32(data + i), b = vld1q_s32(data + i + 4);
+            uint32x4_t greaterA = vcgtq_s32(a, maxA), greaterB = vcgtq_s32(b, maxB);
+            maxA = vmaxq_s32(a, maxA);
+            maxB = vmaxq_s32(b, maxB);
+            atA = vbslq_s32(greaterA, indexA, atA);
+            atB = vbslq_s32(greaterB, indexB, atB);
+        }
+        int values[8], indexes[8];
+        vst1q_s32(values, maxA);
+        vst1q_s32(values + 4, maxB);
+        vst1q_s32(indexes, atA);
+        vst1q_s32(indexes + 4, atB);
+        int lane = 0;
+        for (int l = 1; l < 8; ++l) {
+            if (values[l] > values[lane] || (values[l] == values[lane] && indexes[l] < indexes[lane])) lane = l;
+        }
+        if (values[lane] > data[best]) best = static_cast<size_t>(indexes[lane]);
+    }
+    for (; i < count; ++i) {
+        if (data[i] > data[best]) best = i;
+    }
+    return best;
+}
+
+inline Summary summarize(const int* data, size_t count) {
+    size_t head = unalignedHead(data, count, 16);
+    Summary summary = scalar::summarize(data, head);
+    size_t i = head;
+    if (count - i >= 4) {
+        int32x4_t minimum = vdupq_n_s32(summary.min), maximum = vdupq_n_s32(summary.max);
+        int64x2_t sums = vdupq_n_s64(0);
+        for (; i + 4 <= count; i += 4) {
+            int32x4_t block = vld1q_s32(data + i);
+            minimum = vminq_s32(minimum, block);
+            maximum = vmaxq_s32(maximum, block);
+            sums = vpadalq_s32(sums, block); // Adds neighbouring pairs into the two 64-bit lanes
+        }
+        summary.min = vminvq_s32(minimum);
+        summary.max = vmaxvq_s32(maximum);
+        summary.sum += vaddvq_s64(sums);
+    }
+    return combine(summary, scalar::summarize(data + i, count - i));
+}
+
+} // namespace neon
+#endif // SIMD_HAS_NEON
+
+// The dispatching entry points: the best version for this CPU
+#if SIMD_HAS_AVX2_DISPATCH
+#define SIMD_DISPATCH(call) return activeLevel() == Level::Avx2 ? avx2::call : scalar::call
+#elif SIMD_HAS_NEON
+#define SIMD_DISPATCH(call) return activeLevel() == Level::Neon ? neon::call : scalar::call
+#else
+#define SIMD_DISPATCH(call) return scalar::call
+#endif
+
+// Index of the first element equal to value, count if there is none
+template <typename T, typename = std::enable_if_t<supported<T>>>
+size_t find(const T* data, size_t count, T value) {
+    SIMD_DISPATCH(find(data, count, value));
+}
+
+// How many elements are equal to value
+template <typename T, typename = std::enable_if_t<supported<T>>>
+size_t count(const T* data, size_t count, T value) {
+    SIMD_DISPATCH(count(data, count, value));
+}
+
+template <typename T, typename = std::enable_if_t<supported<T>>>
+T sum(const T* data, size_t count) {
+    SIMD_DISPATCH(sum(data, count));
+}
+
+// out[i] = carry + data[0] + ... + data[i] (out may be data); returns the last one
+template <typename T, typename = std::enable_if_t<supported<T>>>
+T inclusiveScan(const T* data, T* out, size_t count, T carry = T()) {
+    SIMD_DISPATCH(inclusiveScan(data, out, count, carry));
+}
+
+namespace detail {
+
+inline size_t maxElementBlock(const int* data, size_t count) {
+    SIMD_DISPATCH(maxElement(data, count));
+}
+
+} // namespace detail
+
+// Index of the first largest element (like std::max_element); count if there are none
+inline size_t maxElement(const int* data, size_t count) {
+    constexpr size_t block = size_t(1) << 30; // The vector versions track indexes in 32-bit lanes
+    if (count == 0) return 0;
+    size_t best = 0;
+    for (size_t from = 0; from < count; from += block) {
+        size_t at = from + detail::maxElementBlock(data + from, count - from < block ? count - from : block);
+        if (data[at] > data[best]) best = at;
+    }
+    return best;
+}
+
+// Sum (as int64_t), min and max in one pass
+inline Summary summarize(const int* data, size_t count) {
+    SIMD_DISPATCH(summarize(data, count));
+}
+
+#undef SIMD_DISPATCH
+
+} // namespace simd
+
+#endif // SIMD_KERNELS_H
@@ -0,0 +1,258 @@
+#ifndef SORT_KERNELS_H
+#define SORT_KERNELS_H
+
+#include <algorithm> // For std::make_heap, std::sort_heap, std::merge, std::copy
+#include <cstddef> // For size_t
+#include <cstdint> // For uint32_t
+#include <cstring> // For std::memcpy, std::memmove
+#include <limits>
+#include <utility> // For std::swap
+#include <vector>
+#include "SimdKernels.h"
+
+/*
+Notes about the sort kernels (int only):
+
+1. **Partition**:
+   - simd::partition(data, count, pivot, scratch) moves the elements < pivot to the front and
+     returns how many there are. The AVX2 version compares 8 elements at once and packs each
+     side together with one permute (the lane order for every 8-bit compare mask comes from a
+     256-entry table), so there is no branch per element to mispredict. The small side goes
+     to scratch, the big side is compacted within data behind the read position.
+
+2. **Merge**:
+   - simd::merge(a, aCount, b, bCount, out) merges two sorted arrays. The AVX2 version keeps
+     8 elements of each in registers and merges them with a bitonic network (min/max plus
+     shuffles), writing 8 sorted elements per step; the scalar version is a branch-free loop.
+
+3. **introSort**:
+   - Quicksort on simd::partition with a median-of-three pivot, heapsort once the recursion is
+     too deep (the introsort guarantee), insertion sort for short ranges.
+   - Keys equal to the pivot all go right; when nothing is smaller than the pivot (it is the
+     minimum), the range is split into "equal to pivot" and "bigger" instead, so inputs with
+     few distinct keys don't degrade.
+*/
+
+namespace simd {
+
+namespace scalar {
+
+inline size_t partition(int* data, size_t count, int pivot, int* scratch) {
+    size_t small = 0, big = 0;
+    for (size_t i = 0; i < count; ++i) {
+        int value = data[i];
+        bool less = value < pivot;
+        scratch[small] = value; // Written either way; only counted when it belongs there
+        data[big] = value; // big <= i, so this never overwrites an unread element
+        small += less;
+        big += !less;
+    }
+    std::memmove(data + small, data, big * sizeof(int));
+    std::memcpy(data, scratch, small * sizeof(int));
+    return small;
+}
+
+inline void merge(const int* a, size_t aCount, const int* b, size_t bCount, int* out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < aCount && j < bCount) {
+        bool takeB = b[j] < a[i];
+        out[k++] = takeB ? b[j] : a[i];
+        j += takeB;
+        i += !takeB;
+    }
+    std::copy(a + i, a + aCount, out + k);
+    std::copy(b + j, b + bCount, out + k + (aCount - i));
+}
+
+} // namespace scalar
+
+#if SIMD_HAS_AVX2_DISPATCH
+namespace avx2 {
+
+#define SIMD_AVX2 __attribute__((target("avx2")))
+
+// For every 8-bit mask, the lanes whose bit is set, in order, then the rest
+struct PackTable {
+    alignas(32) uint32_t lanes[256][8];
+
+    constexpr PackTable() : lanes() {
+        for (unsigned mask = 0; mask < 256; ++mask) {
+            unsigned next = 0;
+            for (unsigned lane = 0; lane < 8; ++lane) {
+                if (mask & (1u << lane)) lanes[mask][next++] = lane;
+            }
+            for (unsigned lane = 0; lane < 8; ++lane) {
+                if (!(mask & (1u << lane))) lanes[mask][next++] = lane;
+            }
+        }
+    }
+};
+
+inline const PackTable& packTable() {
+    static constexpr PackTable table;
+    return table;
+}
+
+SIMD_AVX2 inline __m256i packed(__m256i values, unsigned mask) {
+    __m256i order = _mm256_load_si256(reinterpret_cast<const __m256i*>(packTable().lanes[mask]));
+    return _mm256_permutevar8x32_epi32(values, order);
+}
+
+// scratch needs count + 8 slots
+SIMD_AVX2 inline size_t partition(int* data, size_t count, int pivot, int* scratch) {
+    __m256i pivots = _mm256_set1_epi32(pivot);
+    size_t small = 0, big = 0, i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        unsigned smallMask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivots, values))));
+        unsigned smallCount = static_cast<unsigned>(__builtin_popcount(smallMask));
+        // The small lanes packed to the front go to scratch, the big ones packed to the front go back into data
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(scratch + small), packed(values, smallMask));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + big), packed(values, ~smallMask & 0xFF)); // big <= i
+        small += smallCount;
+        big += 8 - smallCount;
+    }
+    for (; i < count; ++i) {
+        int value = data[i];
+        if (value < pivot) {
+            scratch[small++] = value;
+        } else {
+            data[big++] = value;
+        }
+    }
+    std::memmove(data + small, data, big * sizeof(int));
+    std::memcpy(data, scratch, small * sizeof(int));
+    return small;
+}
+
+// Sort a bitonic 8-lane vector: compare-exchange at distance 4, 2, then 1
+SIMD_AVX2 inline __m256i bitonicClean(__m256i v) {
+    __m256i t = _mm256_permute2x128_si256(v, v, 0x01);
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, t), _mm256_max_epi32(v, t), 0xF0);
+    t = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm256_blend_epi32(_mm256_min_epi32(v, t), _mm256_max_epi32(v, t), 0xCC);
+    t = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_blend_epi32(_mm256_min_epi32(v, t), _mm256_max_epi32(v, t), 0xAA);
+}
+
+// Two sorted vectors in, the 8 smallest (low) and the 8 largest (high) out, both sorted
+SIMD_AVX2 inline void merge16(__m256i a, __m256i b, __m256i& low, __m256i& high) {
+    b = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)); // a followed by reversed b is bitonic
+    low = bitonicClean(_mm256_min_epi32(a, b));
+    high = bitonicClean(_mm256_max_epi32(a, b));
+}
+
+SIMD_AVX2 inline void merge(const int* a, size_t aCount, const int* b, size_t bCount, int* out) {
+    if (aCount < 8 || bCount < 8) {
+        scalar::merge(a, aCount, b, bCount, out);
+        return;
+    }
+    __m256i low, high = load(a), next = load(b); // load() is the one from SimdKernels.h
+    size_t i = 8, j = 8; // Next unread element of a and b; `high` holds 8 elements not yet written
+    size_t k = 0;
+    while (true) {
+        merge16(high, next, low, high);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), low);
+        k += 8;
+        // The next block comes from the input with the smaller head; stop when it can't supply 8
+        bool fromA = j == bCount || (i < aCount && a[i] <= b[j]);
+        if (fromA) {
+            if (i + 8 > aCount) break;
+            next = load(a + i);
+            i += 8;
+        } else {
+            if (j + 8 > bCount) break;
+            next = load(b + j);
+            j += 8;
+        }
+    }
+    // Every element of `high` is >= the last written one; merge it with what is left of both inputs
+    alignas(32) int rest[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(rest), high);
+    std::vector<int> tail(aCount - i + 8);
+    scalar::merge(rest, 8, a + i, aCount - i, tail.data());
+    scalar::merge(tail.data(), tail.size(), b + j, bCount - j, out + k);
+}
+
+#undef SIMD_AVX2
+
+} // namespace avx2
+#endif // SIMD_HAS_AVX2_DISPATCH
+
+// Elements < pivot to the front (in no particular order), returns how many; scratch needs count + 8 slots
+inline size_t partition(int* data, size_t count, int pivot, int* scratch) {
+    if (count == 0) return 0;
+#if SIMD_HAS_AVX2_DISPATCH
+    if (activeLevel() == Level::Avx2) return avx2::partition(data, count, pivot, scratch);
+#endif
+    return scalar::partition(data, count, pivot, scratch);
+}
+
+// Merge the sorted arrays a and b into out (which must not overlap them)
+inline void merge(const int* a, size_t aCount, const int* b, size_t bCount, int* out) {
+#if SIMD_HAS_AVX2_DISPATCH
+    if (activeLevel() == Level::Avx2) return avx2::merge(a, aCount, b, bCount, out);
+#endif
+    scalar::merge(a, aCount, b, bCount, out);
+}
+
+namespace detail {
+
+inline void insertionSort(int* first, int* last) {
+    for (int* i = first + 1; i < last; ++i) {
+        int value = *i;
+        int* j = i;
+        for (; j > first && value < j[-1]; --j) *j = j[-1];
+        *j = value;
+    }
+}
+
+inline int medianOfThree(int a, int b, int c) {
+    if (a > b) std::swap(a, b);
+    if (b > c) std::swap(b, c);
+    return a > b ? a : b;
+}
+
+inline void introSort(int* first, int* last, int* scratch, int depth) {
+    while (last - first > 24) {
+        size_t count = static_cast<size_t>(last - first);
+        if (depth-- == 0) {
+            std::make_heap(first, last);
+            std::sort_heap(first, last);
+            return;
+        }
+        int pivot = medianOfThree(first[0], first[count / 2], last[-1]);
+        size_t small = partition(first, count, pivot, scratch);
+        if (small == 0) {
+            // Pivot is the minimum: split off everything equal to it, which is already in place
+            if (pivot == std::numeric_limits<int>::max()) return;
+            first += partition(first, count, pivot + 1, scratch);
+            continue;
+        }
+        // Recurse into the smaller side, loop on the bigger one: O(log n) stack
+        if (small < count - small) {
+            introSort(first, first + small, scratch, depth);
+            first += small;
+        } else {
+            introSort(first + small, last, scratch, depth);
+            last = first + small;
+        }
+    }
+    insertionSort(first, last);
+}
+
+} // namespace detail
+
+// Sorts ascending: quicksort on simd::partition, heapsort fallback, insertion sort at the leaves
+inline void introSort(int* first, int* last) {
+    size_t count = static_cast<size_t>(last - first);
+    if (count < 2) return;
+    std::vector<int> scratch(count + 8);
+    int depth = 0;
+    for (size_t n = count; n > 1; n >>= 1) depth += 2;
+    detail::introSort(first, last, scratch.data(), depth);
+}
+
+} // namespace simd
+
+#endif // SORT_KERNELS_H
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include "ParallelAlgorithms.h"
+#include "../Vector/SimpleVector.h"
+
+using namespace std;
+
+/**
+ * STL Algorithms Overview:
+ *
+ * 1. **Sequential Algorithms (<algorithm>, <numeric>)**:
+ *    - sort, find, count_if, transform, accumulate/reduce, inclusive_scan, ...: one thread, one element at a time
+ *      (unless the compiler vectorizes the loop).
+ *
+ * 2. **Parallel Algorithms (ParallelAlgorithms.h)**:
+ *    - The same operations in namespace parallel, taking a TaskPool and a pointer range or a contiguous container
+ *      (std::vector, SimpleVector, ...). Big inputs are split over the pool's workers.
+ *    - For int and float, find, count, reduce and inclusive_scan also use AVX2/NEON inside every chunk
+ *      (SimdKernels.h), chosen at run time with a scalar fallback.
+ */
+
+void algorithmsUsage(TaskPool& pool) {
+    cout << "SIMD level: " << simd::levelName(simd::activeLevel()) << endl;
+
+    vector<int> numbers(1000000);
+    iota(numbers.begin(), numbers.end(), 0);
+    reverse(numbers.begin(), numbers.end()); // 999999 ... 0
+
+    parallel::sort(pool, numbers);
+    cout << "Sorted: " << numbers[0] << " " << numbers[1] << " ... " << numbers.back() << endl; // Output: 0 1 ... 999999
+
+    auto it = parallel::find(pool, numbers, 123456);
+    cout << "123456 found at index: " << (it - numbers.begin()) << endl; // Output: 123456
+
+    long long sum = parallel::reduce(pool, numbers, 0LL);
+    cout << "Sum: " << sum << endl; // Output: 499999500000
+
+    size_t even = parallel::count_if(pool, numbers, [](int n) { return n % 2 == 0; });
+    cout << "Even numbers: " << even << endl; // Output: 500000
+
+    vector<float> halves(numbers.size());
+    parallel::transform(pool, numbers, halves, [](int n) { return n * 0.5f; });
+    cout << "Halves: " << halves[3] << " " << halves[10] << endl; // Output: 1.5 5
+
+    SimpleVector<int> ones;
+    for (int i = 0; i < 10; ++i) ones.push_back(1);
+    SimpleVector<int> prefix;
+    for (int i = 0; i < 10; ++i) prefix.push_back(0);
+    parallel::inclusive_scan(pool, ones, prefix);
+    cout << "Prefix sums of ones: ";
+    for (int n : prefix) {
+        cout << n << " "; // Output: 1 2 3 4 5 6 7 8 9 10
+    }
+    cout << endl;
+    cout << "Count of 1 in a SimpleVector: " << parallel::count(pool, ones, 1) << endl; // Output: 10
+}
+
+int main() {
+    TaskPool pool;
+    algorithmsUsage(pool);
+    return 0;
+}
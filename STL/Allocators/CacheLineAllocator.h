@@ -0,0 +1,45 @@
+#ifndef CACHE_LINE_ALLOCATOR_H
+#define CACHE_LINE_ALLOCATOR_H
+
+#include <cstddef> // For size_t
+#include <limits>
+#include <new> // For std::align_val_t, std::bad_alloc
+
+/*
+Notes about CacheLineAllocator:
+
+1. **What It Is For**:
+   - A standard allocator (usable as the second argument of std::vector) whose blocks all
+     start on a 64-byte boundary. Element 0 then starts a cache line, so layouts that group
+     elements by cache line (IndexedHeap's sibling groups) or load them with aligned SIMD
+     instructions (Matrix) line up the way they were planned.
+   - It uses the aligned forms of operator new/delete (C++17), so the memory comes from the
+     normal heap and nothing extra is stored per block.
+*/
+
+// std::allocator with every block aligned to a cache line
+template <typename T>
+struct CacheLineAllocator {
+    using value_type = T;
+    static constexpr size_t alignment = 64;
+
+    CacheLineAllocator() = default;
+    template <typename U>
+    CacheLineAllocator(const CacheLineAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(T)) throw std::bad_alloc();
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignment)));
+    }
+
+    void deallocate(T* ptr, size_t) {
+        ::operator delete(ptr, std::align_val_t(alignment));
+    }
+
+    template <typename U>
+    bool operator==(const CacheLineAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const CacheLineAllocator<U>&) const { return false; }
+};
+
+#endif // CACHE_LINE_ALLOCATOR_H
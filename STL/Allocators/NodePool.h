@@ -0,0 +1,221 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef> // For size_t
+#include <initializer_list>
+#include <new> // For placement new and ::operator new
+#include <type_traits> // For std::is_trivially_destructible
+#include <utility> // For std::forward
+
+/*
+Notes about node allocators:
+
+1. **Why Pool Nodes**:
+   - Linked structures (lists, trees) allocate one small node at a time. With plain `new`
+     every node is a separate trip through the global allocator, and consecutive nodes can end
+     up anywhere on the heap, so walking the structure jumps around in memory.
+   - A pool grabs memory for many nodes at once (a chunk) and hands nodes out from it, so
+     nodes built one after another sit next to each other.
+
+2. **Free List**:
+   - A node given back with destroy() is pushed onto a free list (the slot itself stores the
+     "next" pointer), and the next create() reuses it before touching fresh chunk memory.
+
+3. **Bulk Release**:
+   - reset() forgets every node at once but keeps the chunks for the next build.
+   - releaseAll() returns the chunks themselves to the system.
+   - Both cost O(chunks), not O(nodes), because destructors are skipped. That is only
+     legal for trivially destructible nodes, which the pool checks at compile time.
+
+4. **Allocator Interface** (shared by HeapNodeAllocator and NodePool):
+   - create(args...) constructs a node, destroy(node) destroys it.
+   - supportsBulkRelease tells the container whether releaseAll()/reset() may be used
+     instead of destroying nodes one by one.
+   - absorb(other) takes over the nodes another allocator of the same type created, so
+     threads can each build part of a structure with their own (unshared, lock-free)
+     allocator and hand the result to the structure's allocator at the end.
+*/
+
+// Plain new/delete per node (the behaviour the containers had before pooling)
+template <typename T>
+class HeapNodeAllocator {
+public:
+    static constexpr bool supportsBulkRelease = false;
+
+    template <typename... Args>
+    T* create(Args&&... args) {
+        return new T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T* node) {
+        delete node;
+    }
+
+    void absorb(HeapNodeAllocator&&) {} // Heap nodes don't belong to any allocator
+};
+
+// Fixed-size pool: nodes are carved out of chunks of NodesPerChunk slots
+template <typename T, size_t NodesPerChunk = 256>
+class NodePool {
+private:
+    // A slot holds either a live node or, once freed, the link to the next free slot
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct Chunk {
+        Chunk* next;
+        Slot slots[NodesPerChunk];
+    };
+
+    Chunk* firstChunk; // All chunks, in allocation order
+    Chunk* currentChunk; // Chunk that fresh slots are taken from
+    size_t usedInCurrent; // Slots handed out from currentChunk so far
+    Slot* freeList; // Slots given back by destroy()
+    Chunk* absorbedChunks; // Chunks taken over from other pools; only reused after reset()
+    size_t chunkCount;
+
+    static void freeChunks(Chunk* chunk) {
+        while (chunk) {
+            Chunk* next = chunk->next;
+            ::operator delete(chunk);
+            chunk = next;
+        }
+    }
+
+    Slot* takeSlot() {
+        if (freeList) {
+            Slot* slot = freeList; // Reuse a freed slot first
+            freeList = freeList->next;
+            return slot;
+        }
+        if (!currentChunk || usedInCurrent == NodesPerChunk) {
+            if (currentChunk && currentChunk->next) {
+                currentChunk = currentChunk->next; // Chunk kept from before a reset()
+            } else {
+                Chunk* chunk = static_cast<Chunk*>(::operator new(sizeof(Chunk)));
+                chunk->next = nullptr;
+                if (currentChunk) {
+                    currentChunk->next = chunk;
+                } else {
+                    firstChunk = chunk;
+                }
+                currentChunk = chunk;
+                chunkCount++;
+            }
+            usedInCurrent = 0;
+        }
+        return &currentChunk->slots[usedInCurrent++];
+    }
+
+public:
+    static constexpr bool supportsBulkRelease = std::is_trivially_destructible<T>::value;
+
+    NodePool() : firstChunk(nullptr), currentChunk(nullptr), usedInCurrent(0), freeList(nullptr), absorbedChunks(nullptr), chunkCount(0) {}
+
+    // Nodes point into the chunks, so a pool can be moved but never copied
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    NodePool(NodePool&& other) noexcept
+        : firstChunk(other.firstChunk), currentChunk(other.currentChunk), usedInCurrent(other.usedInCurrent),
+          freeList(other.freeList), absorbedChunks(other.absorbedChunks), chunkCount(other.chunkCount) {
+        other.firstChunk = other.currentChunk = other.absorbedChunks = nullptr;
+        other.usedInCurrent = 0;
+        other.freeList = nullptr;
+        other.chunkCount = 0;
+    }
+
+    NodePool& operator=(NodePool&& other) noexcept {
+        if (this != &other) {
+            releaseAll();
+            firstChunk = other.firstChunk;
+            currentChunk = other.currentChunk;
+            usedInCurrent = other.usedInCurrent;
+            freeList = other.freeList;
+            absorbedChunks = other.absorbedChunks;
+            chunkCount = other.chunkCount;
+            other.firstChunk = other.currentChunk = other.absorbedChunks = nullptr;
+            other.usedInCurrent = 0;
+            other.freeList = nullptr;
+            other.chunkCount = 0;
+        }
+        return *this;
+    }
+
+    // Frees the chunks; any node still alive must be trivially destructible
+    ~NodePool() {
+        releaseAll();
+    }
+
+    template <typename... Args>
+    T* create(Args&&... args) {
+        Slot* slot = takeSlot();
+        try {
+            return new (slot->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slot->next = freeList; // Constructor threw, give the slot back
+            freeList = slot;
+            throw;
+        }
+    }
+
+    void destroy(T* node) {
+        node->~T();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = freeList;
+        freeList = slot;
+    }
+
+    // Take over every node (and chunk) of other, leaving it empty - O(chunks of other).
+    // Its chunks hold live nodes, so they are kept aside until the next reset().
+    void absorb(NodePool&& other) {
+        if (this == &other) return;
+        for (Chunk* chunks : {other.firstChunk, other.absorbedChunks}) {
+            while (chunks) {
+                Chunk* next = chunks->next;
+                chunks->next = absorbedChunks;
+                absorbedChunks = chunks;
+                chunks = next;
+            }
+        }
+        chunkCount += other.chunkCount;
+        other.firstChunk = other.currentChunk = other.absorbedChunks = nullptr;
+        other.usedInCurrent = 0;
+        other.freeList = nullptr;
+        other.chunkCount = 0;
+    }
+
+    // Forget every node but keep the chunks for reuse - O(1), or O(chunks) after absorb()
+    void reset() {
+        static_assert(std::is_trivially_destructible<T>::value, "reset() skips destructors");
+        while (absorbedChunks) {
+            Chunk* chunk = absorbedChunks; // Absorbed chunks join the regular ones
+            absorbedChunks = chunk->next;
+            chunk->next = firstChunk;
+            firstChunk = chunk;
+        }
+        currentChunk = firstChunk;
+        usedInCurrent = 0;
+        freeList = nullptr;
+    }
+
+    // Give every chunk back to the system - O(chunks)
+    void releaseAll() {
+        freeChunks(firstChunk);
+        freeChunks(absorbedChunks);
+        firstChunk = nullptr;
+        absorbedChunks = nullptr;
+        currentChunk = nullptr;
+        usedInCurrent = 0;
+        freeList = nullptr;
+        chunkCount = 0;
+    }
+
+    size_t getChunkCount() const {
+        return chunkCount;
+    }
+};
+
+#endif // NODE_POOL_H
@@ -0,0 +1,363 @@
+#ifndef FAST_IO_H
+#define FAST_IO_H
+
+#include <charconv> // For std::from_chars, std::to_chars
+#include <cstddef> // For size_t, std::ptrdiff_t
+#include <cstring> // For std::memcpy, std::memmove
+#include <fstream>
+#include <iostream> // For std::cin where there is no read()
+#include <istream>
+#include <iterator> // For std::input_iterator_tag, std::output_iterator_tag
+#include <memory> // For std::unique_ptr
+#include <ostream>
+#include <stdexcept> // For std::runtime_error, std::out_of_range
+#include <string>
+#include <string_view>
+#include <system_error> // For std::errc
+#include <type_traits> // For std::is_integral_v
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno> // For errno, EINTR
+#include <fcntl.h> // For open
+#include <sys/mman.h> // For mmap, munmap, madvise
+#include <sys/stat.h> // For fstat
+#include <unistd.h> // For read, write, close
+#define FAST_IO_HAS_POSIX 1
+#else
+#define FAST_IO_HAS_POSIX 0
+#endif
+
+/*
+Notes about fast integer I/O:
+
+1. **Why cin >> and cout << Are Slow**:
+   - Every `cin >> value` is a formatted-input call: it builds a sentry (skips whitespace,
+     checks the stream state, flushes the tied cout), consults the locale's num_get facet
+     and reads characters one at a time through the stream buffer. With
+     sync_with_stdio(true) (the default) that buffer is stdio's, one getc-like call per
+     character. `cout << value` is the same on the way out.
+   - sync_with_stdio(false) gives the streams their own buffers, which removes the per-character
+     calls but not the per-value sentry and locale work.
+
+2. **IntReader**:
+   - Reads big blocks (1 MB) with one read() per block, or maps a whole file into memory
+     (mmap, so there is no copy at all), and parses straight out of the buffer with
+     std::from_chars: no locale, no sentry, no per-character virtual call.
+   - Numbers are separated by whitespace, like `cin >> value` with an int. read(value) returns
+     false at the end of the input; a token that isn't an integer throws std::runtime_error,
+     one that doesn't fit the type std::out_of_range (where cin would set failbit).
+   - From a file descriptor (stdin, a pipe) each read() returns what has arrived, so
+     interactive input works; from a std::istream a whole block (or the end) is waited for.
+
+3. **IntWriter**:
+   - Formats with std::to_chars into a 64 KB buffer and hands full buffers to the stream
+     (one write call per block) or file descriptor. flush() (and the destructor) writes the
+     rest; a flush from the destructor can't report errors, so call flush() to find out.
+   - Writing through std::cout keeps the order with other output to std::cout.
+
+4. **Iterators**:
+   - IntInputIterator<T> and IntOutputIterator<T> work like istream_iterator<T> and
+     ostream_iterator<T> (a default-constructed input iterator is the end; the output
+     iterator writes a delimiter after every value), so they drop into std::copy and the
+     other algorithms written for those.
+*/
+
+class IntReader {
+private:
+    enum class Source { Stream, Descriptor, Mapped };
+    static constexpr size_t blockSize = 1 << 20;
+
+    Source source;
+    std::istream* stream = nullptr;
+    std::unique_ptr<std::istream> ownedStream; // A file opened by path without mmap
+    int descriptor = -1;
+    std::vector<char> buffer;
+    const char* next = nullptr; // Unread input is [next, end)
+    const char* end = nullptr;
+    bool exhausted = false; // The source has nothing more after [next, end)
+    void* mapping = nullptr;
+    size_t mappedLength = 0;
+
+    static bool isSpace(char c) { return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f'; }
+
+    size_t readBlock(char* into, size_t count) {
+        if (source == Source::Stream) return static_cast<size_t>(stream->rdbuf()->sgetn(into, static_cast<std::streamsize>(count)));
+#if FAST_IO_HAS_POSIX
+        while (true) {
+            ssize_t got = ::read(descriptor, into, count);
+            if (got >= 0) return static_cast<size_t>(got);
+            if (errno != EINTR) throw std::runtime_error("IntReader: read failed");
+        }
+#else
+        return 0;
+#endif
+    }
+
+    // No whitespace between from and the end of the buffer
+    bool tokenReachesEnd(const char* from) const {
+        while (from != end && !isSpace(*from)) ++from;
+        return from == end;
+    }
+
+    // Keeps the unread rest, moved to the front, and appends the next block; false at the end
+    bool refill() {
+        if (exhausted) return false;
+        size_t rest = static_cast<size_t>(end - next);
+        if (rest > 0) std::memmove(buffer.data(), next, rest);
+        if (buffer.size() < rest + blockSize) buffer.resize(rest + blockSize); // Only a token longer than a block grows it
+        size_t got = readBlock(buffer.data() + rest, blockSize);
+        next = buffer.data();
+        end = next + rest + got;
+        if (got == 0) exhausted = true;
+        return got > 0;
+    }
+
+public:
+    // Reads blocks from the stream's buffer (with cin: after any sync_with_stdio setting)
+    explicit IntReader(std::istream& in) : source(Source::Stream), stream(&in) {}
+
+#if FAST_IO_HAS_POSIX
+    // Reads blocks with read(); the descriptor stays open
+    explicit IntReader(int fd) : source(Source::Descriptor), descriptor(fd) {}
+#endif
+
+    // Maps the whole file (reads it as a stream where mmap isn't available)
+    explicit IntReader(const std::string& path) : source(Source::Mapped), exhausted(true) {
+#if FAST_IO_HAS_POSIX
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("Cannot open file: " + path);
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat file: " + path);
+        }
+        mappedLength = static_cast<size_t>(info.st_size);
+        if (mappedLength > 0) {
+            mapping = ::mmap(nullptr, mappedLength, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map file: " + path);
+            }
+            ::madvise(mapping, mappedLength, MADV_SEQUENTIAL); // Read ahead aggressively
+            next = static_cast<const char*>(mapping);
+            end = next + mappedLength;
+        }
+        ::close(fd); // The mapping stays valid after the descriptor is closed
+#else
+        ownedStream = std::make_unique<std::ifstream>(path, std::ios::binary);
+        if (!*ownedStream) throw std::runtime_error("Cannot open file: " + path);
+        source = Source::Stream;
+        stream = ownedStream.get();
+        exhausted = false;
+#endif
+    }
+
+    IntReader(const IntReader&) = delete;
+    IntReader& operator=(const IntReader&) = delete;
+
+    ~IntReader() {
+#if FAST_IO_HAS_POSIX
+        if (mapping) ::munmap(mapping, mappedLength);
+#endif
+    }
+
+    // Standard input, read as it arrives: read() on its descriptor where there is one
+    static IntReader standardInput() {
+#if FAST_IO_HAS_POSIX
+        return IntReader(STDIN_FILENO);
+#else
+        return IntReader(std::cin);
+#endif
+    }
+
+    // The next whitespace-separated integer; false (value unchanged) at the end of the input
+    template <typename T>
+    bool read(T& value) {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "IntReader reads integers");
+        while (true) {
+            while (next != end && isSpace(*next)) ++next;
+            if (next == end) {
+                if (!refill()) return false;
+                continue;
+            }
+            const char* first = next;
+            if (*first == '+' && first + 1 != end && *(first + 1) != '-') ++first; // from_chars takes no '+'
+            T parsed{};
+            auto [stop, error] = std::from_chars(first, end, parsed);
+            if (!exhausted && (stop == end || error != std::errc()) && tokenReachesEnd(stop)) {
+                refill(); // The token may go on in the next block: parse it again, whole
+                continue;
+            }
+            if (error == std::errc::result_out_of_range) throw std::out_of_range("IntReader: integer out of range");
+            if (error != std::errc() || (stop != end && !isSpace(*stop))) throw std::runtime_error("IntReader: not an integer");
+            next = stop;
+            value = parsed;
+            return true;
+        }
+    }
+
+    // Appends every remaining integer to values; returns how many there were
+    template <typename T>
+    size_t readAll(std::vector<T>& values) {
+        size_t count = 0;
+        T value;
+        while (read(value)) {
+            values.push_back(value);
+            ++count;
+        }
+        return count;
+    }
+};
+
+class IntWriter {
+private:
+    static constexpr size_t blockSize = 1 << 16;
+    static constexpr size_t longestInteger = 24; // Sign and digits of any 64-bit integer, with room to spare
+
+    std::ostream* stream = nullptr;
+    int descriptor = -1;
+    std::unique_ptr<char[]> buffer{new char[blockSize]};
+    size_t used = 0;
+
+    void writeOut(const char* data, size_t count) {
+        if (stream) {
+            if (!stream->write(data, static_cast<std::streamsize>(count))) throw std::runtime_error("IntWriter: write failed");
+            return;
+        }
+#if FAST_IO_HAS_POSIX
+        while (count > 0) {
+            ssize_t done = ::write(descriptor, data, count);
+            if (done < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error("IntWriter: write failed");
+            }
+            data += done;
+            count -= static_cast<size_t>(done);
+        }
+#endif
+    }
+
+    void spill() {
+        writeOut(buffer.get(), used);
+        used = 0;
+    }
+
+public:
+    explicit IntWriter(std::ostream& out) : stream(&out) {}
+
+#if FAST_IO_HAS_POSIX
+    // Writes with write(); the descriptor stays open
+    explicit IntWriter(int fd) : descriptor(fd) {}
+#endif
+
+    IntWriter(const IntWriter&) = delete;
+    IntWriter& operator=(const IntWriter&) = delete;
+
+    ~IntWriter() {
+        try {
+            flush();
+        } catch (...) {
+            // Nowhere to report it from a destructor; flush() explicitly to see errors
+        }
+    }
+
+    template <typename T>
+    void write(T value) {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "IntWriter writes integers");
+        if (blockSize - used < longestInteger) spill();
+        used = static_cast<size_t>(std::to_chars(buffer.get() + used, buffer.get() + blockSize, value).ptr - buffer.get());
+    }
+
+    void put(char c) {
+        if (used == blockSize) spill();
+        buffer[used++] = c;
+    }
+
+    void put(std::string_view text) {
+        if (text.size() > blockSize - used) {
+            spill();
+            if (text.size() > blockSize) { // Too big to be worth copying
+                writeOut(text.data(), text.size());
+                return;
+            }
+        }
+        std::memcpy(buffer.get() + used, text.data(), text.size());
+        used += text.size();
+    }
+
+    // Writes everything buffered, and flushes the stream
+    void flush() {
+        spill();
+        if (stream && !stream->flush()) throw std::runtime_error("IntWriter: flush failed");
+    }
+};
+
+// Like istream_iterator<T>, over an IntReader
+template <typename T>
+class IntInputIterator {
+private:
+    IntReader* reader = nullptr; // nullptr: the end
+    T value{};
+
+    void advance() {
+        if (!reader->read(value)) reader = nullptr;
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    IntInputIterator() = default; // The end iterator
+    explicit IntInputIterator(IntReader& source) : reader(&source) { advance(); } // Reads the first value, like istream_iterator
+
+    const T& operator*() const { return value; }
+    const T* operator->() const { return &value; }
+
+    IntInputIterator& operator++() {
+        advance();
+        return *this;
+    }
+
+    IntInputIterator operator++(int) {
+        IntInputIterator before = *this;
+        advance();
+        return before;
+    }
+
+    // Equal when both are at the end, or both read from the same reader
+    bool operator==(const IntInputIterator& other) const { return reader == other.reader; }
+    bool operator!=(const IntInputIterator& other) const { return reader != other.reader; }
+};
+
+// Like ostream_iterator<T>, over an IntWriter: writes delimiter after every value
+template <typename T>
+class IntOutputIterator {
+private:
+    IntWriter* writer;
+    std::string_view delimiter;
+
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    explicit IntOutputIterator(IntWriter& target, std::string_view delimiter = {}) : writer(&target), delimiter(delimiter) {}
+
+    IntOutputIterator& operator=(const T& value) {
+        writer->write(value);
+        if (!delimiter.empty()) writer->put(delimiter);
+        return *this;
+    }
+
+    IntOutputIterator& operator*() { return *this; }
+    IntOutputIterator& operator++() { return *this; }
+    IntOutputIterator& operator++(int) { return *this; }
+};
+
+#endif // FAST_IO_H
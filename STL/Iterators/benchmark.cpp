@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "FastIO.h"
+
+using namespace std;
+
+/*
+Benchmark: reading and writing whitespace-separated integers
+
+- Writes a file of 10M random 32-bit integers (about 110 MB; pass another count as the first
+  argument), then runs every mode in a child process of its own (this program again, with
+  the file as stdin and /dev/null as stdout), because sync_with_stdio has to be chosen
+  before the first I/O of a process.
+- Reading: cin >> value with and without sync_with_stdio(false), scanf("%d"), and IntReader
+  over stdin (read() in 1 MB blocks), over cin's stream buffer and over the mmapped file.
+  Each sums the values and checks the sum.
+- Writing (to /dev/null, so it measures formatting, not the disk): cout << value << ' ' with
+  and without sync_with_stdio(false), printf, and IntWriter through cout and through write().
+- Results are M integers per second and MB per second of text, one pass each (the file is
+  in the page cache after it was written).
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static const char* dataFile = "benchmark_ints.txt";
+
+static void report(const char* mode, size_t count, size_t bytes, double seconds) {
+    cerr << "  " << mode << ": " << count / seconds / 1e6 << " M ints/s, " << bytes / seconds / 1e6 << " MB/s" << endl;
+}
+
+// One mode, timed; runs in the child process
+static int runChild(const string& mode, int64_t expectedSum, size_t bytes) {
+    int64_t sum = 0;
+    size_t count = 0;
+    vector<int> values;
+    bool writing = mode.rfind("write", 0) == 0;
+    if (writing) { // Untimed: the values to write
+        IntReader reader{string(dataFile)};
+        reader.readAll(values);
+    }
+    if (mode == "read-cin-nosync" || mode == "write-cout-nosync") ios::sync_with_stdio(false);
+
+    auto start = chrono::steady_clock::now();
+    if (mode == "read-cin" || mode == "read-cin-nosync") {
+        int value;
+        while (cin >> value) {
+            sum += value;
+            ++count;
+        }
+    } else if (mode == "read-scanf") {
+        int value;
+        while (scanf("%d", &value) == 1) {
+            sum += value;
+            ++count;
+        }
+    } else if (mode == "read-intreader-stdin" || mode == "read-intreader-cin" || mode == "read-intreader-mmap") {
+        auto readAll = [&](IntReader& reader) {
+            for (IntInputIterator<int> it(reader), end; it != end; ++it) {
+                sum += *it;
+                ++count;
+            }
+        };
+        if (mode == "read-intreader-stdin") {
+            IntReader reader = IntReader::standardInput();
+            readAll(reader);
+        } else if (mode == "read-intreader-cin") {
+            IntReader reader(cin);
+            readAll(reader);
+        } else {
+            IntReader reader{string(dataFile)};
+            readAll(reader);
+        }
+    } else if (mode == "write-cout" || mode == "write-cout-nosync") {
+        for (int value : values) cout << value << ' ';
+        cout.flush();
+    } else if (mode == "write-printf") {
+        for (int value : values) printf("%d ", value);
+        fflush(stdout);
+    } else if (mode == "write-intwriter-cout") {
+        IntWriter writer(cout);
+        copy(values.begin(), values.end(), IntOutputIterator<int>(writer, " "));
+        writer.flush();
+    } else if (mode == "write-intwriter-fd") {
+#if FAST_IO_HAS_POSIX
+        IntWriter writer(STDOUT_FILENO);
+        copy(values.begin(), values.end(), IntOutputIterator<int>(writer, " "));
+        writer.flush();
+#endif
+    } else {
+        cerr << "unknown mode " << mode << endl;
+        return 1;
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    if (writing) {
+        count = values.size();
+    } else if (sum != expectedSum) {
+        cerr << "MISMATCH in " << mode << ": sum " << sum << " != " << expectedSum << endl;
+    }
+    report(mode.c_str(), count, bytes, seconds);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 5 && strcmp(argv[1], "child") == 0) return runChild(argv[2], strtoll(argv[3], nullptr, 10), strtoull(argv[4], nullptr, 10));
+
+    size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+    mt19937 random(2024);
+    int64_t sum = 0;
+    {
+        ofstream file(dataFile, ios::binary);
+        IntWriter writer(file);
+        for (size_t i = 0; i < count; ++i) {
+            int value = static_cast<int>(random());
+            sum += value;
+            writer.write(value);
+            writer.put(i % 16 == 15 ? '\n' : ' ');
+        }
+        writer.flush();
+    }
+    ifstream sizeCheck(dataFile, ios::binary | ios::ate);
+    size_t bytes = static_cast<size_t>(sizeCheck.tellg());
+    cout << count << " integers, " << bytes / 1e6 << " MB of text" << endl;
+
+    const char* readModes[] = {"read-cin", "read-cin-nosync", "read-scanf", "read-intreader-cin", "read-intreader-stdin", "read-intreader-mmap"};
+    const char* writeModes[] = {"write-cout", "write-cout-nosync", "write-printf", "write-intwriter-cout", "write-intwriter-fd"};
+    string self = string("\"") + argv[0] + "\" child ";
+    string tail = " " + to_string(sum) + " " + to_string(bytes) + " < " + dataFile + " > /dev/null";
+    cout << "Reading:" << endl;
+    for (const char* mode : readModes) {
+        if (system((self + mode + tail).c_str()) != 0) cout << "  " << mode << " failed" << endl;
+    }
+    cout << "Writing:" << endl;
+    for (const char* mode : writeModes) {
+        if (system((self + mode + tail).c_str()) != 0) cout << "  " << mode << " failed" << endl;
+    }
+    remove(dataFile);
+    return 0;
+}
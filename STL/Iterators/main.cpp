@@ -4,6 +4,7 @@
 #include <set>
 #include <map>
 #include <iterator>
+#include "FastIO.h"
 
 using namespace std;
 
@@ -17,19 +18,23 @@ using namespace std;
  * 5. **Random Access Iterator**: Allows access to elements using indices, enabling more complex operations. Example using a vector.
  * 6. **Const Iterator**: Provides read-only access to elements. Example using a const vector.
  * 7. **Reverse Iterator**: Allows iterating through a container in reverse order. Example using a vector.
+ * 8. **Fast Integer I/O**: IntInputIterator and IntOutputIterator (FastIO.h) are drop-in replacements for
+ *    istream_iterator and ostream_iterator over buffered from_chars / to_chars I/O, for large inputs and outputs.
+ *    benchmark.cpp compares them with cin / cout.
  */
 
 int main() {
     // Input Iterator Example
     cout << "Input Iterator Example:" << endl;
     vector<int> inputVec = {1, 2, 3, 4, 5};
-    istream_iterator<int> inputIt(cin); // Reads from standard input
     cout << "Enter 5 integers (end with EOF): ";
+    cout.flush(); // The reader doesn't go through cin, so nothing flushes the prompt for us
+    // Like istream_iterator<int> inputIt(cin), but buffered: reads the first value right away
+    IntReader input = IntReader::standardInput();
+    IntInputIterator<int> inputIt(input), inputEnd;
     cout << "Input Iterated Values: ";
-    for (int i = 0; i < 5; ++i) {
-        int val;
-        cin >> val;
-        cout << val << " ";
+    for (int i = 0; i < 5 && inputIt != inputEnd; ++i, ++inputIt) {
+        cout << *inputIt << " ";
     }
     cout << endl;
 
@@ -39,6 +44,16 @@ int main() {
     *outputIt = 10;  // Outputting single value
     *outputIt = 20;  // Outputting another value
     cout << endl;
+    {
+        // The same with a buffered writer: formats into a block, written to cout when flushed
+        IntWriter writer(cout);
+        IntOutputIterator<int> fastOutputIt(writer, " ");
+        *fastOutputIt = 30;
+        *fastOutputIt = 40;
+        copy(inputVec.begin(), inputVec.end(), fastOutputIt);
+        writer.put('\n');
+        writer.flush();
+    }
 
     // Forward Iterator Example
     cout << "\nForward Iterator Example:" << endl;
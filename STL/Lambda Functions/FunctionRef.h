@@ -0,0 +1,67 @@
+#ifndef FUNCTION_REF_H
+#define FUNCTION_REF_H
+
+#include <functional> // For std::invoke
+#include <memory> // For std::addressof
+#include <type_traits>
+#include <utility> // For std::forward
+
+/*
+Notes about FunctionRef:
+
+1. **What It Is For**:
+   - A parameter that takes "anything callable as R(Args...)" without being a template:
+     plain functions, function pointers, lambdas with or without captures, functors.
+   - It is two pointers (the callable's address and a small function that calls it), it never
+     allocates and never copies the callable. std::function copies the callable into itself
+     and may allocate for it (libstdc++ does beyond 16 bytes of captures).
+
+2. **Non-Owning**:
+   - FunctionRef refers to the callable, like a string_view does to a string. Use it for
+     parameters that are called during the function (callbacks, predicates, visitors), not
+     to store the callable for later: a FunctionRef to a lambda temporary dangles at the end
+     of the statement that made it. InplaceFunction (InplaceFunction.h) owns its callable.
+   - Function pointers are stored themselves, so FunctionRef(&someFunction) is always safe.
+
+3. **Cost**:
+   - A call is one indirect call, like a function pointer; a template parameter is the only
+     way to let the compiler inline the callable.
+*/
+
+template <typename Signature>
+class FunctionRef;
+
+template <typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+private:
+    union Target {
+        void* object;
+        void (*function)();
+    };
+
+    Target target;
+    R (*invoke)(Target, Args&&...);
+
+public:
+    template <typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, FunctionRef>::value &&
+                                                      std::is_invocable_r<R, F&, Args...>::value>>
+    FunctionRef(F&& callable) noexcept {
+        using Callable = std::remove_reference_t<F>;
+        if constexpr (std::is_function<std::remove_pointer_t<std::decay_t<F>>>::value) {
+            using Pointer = std::decay_t<F>;
+            target.function = reinterpret_cast<void (*)()>(static_cast<Pointer>(callable));
+            invoke = [](Target t, Args&&... args) -> R {
+                return std::invoke(reinterpret_cast<Pointer>(t.function), std::forward<Args>(args)...);
+            };
+        } else {
+            target.object = const_cast<void*>(static_cast<const void*>(std::addressof(callable)));
+            invoke = [](Target t, Args&&... args) -> R {
+                return std::invoke(*static_cast<Callable*>(t.object), std::forward<Args>(args)...);
+            };
+        }
+    }
+
+    R operator()(Args... args) const { return invoke(target, std::forward<Args>(args)...); }
+};
+
+#endif // FUNCTION_REF_H
@@ -0,0 +1,125 @@
+#ifndef INPLACE_FUNCTION_H
+#define INPLACE_FUNCTION_H
+
+#include <cstddef> // For size_t, std::max_align_t, std::nullptr_t
+#include <functional> // For std::invoke, std::bad_function_call
+#include <new> // For placement new
+#include <type_traits>
+#include <utility> // For std::forward, std::move
+
+/*
+Notes about InplaceFunction:
+
+1. **What It Is For**:
+   - Like std::function<R(Args...)>, it owns a copy of any callable and can be stored,
+     copied and called later. Unlike std::function it never allocates: the callable lives in
+     a buffer of Capacity bytes inside the InplaceFunction (32 by default, e.g. four captured
+     pointers or ints).
+   - A callable that does not fit is rejected at compile time (static_assert), not moved to
+     the heap. Raise Capacity for it, or capture less (one pointer to a struct).
+
+2. **How It Works**:
+   - Next to the buffer sits a pointer to a table of four functions (call, copy, move,
+     destroy) made once per callable type, so an InplaceFunction is Capacity + 8 bytes and a
+     call is one indirect call, as with std::function.
+   - Calling an empty InplaceFunction throws std::bad_function_call, like std::function.
+   - The callable must be copyable (the InplaceFunction is), nothrow-movable, and aligned
+     to at most alignof(std::max_align_t). The type is erased, so the InplaceFunction's move
+     can only be noexcept if every callable's is; lambdas capturing pointers, ints and
+     standard types are. That keeps std::vector<InplaceFunction> moving, not copying, its
+     elements when it grows.
+*/
+
+template <typename Signature, size_t Capacity = 32>
+class InplaceFunction;
+
+template <typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+private:
+    struct Operations {
+        R (*call)(void* callable, Args&&... args);
+        void (*copy)(void* target, const void* source);
+        void (*move)(void* target, void* source) noexcept;
+        void (*destroy)(void* callable);
+    };
+
+    template <typename F>
+    static const Operations* operationsFor() {
+        static const Operations operations = {
+            [](void* callable, Args&&... args) -> R { return std::invoke(*static_cast<F*>(callable), std::forward<Args>(args)...); },
+            [](void* target, const void* source) { new (target) F(*static_cast<const F*>(source)); },
+            [](void* target, void* source) noexcept { new (target) F(std::move(*static_cast<F*>(source))); },
+            [](void* callable) { static_cast<F*>(callable)->~F(); },
+        };
+        return &operations;
+    }
+
+    alignas(std::max_align_t) mutable unsigned char storage[Capacity];
+    const Operations* operations = nullptr; // Null while empty
+
+    void reset() noexcept {
+        if (operations) operations->destroy(storage);
+        operations = nullptr;
+    }
+
+public:
+    InplaceFunction() noexcept = default;
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    template <typename F, typename Callable = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same<Callable, InplaceFunction>::value &&
+                                          std::is_invocable_r<R, Callable&, Args...>::value>>
+    InplaceFunction(F&& callable) {
+        static_assert(sizeof(Callable) <= Capacity, "Callable too large for this InplaceFunction: raise Capacity");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "Callable over-aligned for InplaceFunction");
+        static_assert(std::is_copy_constructible<Callable>::value, "InplaceFunction needs a copyable callable");
+        static_assert(std::is_nothrow_move_constructible<Callable>::value,
+                      "InplaceFunction needs a callable whose move constructor is noexcept");
+        new (storage) Callable(std::forward<F>(callable));
+        operations = operationsFor<Callable>();
+    }
+
+    InplaceFunction(const InplaceFunction& other) {
+        if (other.operations) other.operations->copy(storage, other.storage);
+        operations = other.operations; // Only once the callable exists: a throwing copy leaves this empty
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept {
+        if (other.operations) other.operations->move(storage, other.storage);
+        operations = other.operations; // other keeps its moved-from callable until it is destroyed
+    }
+
+    InplaceFunction& operator=(const InplaceFunction& other) {
+        if (this != &other) {
+            reset();
+            if (other.operations) other.operations->copy(storage, other.storage);
+            operations = other.operations;
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            if (other.operations) other.operations->move(storage, other.storage);
+            operations = other.operations;
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    ~InplaceFunction() { reset(); }
+
+    explicit operator bool() const noexcept { return operations != nullptr; }
+
+    R operator()(Args... args) const {
+        if (!operations) throw std::bad_function_call();
+        return operations->call(storage, std::forward<Args>(args)...);
+    }
+};
+
+#endif // INPLACE_FUNCTION_H
@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include "FunctionRef.h"
+#include "InplaceFunction.h"
+#include "../../Benchmarks/AllocationCounter.h"
+
+using namespace std;
+
+/*
+Benchmark: the cost of calling through a callable parameter
+
+- Calls: a loop makes 100M calls of an int(int, int) callable (a * k + b, k captured) on
+  values from a small array and sums the results. The loop is in a function of its own that
+  the optimizer can't specialize for the callable, like a library function called with a
+  user's lambda:
+  - template: the callable's type is a template parameter, so its body is inlined into the
+    loop (which the optimizer may then unroll or vectorize);
+  - function pointer: a plain function (k is a global), one indirect call per call;
+  - std::function, FunctionRef, InplaceFunction: the type-erased wrappers.
+- Construct + call: 10M times a callable capturing three pointers (24 bytes, over
+  libstdc++'s 16-byte small-buffer limit) is wrapped and called once, the way a callback
+  parameter is used. Counts heap allocations (Benchmarks/AllocationCounter.h).
+- Results are ns per call (or per construct + call).
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static volatile int64_t sink; // Keeps the optimizer from deleting the loops
+
+constexpr int callCount = 100000000;
+constexpr int constructCount = 10000000;
+
+static int scale = 3; // Set from argc in main, so the optimizer can't fold it
+
+constexpr int inputCount = 1024;
+static int inputs[inputCount]; // Filled in main
+
+static int scaleAdd(int a, int b) { return a * scale + b; }
+
+// noipa: no inlining, cloning or constant propagation into these from the call site
+template <typename F>
+__attribute__((noipa)) int64_t callTemplate(F func) {
+    int64_t sum = 0;
+    for (int i = 0; i < callCount; ++i) sum += func(inputs[i % inputCount], i);
+    return sum;
+}
+
+__attribute__((noipa)) int64_t callPointer(int (*func)(int, int)) {
+    int64_t sum = 0;
+    for (int i = 0; i < callCount; ++i) sum += func(inputs[i % inputCount], i);
+    return sum;
+}
+
+__attribute__((noipa)) int64_t callStdFunction(const function<int(int, int)>& func) {
+    int64_t sum = 0;
+    for (int i = 0; i < callCount; ++i) sum += func(inputs[i % inputCount], i);
+    return sum;
+}
+
+__attribute__((noipa)) int64_t callFunctionRef(FunctionRef<int(int, int)> func) {
+    int64_t sum = 0;
+    for (int i = 0; i < callCount; ++i) sum += func(inputs[i % inputCount], i);
+    return sum;
+}
+
+__attribute__((noipa)) int64_t callInplaceFunction(const InplaceFunction<int(int, int)>& func) {
+    int64_t sum = 0;
+    for (int i = 0; i < callCount; ++i) sum += func(inputs[i % inputCount], i);
+    return sum;
+}
+
+// One call through a freshly wrapped callable
+__attribute__((noipa)) int callOnceStdFunction(function<int(int, int)> func, int a) { return func(a, 1); }
+__attribute__((noipa)) int callOnceFunctionRef(FunctionRef<int(int, int)> func, int a) { return func(a, 1); }
+__attribute__((noipa)) int callOnceInplaceFunction(InplaceFunction<int(int, int)> func, int a) { return func(a, 1); }
+
+template <typename Body>
+void measure(const char* name, int count, Body body) {
+    size_t allocationsBefore = bench::allocationsSoFar().calls;
+    auto start = chrono::steady_clock::now();
+    sink = body();
+    double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / count;
+    double allocations = double(bench::allocationsSoFar().calls - allocationsBefore) / count;
+    cout << "  " << name << ": " << ns << " ns, " << allocations << " allocations" << endl;
+}
+
+int main(int argc, char*[]) {
+    scale = 2 + argc;
+    int k = scale;
+    for (int i = 0; i < inputCount; ++i) inputs[i] = i * 7 % 100;
+    auto lambda = [k](int a, int b) { return a * k + b; };
+
+    cout << "100M calls:" << endl;
+    measure("template       ", callCount, [&] { return callTemplate(lambda); });
+    measure("function ptr   ", callCount, [&] { return callPointer(scaleAdd); });
+    function<int(int, int)> stdFunction = lambda;
+    measure("std::function  ", callCount, [&] { return callStdFunction(stdFunction); });
+    measure("FunctionRef    ", callCount, [&] { return callFunctionRef(lambda); });
+    InplaceFunction<int(int, int)> inplace = lambda;
+    measure("InplaceFunction", callCount, [&] { return callInplaceFunction(inplace); });
+
+    // Three captured pointers: too big for std::function's small buffer
+    int offset = 1, factor = k, bias = 0;
+    int *offsetPtr = &offset, *factorPtr = &factor, *biasPtr = &bias;
+    cout << "10M constructions + calls, capturing 24 bytes:" << endl;
+    measure("std::function  ", constructCount, [&] {
+        int64_t sum = 0;
+        for (int i = 0; i < constructCount; ++i) {
+            sum += callOnceStdFunction([offsetPtr, factorPtr, biasPtr](int a, int b) { return a * *factorPtr + b * *offsetPtr + *biasPtr; }, i);
+        }
+        return sum;
+    });
+    measure("FunctionRef    ", constructCount, [&] {
+        int64_t sum = 0;
+        for (int i = 0; i < constructCount; ++i) {
+            sum += callOnceFunctionRef([offsetPtr, factorPtr, biasPtr](int a, int b) { return a * *factorPtr + b * *offsetPtr + *biasPtr; }, i);
+        }
+        return sum;
+    });
+    measure("InplaceFunction", constructCount, [&] {
+        int64_t sum = 0;
+        for (int i = 0; i < constructCount; ++i) {
+            sum += callOnceInplaceFunction([offsetPtr, factorPtr, biasPtr](int a, int b) { return a * *factorPtr + b * *offsetPtr + *biasPtr; }, i);
+        }
+        return sum;
+    });
+    return 0;
+}
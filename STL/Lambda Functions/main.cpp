@@ -18,6 +18,16 @@
  * 5. **Capturing Variables**: Capturing local variables for use within the lambda.
  * 6. **Returning Lambdas**: Functions that return lambdas for flexible behavior.
  *
+ * **Passing and Storing Lambdas Without std::function**:
+ * - `std::function` copies the lambda into itself and may heap-allocate for its captures; every
+ *   call is an indirect call.
+ * - `FunctionRef<int(int, int)>` (FunctionRef.h) only refers to the lambda: two pointers, no
+ *   copy, no allocation. It is the type for parameters that are called right away.
+ * - `InplaceFunction<int(int, int)>` (InplaceFunction.h) owns a copy, like `std::function`, but
+ *   in a fixed buffer inside itself: it never allocates. It is the type for stored callbacks.
+ * - A template parameter (`auto` or `template <typename F>`) is still the fastest: the compiler
+ *   can inline the lambda. See benchmark.cpp.
+ *
  * This code showcases various use cases of lambda functions in C++.
  */
 
@@ -26,6 +36,8 @@
 #include <algorithm>
 #include <queue>
 #include <functional>
+#include "FunctionRef.h"
+#include "InplaceFunction.h"
 
 using namespace std;
 
@@ -98,12 +110,21 @@ int main() {
     auto subtract = returnLambda();
     cout << "Subtraction: " << subtract(10, 5) << endl; // Outputs: 5
 
-    // 7. Higher-Order Functions
-    auto higherOrderFunction = [](function<int(int, int)> func, int a, int b) {
+    // 7. Higher-Order Functions (FunctionRef: takes any callable, copies and allocates nothing)
+    auto higherOrderFunction = [](FunctionRef<int(int, int)> func, int a, int b) {
         return func(a, b);
     };
 
     cout << "Higher-order function result: " << higherOrderFunction(multiply, 4, 3) << endl; // Outputs: 12
+    cout << "Higher-order function with a capture: "
+         << higherOrderFunction([x](int a, int b) { return x * a + b; }, 4, 3) << endl; // Outputs: 43
+    cout << "Higher-order function with a function pointer: " << higherOrderFunction(ptr, 1, 2) << endl; // Outputs: 1
+
+    // 8. Storing Lambdas (InplaceFunction: owns the lambda in a fixed buffer, never allocates)
+    vector<InplaceFunction<int(int, int)>> operations = {add, multiply, subtract, [x, y](int a, int b) { return a * x + b * y; }};
+    cout << "Stored operations on (4, 3): ";
+    for (const auto& operation : operations) cout << operation(4, 3) << " "; // Outputs: 7 12 1 55
+    cout << endl;
 
     return 0;
 }
@@ -0,0 +1,149 @@
+#ifndef SINGLY_LINKED_LIST_H
+#define SINGLY_LINKED_LIST_H
+
+#include <iostream>
+#include "../Allocators/NodePool.h" // HeapNodeAllocator and NodePool
+
+// Node structure
+struct Node {
+    int data; // Data stored in the node
+    Node* next; // Pointer to the next node
+
+    // Node constructor
+    Node(int value) : data(value), next(nullptr) {}
+};
+
+// Singly Linked List class
+// Keeps a tail pointer and an element count so appends, size() and clear() don't
+// have to walk the list from the head every time.
+// NodeAllocator decides where nodes come from: plain new/delete or a NodePool.
+template <typename NodeAllocator>
+class BasicSinglyLinkedList {
+private:
+    NodeAllocator nodes; // Creates and destroys the nodes of this list
+    Node* head; // Pointer to the head of the list
+    Node* tail; // Pointer to the last node, for O(1) appends
+    int count; // Number of nodes, kept up to date by every insert/delete
+
+public:
+    // Constructor to initialize the linked list
+    BasicSinglyLinkedList() : head(nullptr), tail(nullptr), count(0) {}
+
+    // Destructor to clean up memory
+    ~BasicSinglyLinkedList() {
+        clear(); // Clear the list on destruction
+    }
+
+    // The list owns its nodes, so copying it would double-delete them
+    BasicSinglyLinkedList(const BasicSinglyLinkedList&) = delete;
+    BasicSinglyLinkedList& operator=(const BasicSinglyLinkedList&) = delete;
+
+    // Insert at the front of the list - O(1)
+    void push_front(int value) {
+        Node* newNode = nodes.create(value); // Create a new node
+        newNode->next = head;
+        head = newNode;
+        if (!tail) {
+            tail = newNode; // First node is both head and tail
+        }
+        count++;
+    }
+
+    // Insert at the end of the list - O(1) thanks to the tail pointer
+    void push_back(int value) {
+        Node* newNode = nodes.create(value); // Create a new node
+        if (!head) {
+            head = tail = newNode; // If list is empty, new node becomes the head
+        } else {
+            tail->next = newNode; // Link the new node after the current tail
+            tail = newNode;
+        }
+        count++;
+    }
+
+    // Insert at the end of the list
+    void insert(int value) {
+        push_back(value);
+    }
+
+    // Remove the first node - O(1)
+    void pop_front() {
+        if (!head) return; // List is empty
+        Node* temp = head;
+        head = head->next; // Move head to the next node
+        if (!head) {
+            tail = nullptr; // Removed the only node
+        }
+        nodes.destroy(temp); // Free memory
+        count--;
+    }
+
+    // First and last values (the list must not be empty)
+    int front() const { return head->data; }
+    int back() const { return tail->data; }
+
+    // Delete a specific value from the list
+    void deleteValue(int value) {
+        if (!head) return; // List is empty
+        if (head->data == value) {
+            pop_front(); // Node to be deleted is the head
+            return;
+        }
+        Node* current = head;
+        while (current->next && current->next->data != value) {
+            current = current->next; // Traverse to find the node to delete
+        }
+        if (current->next) {
+            Node* temp = current->next; // Node to be deleted
+            current->next = current->next->next; // Bypass the node
+            if (temp == tail) {
+                tail = current; // Deleted the last node
+            }
+            nodes.destroy(temp); // Free memory
+            count--;
+        }
+    }
+
+    // Print all elements in the list
+    void print() const {
+        Node* temp = head;
+        while (temp) {
+            std::cout << temp->data << " "; // Print data
+            temp = temp->next; // Move to the next node
+        }
+        std::cout << std::endl;
+    }
+
+    // Clear the entire list: one pass over the nodes, or O(chunks) with a pool
+    void clear() {
+        if constexpr (NodeAllocator::supportsBulkRelease) {
+            nodes.releaseAll(); // Free whole chunks, no per-node work
+            head = nullptr;
+        } else {
+            while (head) {
+                Node* temp = head;
+                head = head->next; // Unlink the node
+                nodes.destroy(temp); // Free memory
+            }
+        }
+        tail = nullptr;
+        count = 0;
+    }
+
+    // Get the size of the list - O(1)
+    int size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+};
+
+// Every node is its own new/delete
+using SinglyLinkedList = BasicSinglyLinkedList<HeapNodeAllocator<Node>>;
+
+// Nodes are carved out of contiguous chunks, and clear() frees whole chunks
+using PooledSinglyLinkedList = BasicSinglyLinkedList<NodePool<Node>>;
+
+#endif // SINGLY_LINKED_LIST_H
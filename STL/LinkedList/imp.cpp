@@ -1,93 +1,8 @@
 #include <iostream>
+#include "SinglyLinkedList.h"
 
 using namespace std;
 
-// Node structure
-struct Node {
-    int data; // Data stored in the node
-    Node* next; // Pointer to the next node
-
-    // Node constructor
-    Node(int value) : data(value), next(nullptr) {}
-};
-
-// Singly Linked List class
-class SinglyLinkedList {
-private:
-    Node* head; // Pointer to the head of the list
-
-public:
-    // Constructor to initialize the linked list
-    SinglyLinkedList() : head(nullptr) {}
-
-    // Destructor to clean up memory
-    ~SinglyLinkedList() {
-        clear(); // Clear the list on destruction
-    }
-
-    // Insert at the end of the list
-    void insert(int value) {
-        Node* newNode = new Node(value); // Create a new node
-        if (!head) {
-            head = newNode; // If list is empty, new node becomes the head
-            return;
-        }
-        Node* temp = head;
-        while (temp->next) {
-            temp = temp->next; // Traverse to the end of the list
-        }
-        temp->next = newNode; // Link the new node
-    }
-
-    // Delete a specific value from the list
-    void deleteValue(int value) {
-        if (!head) return; // List is empty
-        if (head->data == value) {
-            Node* temp = head; // Node to be deleted is the head
-            head = head->next; // Move head to the next node
-            delete temp; // Free memory
-            return;
-        }
-        Node* current = head;
-        while (current->next && current->next->data != value) {
-            current = current->next; // Traverse to find the node to delete
-        }
-        if (current->next) {
-            Node* temp = current->next; // Node to be deleted
-            current->next = current->next->next; // Bypass the node
-            delete temp; // Free memory
-        }
-    }
-
-    // Print all elements in the list
-    void print() const {
-        Node* temp = head;
-        while (temp) {
-            cout << temp->data << " "; // Print data
-            temp = temp->next; // Move to the next node
-        }
-        cout << endl;
-    }
-
-    // Clear the entire list
-    void clear() {
-        while (head) {
-            deleteValue(head->data); // Delete each node
-        }
-    }
-
-    // Get the size of the list
-    int size() const {
-        int count = 0;
-        Node* temp = head;
-        while (temp) {
-            count++; // Count each node
-            temp = temp->next; // Move to the next node
-        }
-        return count;
-    }
-};
-
 // Main function to demonstrate the usage
 int main() {
     SinglyLinkedList list; // Create a linked list
@@ -112,10 +27,39 @@ int main() {
     // Getting the size of the list
     cout << "Size of the list: " << list.size() << endl; // Output: 2
 
+    // O(1) operations at both ends
+    list.push_front(5);
+    list.push_back(40);
+    cout << "List after push_front(5) and push_back(40): ";
+    list.print(); // Output: 5 10 30 40
+    cout << "Front: " << list.front() << ", Back: " << list.back() << endl; // Output: 5, 40
+
+    list.pop_front();
+    cout << "List after pop_front: ";
+    list.print(); // Output: 10 30 40
+
+    // Deleting the last value keeps the tail pointer valid
+    list.deleteValue(40);
+    list.push_back(50);
+    cout << "List after deleting 40 and pushing 50: ";
+    list.print(); // Output: 10 30 50
+
     // Clearing the list
     list.clear();
     cout << "List after clearing: ";
     list.print(); // Output: (empty)
 
+    // Same list backed by a node pool: 1000 nodes come from 4 chunks of 256
+    PooledSinglyLinkedList pooled;
+    for (int i = 0; i < 1000; ++i) {
+        pooled.push_back(i);
+    }
+    pooled.deleteValue(500); // Freed node goes on the pool's free list
+    pooled.push_front(-1); // ...and is reused here
+    cout << "Pooled list size: " << pooled.size() << ", front: " << pooled.front()
+         << ", back: " << pooled.back() << endl; // Output: 1000, -1, 999
+    pooled.clear(); // Releases 4 chunks instead of 1000 nodes
+    cout << "Pooled list size after clearing: " << pooled.size() << endl; // Output: 0
+
     return 0;
 }
@@ -0,0 +1,239 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <cstddef> // For size_t
+#include <cstdint> // For uint32_t
+#include <functional> // For std::less
+#include <limits>
+#include <stdexcept> // For std::length_error, std::out_of_range
+#include <utility> // For std::move
+#include <vector>
+#include "../Allocators/CacheLineAllocator.h"
+
+/*
+Notes about IndexedHeap:
+
+1. **Handles and decrease-key**:
+   - push() returns a handle that stays valid until that element is popped or erased. The heap
+     keeps, for every handle, the element's current position in the heap array, so
+     decrease_key/increase_key/erase find the element in O(1) and then sift it, O(log n).
+   - With std::priority_queue the only way to change a priority is to push a duplicate and skip
+     stale entries when they come out (lazy deletion): the heap grows with every update.
+
+2. **Min-Heap by Default**:
+   - Unlike std::priority_queue, top() is the *smallest* element under Compare (what schedulers
+     and Dijkstra want). Use std::greater<T> for a max-heap.
+   - decrease_key(h, v): v comes before the old value in Compare order, the element moves up.
+     increase_key(h, v): the opposite, it moves down. update(h, v) works out the direction itself.
+
+3. **4-ary Layout**:
+   - Every node has Arity (default 4) children instead of 2, so the heap is half as deep: push and
+     decrease_key (which move up) touch half as many levels. pop compares 4 children per level,
+     but those 4 sit next to each other in memory.
+   - The array starts Arity - 1 entries before a 64-byte boundary, which puts every group of
+     siblings at a multiple of Arity entries. With 16-byte entries (e.g. a double and a
+     handle) the 4 children of a node are exactly one cache line.
+
+4. **Bulk Build**:
+   - push_range() appends a whole range and, when that is a large part of the heap, rebuilds it
+     bottom-up (Floyd's heapify, O(n)) instead of sifting every element up (O(n log n)).
+*/
+
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class IndexedHeap {
+    static_assert(Arity >= 2, "a heap node needs at least two children");
+
+public:
+    using Handle = uint32_t;
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+private:
+    struct Entry {
+        T value;
+        Handle handle;
+    };
+
+    static constexpr size_t padding = Arity - 1; // Heap index i lives at entries[i + padding]
+
+    std::vector<Entry, CacheLineAllocator<Entry>> entries; // [0, padding) unused, then the heap
+    std::vector<uint32_t> positions; // Heap index of every handle, npos if it isn't in the heap
+    std::vector<Handle> freeHandles; // Handles of popped/erased elements, reused by push
+    Compare before;
+
+    Entry& at(size_t index) { return entries[index + padding]; }
+    const Entry& at(size_t index) const { return entries[index + padding]; }
+
+    static size_t parentOf(size_t index) { return (index - 1) / Arity; }
+    static size_t firstChildOf(size_t index) { return index * Arity + 1; }
+
+    // Moves the element at index towards the root, shifting parents down into the hole
+    void siftUp(size_t index) {
+        Entry moving = std::move(at(index));
+        while (index > 0) {
+            size_t parent = parentOf(index);
+            if (!before(moving.value, at(parent).value)) break;
+            at(index) = std::move(at(parent));
+            positions[at(index).handle] = static_cast<uint32_t>(index);
+            index = parent;
+        }
+        positions[moving.handle] = static_cast<uint32_t>(index);
+        at(index) = std::move(moving);
+    }
+
+    // Moves the element at index towards the leaves, pulling the best child up each level
+    void siftDown(size_t index) {
+        size_t count = size();
+        Entry moving = std::move(at(index));
+        while (true) {
+            size_t first = firstChildOf(index);
+            if (first >= count) break;
+            size_t last = first + Arity < count ? first + Arity : count;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                if (before(at(child).value, at(best).value)) best = child;
+            }
+            if (!before(at(best).value, moving.value)) break;
+            at(index) = std::move(at(best));
+            positions[at(index).handle] = static_cast<uint32_t>(index);
+            index = best;
+        }
+        positions[moving.handle] = static_cast<uint32_t>(index);
+        at(index) = std::move(moving);
+    }
+
+    Handle newHandle(bool reuse) {
+        if (reuse && !freeHandles.empty()) {
+            Handle handle = freeHandles.back();
+            freeHandles.pop_back();
+            return handle;
+        }
+        if (positions.size() >= npos) throw std::length_error("IndexedHeap: out of handles");
+        positions.push_back(npos);
+        return static_cast<Handle>(positions.size() - 1);
+    }
+
+    uint32_t positionOf(Handle handle) const {
+        if (!contains(handle)) throw std::out_of_range("IndexedHeap: handle is not in the heap");
+        return positions[handle];
+    }
+
+    // Take the element at index out of the heap, filling its place with the last one
+    void removeAt(size_t index) {
+        Handle handle = at(index).handle;
+        size_t last = size() - 1;
+        if (index != last) {
+            at(index) = std::move(at(last));
+            positions[at(index).handle] = static_cast<uint32_t>(index);
+        }
+        entries.pop_back();
+        positions[handle] = npos;
+        freeHandles.push_back(handle);
+        if (index < size()) {
+            if (index > 0 && before(at(index).value, at(parentOf(index)).value)) {
+                siftUp(index);
+            } else {
+                siftDown(index);
+            }
+        }
+    }
+
+public:
+    IndexedHeap() : entries(padding) {}
+
+    explicit IndexedHeap(const Compare& compare) : entries(padding), before(compare) {}
+
+    size_t size() const { return entries.size() - padding; }
+    bool empty() const { return size() == 0; }
+
+    void reserve(size_t count) {
+        entries.reserve(count + padding);
+        positions.reserve(count);
+    }
+
+    void clear() {
+        entries.resize(padding);
+        positions.clear();
+        freeHandles.clear();
+    }
+
+    // The first element in Compare order (the smallest by default)
+    const T& top() const { return at(0).value; }
+    Handle topHandle() const { return at(0).handle; }
+
+    bool contains(Handle handle) const {
+        return handle < positions.size() && positions[handle] != npos;
+    }
+
+    const T& value(Handle handle) const { return at(positionOf(handle)).value; }
+
+    Handle push(T value) {
+        if (size() >= npos) throw std::length_error("IndexedHeap: too many elements");
+        Handle handle = newHandle(true);
+        entries.push_back(Entry{std::move(value), handle});
+        siftUp(size() - 1);
+        return handle;
+    }
+
+    template <typename... Args>
+    Handle emplace(Args&&... args) {
+        return push(T(std::forward<Args>(args)...));
+    }
+
+    // Adds every element of [first, last). Their handles are consecutive: the returned one,
+    // the returned one + 1, ... (freed handles are not reused here).
+    template <typename InputIt>
+    Handle push_range(InputIt first, InputIt last) {
+        size_t oldSize = size();
+        Handle firstHandle = static_cast<Handle>(positions.size());
+        for (; first != last; ++first) {
+            Handle handle = newHandle(false);
+            entries.push_back(Entry{*first, handle});
+            positions[handle] = static_cast<uint32_t>(size() - 1);
+        }
+        size_t added = size() - oldSize;
+        if (added > oldSize) {
+            for (size_t i = size() / Arity + 1; i-- > 0;) { // Floyd: sift down every inner node, bottom-up
+                if (firstChildOf(i) < size()) siftDown(i);
+            }
+        } else {
+            for (size_t i = oldSize; i < size(); ++i) siftUp(i); // Few new elements: sift just those
+        }
+        return firstHandle;
+    }
+
+    void pop() {
+        removeAt(0);
+    }
+
+    void erase(Handle handle) {
+        removeAt(positionOf(handle));
+    }
+
+    // value comes before the current one in Compare order: the element moves up
+    void decrease_key(Handle handle, T value) {
+        size_t index = positionOf(handle);
+        at(index).value = std::move(value);
+        siftUp(index);
+    }
+
+    // value comes after the current one in Compare order: the element moves down
+    void increase_key(Handle handle, T value) {
+        size_t index = positionOf(handle);
+        at(index).value = std::move(value);
+        siftDown(index);
+    }
+
+    // Either direction
+    void update(Handle handle, T value) {
+        size_t index = positionOf(handle);
+        bool up = before(value, at(index).value);
+        at(index).value = std::move(value);
+        if (up) {
+            siftUp(index);
+        } else {
+            siftDown(index);
+        }
+    }
+};
+
+#endif // INDEXED_HEAP_H
@@ -0,0 +1,154 @@
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+#include "IndexedHeap.h"
+
+using namespace std;
+
+/*
+Benchmark: Dijkstra with std::priority_queue vs IndexedHeap
+
+- A random directed graph (every vertex gets `degree` edges to random vertices, weights 1..1000),
+  shortest paths from vertex 0, once on a sparse and once on a dense graph.
+- std::priority_queue: the textbook lazy version. Every relaxation pushes (distance, vertex) and
+  stale entries are skipped when popped, so the heap holds up to one entry per edge.
+- IndexedHeap: one entry per vertex; a relaxation of a queued vertex is a decrease_key.
+  Run with the default 4-ary layout and with Arity = 2 to show what the wider nodes buy.
+- Also: building a heap of 1M random values with push() one by one vs push_range().
+- Every run checks that it found the same distances.
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+struct Graph {
+    vector<uint32_t> firstEdge; // Edges of v are [firstEdge[v], firstEdge[v + 1])
+    vector<uint32_t> target;
+    vector<uint32_t> weight;
+};
+
+static Graph randomGraph(uint32_t vertices, uint32_t degree, mt19937& random) {
+    Graph graph;
+    graph.firstEdge.resize(vertices + 1);
+    for (uint32_t v = 0; v <= vertices; ++v) graph.firstEdge[v] = v * degree;
+    graph.target.resize(size_t(vertices) * degree);
+    graph.weight.resize(size_t(vertices) * degree);
+    for (size_t e = 0; e < graph.target.size(); ++e) {
+        graph.target[e] = random() % vertices;
+        graph.weight[e] = 1 + random() % 1000;
+    }
+    return graph;
+}
+
+static constexpr uint64_t unreached = numeric_limits<uint64_t>::max();
+
+static vector<uint64_t> lazyDijkstra(const Graph& graph, size_t& peakSize) {
+    vector<uint64_t> distance(graph.firstEdge.size() - 1, unreached);
+    using Item = pair<uint64_t, uint32_t>; // (distance, vertex)
+    priority_queue<Item, vector<Item>, greater<Item>> queue;
+    distance[0] = 0;
+    queue.push({0, 0});
+    peakSize = 1;
+    while (!queue.empty()) {
+        auto [d, v] = queue.top();
+        queue.pop();
+        if (d != distance[v]) continue; // Stale duplicate
+        for (uint32_t e = graph.firstEdge[v]; e < graph.firstEdge[v + 1]; ++e) {
+            uint64_t candidate = d + graph.weight[e];
+            uint32_t next = graph.target[e];
+            if (candidate < distance[next]) {
+                distance[next] = candidate;
+                queue.push({candidate, next});
+                if (queue.size() > peakSize) peakSize = queue.size();
+            }
+        }
+    }
+    return distance;
+}
+
+template <size_t Arity>
+static vector<uint64_t> indexedDijkstra(const Graph& graph, size_t& peakSize) {
+    size_t vertices = graph.firstEdge.size() - 1;
+    vector<uint64_t> distance(vertices, unreached);
+    using Item = pair<uint64_t, uint32_t>;
+    using Heap = IndexedHeap<Item, less<Item>, Arity>;
+    Heap queue;
+    vector<typename Heap::Handle> handle(vertices, Heap::npos); // Handle of every queued vertex
+    distance[0] = 0;
+    handle[0] = queue.push({0, 0});
+    peakSize = 1;
+    while (!queue.empty()) {
+        auto [d, v] = queue.top();
+        queue.pop();
+        for (uint32_t e = graph.firstEdge[v]; e < graph.firstEdge[v + 1]; ++e) {
+            uint64_t candidate = d + graph.weight[e];
+            uint32_t next = graph.target[e];
+            if (candidate < distance[next]) {
+                bool queued = distance[next] != unreached; // Reached but not settled: still in the heap
+                distance[next] = candidate;
+                if (queued) {
+                    queue.decrease_key(handle[next], {candidate, next});
+                } else {
+                    handle[next] = queue.push({candidate, next});
+                    if (queue.size() > peakSize) peakSize = queue.size();
+                }
+            }
+        }
+    }
+    return distance;
+}
+
+template <typename Func>
+static double milliseconds(Func&& func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+static void dijkstra(uint32_t vertices, uint32_t degree, mt19937& random) {
+    Graph graph = randomGraph(vertices, degree, random);
+    cout << "Dijkstra, " << vertices << " vertices, " << graph.target.size() << " edges:" << endl;
+
+    vector<uint64_t> expected;
+    size_t peak = 0;
+    double ms = milliseconds([&] { expected = lazyDijkstra(graph, peak); });
+    cout << "  std::priority_queue (lazy): " << ms << " ms, peak heap size " << peak << endl;
+
+    auto report = [&](const char* name, auto run) {
+        vector<uint64_t> distance;
+        double ms = milliseconds([&] { distance = run(graph, peak); });
+        cout << "  " << name << ": " << ms << " ms, peak heap size " << peak
+             << (distance == expected ? "" : "  WRONG DISTANCES") << endl;
+    };
+    report("IndexedHeap, 4-ary       ", indexedDijkstra<4>);
+    report("IndexedHeap, binary      ", indexedDijkstra<2>);
+}
+
+int main() {
+    mt19937 random(7);
+    dijkstra(1000000, 4, random);
+    dijkstra(100000, 64, random);
+
+    vector<double> values(1000000);
+    for (double& value : values) value = random();
+    cout << "Building a heap of " << values.size() << " values:" << endl;
+    {
+        IndexedHeap<double> heap;
+        double ms = milliseconds([&] {
+            for (double value : values) heap.push(value);
+        });
+        cout << "  push() one by one: " << ms << " ms" << endl;
+    }
+    {
+        IndexedHeap<double> heap;
+        double ms = milliseconds([&] { heap.push_range(values.begin(), values.end()); });
+        cout << "  push_range():      " << ms << " ms" << endl;
+    }
+    return 0;
+}
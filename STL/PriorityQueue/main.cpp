@@ -2,6 +2,7 @@
 #include <queue>
 #include <vector>
 #include <functional>
+#include "IndexedHeap.h"
 
 using namespace std;
 
@@ -20,6 +21,12 @@ using namespace std;
  *      - empty(): Checks if the priority queue is empty.
  *      - size(): Returns the number of elements in the priority queue.
  *      - swap(other): Swaps the contents with another priority queue.
+ *
+ * 2. **Changing a Priority**:
+ *    - std::priority_queue can't find or change an element once it is queued. The usual workaround is to push
+ *      the element again with its new priority and skip the stale copy when it reaches the top.
+ *    - IndexedHeap (IndexedHeap.h) hands out a handle on push, so decrease_key/increase_key/erase can reach
+ *      the element directly. It is a 4-ary min-heap by default (see benchmark.cpp for Dijkstra with both).
  */
 
 void priorityQueueUsage() {
@@ -52,7 +59,31 @@ void priorityQueueUsage() {
     cout << endl;
 }
 
+void indexedHeapUsage() {
+    IndexedHeap<int> tasks; // Min heap: the smallest priority is on top
+    auto build = tasks.push(30);
+    auto test = tasks.push(20);
+    auto deploy = tasks.push(40);
+    auto lint = tasks.push(25);
+
+    tasks.decrease_key(deploy, 5); // deploy becomes urgent
+    tasks.increase_key(test, 35); // test can wait
+    tasks.erase(lint); // lint is no longer needed
+    cout << "build is queued with priority " << tasks.value(build) << endl; // Output: 30
+
+    vector<int> more = {50, 1, 45};
+    tasks.push_range(more.begin(), more.end()); // Bulk insert
+
+    cout << "Indexed Heap elements:\n";
+    while (!tasks.empty()) {
+        cout << tasks.top() << " "; // Output: 1 5 30 35 45 50
+        tasks.pop();
+    }
+    cout << endl;
+}
+
 int main() {
     priorityQueueUsage();
+    indexedHeapUsage();
     return 0;
 }
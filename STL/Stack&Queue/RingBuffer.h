@@ -0,0 +1,322 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef> // For size_t
+#include <memory> // For std::unique_ptr
+#include <new> // For placement new
+#include <stdexcept> // For std::invalid_argument
+#include <thread> // For std::this_thread::yield
+#include <utility> // For std::move, std::forward
+
+/*
+Notes about the lock-free ring buffers:
+
+1. **Bounded and Allocation-Free**:
+   - The capacity is fixed at construction (rounded up to a power of two, so a position is
+     turned into a slot index with a mask instead of a division). push/pop never allocate;
+     when the buffer is full try_push returns false and the producer decides what to do.
+   - std::queue (on std::deque) allocates a new chunk every few hundred elements and needs a
+     mutex around it to be shared between threads, so every push and pop serializes on it.
+
+2. **SpscRingBuffer (one producer thread, one consumer thread)**:
+   - The producer only writes `tail`, the consumer only writes `head`: no compare-and-swap,
+     just one release store per operation.
+   - Each side also keeps a private copy of the other side's index and only re-reads the real
+     one when the copy says the buffer is full (or empty). Most operations don't touch the
+     other core's cache line at all.
+
+3. **MpmcRingBuffer (any number of producers and consumers)**:
+   - Every slot carries a sequence number that says whose turn it is: slot i is free for the
+     producer of position p when sequence == p, and holds the element of position p when
+     sequence == p + 1. Producers claim a position with a compare-and-swap on `tail`,
+     consumers on `head` (Dmitry Vyukov's bounded queue). A stalled thread only holds up
+     the one slot it claimed.
+
+4. **False Sharing**:
+   - `head` and `tail` are each on their own cache line, away from the read-only mask and
+     slot pointer. Without the padding every push would invalidate the consumer's cache line
+     and every pop the producer's, even though they write different variables.
+
+5. **Batches**:
+   - try_push_batch/try_pop_batch move up to `count` elements with one index update (one
+     compare-and-swap for the MPMC buffer) instead of one per element, and return how many
+     they moved. push()/pop() spin (yielding the CPU) until they succeed.
+*/
+
+constexpr size_t ringBufferCacheLine = 64;
+
+namespace ring_buffer_detail {
+
+inline size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+// An atomic index alone on its cache line
+struct alignas(ringBufferCacheLine) PaddedIndex {
+    std::atomic<size_t> value{0};
+};
+
+} // namespace ring_buffer_detail
+
+template <typename T>
+class SpscRingBuffer {
+private:
+    struct Storage {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    // Consumer side: the next position to pop, and what it last saw of tail
+    struct alignas(ringBufferCacheLine) ConsumerState {
+        std::atomic<size_t> head{0};
+        size_t cachedTail = 0;
+    };
+    // Producer side: the next position to push, and what it last saw of head
+    struct alignas(ringBufferCacheLine) ProducerState {
+        std::atomic<size_t> tail{0};
+        size_t cachedHead = 0;
+    };
+
+    ConsumerState consumer;
+    ProducerState producer;
+    const size_t mask;
+    std::unique_ptr<Storage[]> slots;
+
+    T* slot(size_t position) { return reinterpret_cast<T*>(&slots[position & mask]); }
+
+    // Free slots from the producer's point of view, re-reading head only when needed
+    size_t freeSlots(size_t tail, size_t wanted) {
+        size_t free = capacity() - (tail - producer.cachedHead);
+        if (free < wanted) {
+            producer.cachedHead = consumer.head.load(std::memory_order_acquire);
+            free = capacity() - (tail - producer.cachedHead);
+        }
+        return free;
+    }
+
+    // Filled slots from the consumer's point of view, re-reading tail only when needed
+    size_t filledSlots(size_t head, size_t wanted) {
+        size_t filled = consumer.cachedTail - head;
+        if (filled < wanted) {
+            consumer.cachedTail = producer.tail.load(std::memory_order_acquire);
+            filled = consumer.cachedTail - head;
+        }
+        return filled;
+    }
+
+public:
+    explicit SpscRingBuffer(size_t capacity)
+        : mask(ring_buffer_detail::roundUpToPowerOfTwo(capacity) - 1), slots(new Storage[mask + 1]) {
+        if (capacity == 0) throw std::invalid_argument("SpscRingBuffer: capacity must be positive");
+    }
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    ~SpscRingBuffer() {
+        size_t tail = producer.tail.load(std::memory_order_acquire);
+        for (size_t head = consumer.head.load(std::memory_order_relaxed); head != tail; ++head) {
+            slot(head)->~T();
+        }
+    }
+
+    size_t capacity() const { return mask + 1; }
+
+    // Only exact while neither side is running
+    size_t size_approx() const {
+        return producer.tail.load(std::memory_order_acquire) - consumer.head.load(std::memory_order_acquire);
+    }
+
+    // Producer thread only
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t tail = producer.tail.load(std::memory_order_relaxed);
+        if (freeSlots(tail, 1) == 0) return false;
+        new (slot(tail)) T(std::forward<Args>(args)...);
+        producer.tail.store(tail + 1, std::memory_order_release); // Publishes the element
+        return true;
+    }
+
+    bool try_push(const T& value) { return try_emplace(value); }
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    void push(T value) {
+        while (!try_push(std::move(value))) std::this_thread::yield();
+    }
+
+    // Copies (moves) up to count elements from values; returns how many fit
+    size_t try_push_batch(T* values, size_t count) {
+        size_t tail = producer.tail.load(std::memory_order_relaxed);
+        size_t free = freeSlots(tail, count);
+        if (count > free) count = free;
+        for (size_t i = 0; i < count; ++i) {
+            new (slot(tail + i)) T(std::move(values[i]));
+        }
+        producer.tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer thread only
+    bool try_pop(T& value) {
+        size_t head = consumer.head.load(std::memory_order_relaxed);
+        if (filledSlots(head, 1) == 0) return false;
+        T* element = slot(head);
+        value = std::move(*element);
+        element->~T();
+        consumer.head.store(head + 1, std::memory_order_release); // Hands the slot back
+        return true;
+    }
+
+    void pop(T& value) {
+        while (!try_pop(value)) std::this_thread::yield();
+    }
+
+    // Moves up to count elements into values; returns how many there were
+    size_t try_pop_batch(T* values, size_t count) {
+        size_t head = consumer.head.load(std::memory_order_relaxed);
+        size_t filled = filledSlots(head, count);
+        if (count > filled) count = filled;
+        for (size_t i = 0; i < count; ++i) {
+            T* element = slot(head + i);
+            values[i] = std::move(*element);
+            element->~T();
+        }
+        consumer.head.store(head + count, std::memory_order_release);
+        return count;
+    }
+};
+
+template <typename T>
+class MpmcRingBuffer {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() { return reinterpret_cast<T*>(storage); }
+    };
+
+    ring_buffer_detail::PaddedIndex head; // Next position to pop
+    ring_buffer_detail::PaddedIndex tail; // Next position to push
+    const size_t mask;
+    std::unique_ptr<Cell[]> cells;
+
+    Cell& cellAt(size_t position) { return cells[position & mask]; }
+
+    // Claim up to count consecutive positions whose cell sequence is `position + offset` (0: free
+    // for a producer, 1: filled for a consumer). Returns the first claimed position and sets count.
+    size_t claim(ring_buffer_detail::PaddedIndex& index, size_t offset, size_t& count) {
+        size_t position = index.value.load(std::memory_order_relaxed);
+        while (true) {
+            size_t ready = 0;
+            while (ready < count) {
+                size_t sequence = cellAt(position + ready).sequence.load(std::memory_order_acquire);
+                if (sequence != position + ready + offset) break;
+                ++ready;
+            }
+            if (ready == 0) {
+                size_t sequence = cellAt(position).sequence.load(std::memory_order_acquire);
+                // Behind position: the buffer is full (or empty). Ahead: someone claimed it, retry.
+                if (static_cast<std::ptrdiff_t>(sequence - (position + offset)) < 0) {
+                    count = 0;
+                    return position;
+                }
+                position = index.value.load(std::memory_order_relaxed);
+                continue;
+            }
+            // Cells that were ready stay ready until claimed, so winning this is enough
+            if (index.value.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+                count = ready;
+                return position;
+            }
+        }
+    }
+
+public:
+    // At least 2 slots: with one, "free for this lap" and "filled last lap" have the same sequence
+    explicit MpmcRingBuffer(size_t capacity)
+        : mask(ring_buffer_detail::roundUpToPowerOfTwo(capacity < 2 ? 2 : capacity) - 1), cells(new Cell[mask + 1]) {
+        if (capacity == 0) throw std::invalid_argument("MpmcRingBuffer: capacity must be positive");
+        for (size_t i = 0; i <= mask; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+    ~MpmcRingBuffer() {
+        size_t tail = this->tail.value.load(std::memory_order_acquire);
+        for (size_t head = this->head.value.load(std::memory_order_relaxed); head != tail; ++head) {
+            cellAt(head).value()->~T();
+        }
+    }
+
+    size_t capacity() const { return mask + 1; }
+
+    size_t size_approx() const {
+        size_t popped = head.value.load(std::memory_order_acquire);
+        size_t pushed = tail.value.load(std::memory_order_acquire);
+        return pushed > popped ? pushed - popped : 0;
+    }
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_t count = 1;
+        size_t position = claim(tail, 0, count);
+        if (count == 0) return false;
+        Cell& cell = cellAt(position);
+        new (cell.value()) T(std::forward<Args>(args)...);
+        cell.sequence.store(position + 1, std::memory_order_release); // Filled
+        return true;
+    }
+
+    bool try_push(const T& value) { return try_emplace(value); }
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    void push(T value) {
+        while (!try_push(std::move(value))) std::this_thread::yield();
+    }
+
+    // Moves up to count elements from values; returns how many fit
+    size_t try_push_batch(T* values, size_t count) {
+        size_t position = claim(tail, 0, count);
+        for (size_t i = 0; i < count; ++i) {
+            Cell& cell = cellAt(position + i);
+            new (cell.value()) T(std::move(values[i]));
+            cell.sequence.store(position + i + 1, std::memory_order_release);
+        }
+        return count;
+    }
+
+    bool try_pop(T& value) {
+        size_t count = 1;
+        size_t position = claim(head, 1, count);
+        if (count == 0) return false;
+        Cell& cell = cellAt(position);
+        value = std::move(*cell.value());
+        cell.value()->~T();
+        cell.sequence.store(position + capacity(), std::memory_order_release); // Free for the next lap
+        return true;
+    }
+
+    void pop(T& value) {
+        while (!try_pop(value)) std::this_thread::yield();
+    }
+
+    // Moves up to count elements into values; returns how many there were
+    size_t try_pop_batch(T* values, size_t count) {
+        size_t position = claim(head, 1, count);
+        for (size_t i = 0; i < count; ++i) {
+            Cell& cell = cellAt(position + i);
+            values[i] = std::move(*cell.value());
+            cell.value()->~T();
+            cell.sequence.store(position + i + capacity(), std::memory_order_release);
+        }
+        return count;
+    }
+};
+
+#endif // RING_BUFFER_H
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RingBuffer.h"
+
+using namespace std;
+
+/*
+Benchmark: passing work items between threads
+
+- P producer threads push 1M items in total, C consumer threads pop them all; P = C = 1, 2,
+  4, ... 32 (2 to 64 threads).
+- Queues: std::queue behind a std::mutex (what we use today), MpmcRingBuffer one item at a
+  time and in batches of 32, and for P = C = 1 also SpscRingBuffer (single and batched).
+  The ring buffers hold 1024 items; a full or empty queue makes the thread yield and retry.
+- Throughput is items per second over the whole run. Latency is push-to-pop time, sampled on
+  every 64th item (p50 / p99). With more threads than cores the numbers mostly measure the
+  scheduler, which is still worth knowing.
+- Pass a thread count limit as the first argument (e.g. `./benchmark 8`).
+
+Build: g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+*/
+
+struct WorkItem {
+    uint64_t id = 0;
+    int64_t sentNs = 0; // Non-zero on sampled items
+};
+
+static int64_t nowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Today's version: every operation takes the lock
+class MutexQueue {
+private:
+    mutex lock;
+    queue<WorkItem> items;
+
+public:
+    explicit MutexQueue(size_t) {}
+
+    bool try_push(const WorkItem& item) {
+        lock_guard<mutex> guard(lock);
+        items.push(item);
+        return true;
+    }
+
+    bool try_pop(WorkItem& item) {
+        lock_guard<mutex> guard(lock);
+        if (items.empty()) return false;
+        item = items.front();
+        items.pop();
+        return true;
+    }
+};
+
+static const size_t totalItems = 1000000;
+static const size_t batchSize = 32;
+static const size_t sampleEvery = 64;
+
+template <typename Queue, bool Batched>
+void run(const char* name, size_t producers, size_t consumers) {
+    Queue queue(1024);
+    atomic<size_t> consumed{0};
+    vector<vector<int64_t>> latencies(consumers);
+    vector<thread> threads;
+    int64_t start = nowNs();
+
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            size_t first = totalItems * p / producers, last = totalItems * (p + 1) / producers;
+            WorkItem batch[batchSize];
+            for (size_t id = first; id < last;) {
+                if constexpr (Batched) {
+                    size_t count = min(batchSize, last - id);
+                    for (size_t i = 0; i < count; ++i) {
+                        batch[i].id = id + i;
+                        batch[i].sentNs = (id + i) % sampleEvery == 0 ? nowNs() : 0;
+                    }
+                    size_t pushed = 0;
+                    while (pushed < count) {
+                        size_t now = queue.try_push_batch(batch + pushed, count - pushed);
+                        if (now == 0) this_thread::yield();
+                        pushed += now;
+                    }
+                    id += count;
+                } else {
+                    WorkItem item{id, id % sampleEvery == 0 ? nowNs() : 0};
+                    while (!queue.try_push(item)) this_thread::yield();
+                    ++id;
+                }
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            WorkItem batch[batchSize];
+            while (consumed.load(memory_order_relaxed) < totalItems) {
+                size_t count;
+                if constexpr (Batched) {
+                    count = queue.try_pop_batch(batch, batchSize);
+                } else {
+                    count = queue.try_pop(batch[0]) ? 1 : 0;
+                }
+                if (count == 0) {
+                    this_thread::yield();
+                    continue;
+                }
+                for (size_t i = 0; i < count; ++i) {
+                    if (batch[i].sentNs != 0) latencies[c].push_back(nowNs() - batch[i].sentNs);
+                }
+                consumed.fetch_add(count, memory_order_relaxed);
+            }
+        });
+    }
+    for (thread& t : threads) t.join();
+    double seconds = (nowNs() - start) / 1e9;
+
+    vector<int64_t> all;
+    for (auto& list : latencies) all.insert(all.end(), list.begin(), list.end());
+    sort(all.begin(), all.end());
+    auto percentile = [&](double p) { return all.empty() ? 0.0 : all[size_t(p * (all.size() - 1))] / 1000.0; };
+    cout << "  " << name << ": " << totalItems / seconds / 1e6 << " M items/s, latency p50 " << percentile(0.5)
+         << " us, p99 " << percentile(0.99) << " us" << endl;
+}
+
+int main(int argc, char** argv) {
+    size_t maxThreads = argc > 1 ? strtoul(argv[1], nullptr, 10) : 64;
+    for (size_t side = 1; side * 2 <= maxThreads; side *= 2) {
+        cout << side << " producer(s), " << side << " consumer(s):" << endl;
+        run<MutexQueue, false>("mutex + std::queue ", side, side);
+        run<MpmcRingBuffer<WorkItem>, false>("MpmcRingBuffer     ", side, side);
+        run<MpmcRingBuffer<WorkItem>, true>("MpmcRingBuffer x32 ", side, side);
+        if (side == 1) {
+            run<SpscRingBuffer<WorkItem>, false>("SpscRingBuffer     ", side, side);
+            run<SpscRingBuffer<WorkItem>, true>("SpscRingBuffer x32 ", side, side);
+        }
+    }
+    return 0;
+}
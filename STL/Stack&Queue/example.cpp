@@ -2,6 +2,8 @@
 #include <stack>
 #include <queue>
 #include <deque>
+#include <thread>
+#include "RingBuffer.h"
 
 using namespace std;
 
@@ -82,6 +84,35 @@ void dequeUsage() {
     cout << "Size of deque: " << d.size() << endl; // Output: 2
 }
 
+// Function to demonstrate passing work between threads with the lock-free ring buffers
+void ringBufferUsage() {
+    SpscRingBuffer<int> spsc(4); // Bounded: room for 4 elements
+    thread producer([&spsc] {
+        for (int i = 1; i <= 10; ++i) {
+            spsc.push(i * 10); // Waits while the buffer is full
+        }
+    });
+    cout << "Popped from the SPSC ring buffer: ";
+    for (int i = 0; i < 10; ++i) {
+        int value;
+        spsc.pop(value); // Waits while the buffer is empty
+        cout << value << " "; // Output: 10 20 30 ... 100
+    }
+    cout << endl;
+    producer.join();
+
+    MpmcRingBuffer<int> mpmc(8); // Any number of threads may push and pop
+    int batch[] = {1, 2, 3, 4, 5};
+    cout << "Pushed as a batch: " << mpmc.try_push_batch(batch, 5) << endl; // Output: 5
+    int out[8];
+    size_t count = mpmc.try_pop_batch(out, 8);
+    cout << "Popped as a batch: ";
+    for (size_t i = 0; i < count; ++i) {
+        cout << out[i] << " "; // Output: 1 2 3 4 5
+    }
+    cout << endl;
+}
+
 // Main function to demonstrate usage of stack, queue, and deque
 int main() {
     cout << "Stack Usage:" << endl;
@@ -93,5 +124,8 @@ int main() {
     cout << "\nDeque Usage:" << endl;
     dequeUsage(); // Demonstrate deque operations
 
+    cout << "\nRing Buffer Usage:" << endl;
+    ringBufferUsage(); // Demonstrate the lock-free ring buffers
+
     return 0;
 }
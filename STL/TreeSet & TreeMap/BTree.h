@@ -0,0 +1,716 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include <cstddef> // For size_t, std::ptrdiff_t
+#include <cstdint> // For uint16_t
+#include <functional> // For std::less
+#include <initializer_list>
+#include <iterator> // For std::bidirectional_iterator_tag, std::reverse_iterator
+#include <new> // For placement new and std::launder
+#include <stdexcept> // For std::out_of_range
+#include <tuple> // For std::forward_as_tuple
+#include <type_traits>
+#include <utility> // For std::pair, std::move, std::forward
+#include "SortedSearch.h"
+
+/*
+Notes about BTreeSet / BTreeMap:
+
+1. **Why a B-Tree**:
+   - A red-black tree (std::set/std::map) has one element per node, so a lookup in a million
+     elements visits ~20 nodes, each probably a cache miss.
+   - A B-tree node holds many sorted elements in a few cache lines (NodeBytes, 256 by default,
+     about 60 ints). A million elements are only 4 levels deep, and within a node the search
+     is a branchless binary search over contiguous memory.
+   - Unlike FlatSet/FlatMap an insert or erase only shifts the elements of one node, O(log n)
+     overall, which is what write-heavy tables need.
+
+2. **Insert (top-down splitting)**:
+   - On the way down, any full node is split in two around its middle element, which moves
+     up into the parent. The parent has room because it was split already if it was full.
+     So the insert in the leaf never has to walk back up.
+
+3. **Erase (top-down filling)**:
+   - On the way down, a child with the minimum number of elements first borrows one from a
+     sibling (through the parent) or is merged with a sibling. The node an element is removed
+     from can therefore always spare it.
+   - An element in an inner node is replaced by its predecessor or successor from a leaf.
+
+4. **Iterators**:
+   - Each node knows its parent and its position in it, so ++ and -- walk the tree in order
+     without a stack. Iterators are invalidated by any insert or erase (elements move
+     between nodes), unlike std::set/std::map.
+
+5. **Same Surface as std::set/std::map** (unique keys only):
+   - insert, emplace, count, find, contains, lower_bound, upper_bound, equal_range, erase
+     (by key, iterator or range), operator[] and at for maps, reverse iteration.
+   - With the default std::less<> lookups also take e.g. a std::string_view for string keys.
+   - A map stores std::pair<Key, Value>: the key must not be changed through an iterator.
+*/
+
+template <typename Key, typename Slot, typename KeyOf, typename Compare, size_t NodeBytes>
+class BTreeTable {
+private:
+    static constexpr size_t headerBytes = 16; // parent, position, count, leaf
+    static constexpr size_t fittingSlots = NodeBytes > headerBytes + 3 * sizeof(Slot) ? (NodeBytes - headerBytes) / sizeof(Slot) : 3;
+    static constexpr size_t maxSlots = fittingSlots % 2 == 1 ? fittingSlots : fittingSlots - 1; // Odd, so a split is even
+    static constexpr size_t minSlots = maxSlots / 2; // Every node but the root keeps at least this many
+    static_assert(maxSlots < 65535, "node positions and counts are 16-bit");
+
+    struct Node {
+        Node* parent;
+        uint16_t position; // Index in parent's children
+        uint16_t count;
+        bool leaf;
+        alignas(Slot) unsigned char storage[maxSlots * sizeof(Slot)];
+    };
+
+    struct InnerNode : Node {
+        Node* children[maxSlots + 1];
+    };
+
+    Node* root;
+    size_t elementCount;
+    Compare less;
+
+    static Slot* slotsOf(Node* node) {
+        return std::launder(reinterpret_cast<Slot*>(node->storage));
+    }
+    static const Slot* slotsOf(const Node* node) {
+        return std::launder(reinterpret_cast<const Slot*>(node->storage));
+    }
+    static Slot& slotAt(Node* node, size_t index) {
+        return slotsOf(node)[index];
+    }
+    static Node*& childAt(Node* node, size_t index) {
+        return static_cast<InnerNode*>(node)->children[index];
+    }
+    static const Node* childAt(const Node* node, size_t index) {
+        return static_cast<const InnerNode*>(node)->children[index];
+    }
+    static void setChild(Node* node, size_t index, Node* child) {
+        childAt(node, index) = child;
+        child->parent = node;
+        child->position = static_cast<uint16_t>(index);
+    }
+
+    static Node* newNode(bool leaf) {
+        Node* node = leaf ? new Node : new InnerNode;
+        node->parent = nullptr;
+        node->position = 0;
+        node->count = 0;
+        node->leaf = leaf;
+        return node;
+    }
+
+    static void deleteNode(Node* node) {
+        if (node->leaf) {
+            delete node;
+        } else {
+            delete static_cast<InnerNode*>(node);
+        }
+    }
+
+    // Destroys every element of the subtree and frees its nodes (recursion depth = tree height)
+    static void destroyTree(Node* node) {
+        if (!node->leaf) {
+            for (size_t i = 0; i <= node->count; ++i) destroyTree(childAt(node, i));
+        }
+        for (size_t i = 0; i < node->count; ++i) slotAt(node, i).~Slot();
+        deleteNode(node);
+    }
+
+    static Node* cloneTree(const Node* source) {
+        Node* node = newNode(source->leaf);
+        try {
+            for (; node->count < source->count; ++node->count) {
+                new (&slotAt(node, node->count)) Slot(slotsOf(source)[node->count]);
+            }
+            if (!source->leaf) {
+                size_t cloned = 0;
+                try {
+                    for (; cloned <= source->count; ++cloned) {
+                        setChild(node, cloned, cloneTree(childAt(source, cloned)));
+                    }
+                } catch (...) {
+                    for (size_t i = 0; i < cloned; ++i) destroyTree(childAt(node, i));
+                    throw;
+                }
+            }
+        } catch (...) {
+            for (size_t i = 0; i < node->count; ++i) slotAt(node, i).~Slot();
+            deleteNode(node);
+            throw;
+        }
+        return node;
+    }
+
+    // Put value at index, shifting slots [index, count) one to the right
+    static void insertSlot(Node* node, size_t index, Slot&& value) {
+        size_t count = node->count;
+        if (index == count) {
+            new (&slotAt(node, count)) Slot(std::move(value));
+        } else {
+            new (&slotAt(node, count)) Slot(std::move(slotAt(node, count - 1)));
+            for (size_t i = count - 1; i > index; --i) {
+                slotAt(node, i) = std::move(slotAt(node, i - 1));
+            }
+            slotAt(node, index) = std::move(value);
+        }
+        node->count++;
+    }
+
+    // Remove the slot at index, shifting the ones after it one to the left
+    static void removeSlot(Node* node, size_t index) {
+        for (size_t i = index; i + 1 < node->count; ++i) {
+            slotAt(node, i) = std::move(slotAt(node, i + 1));
+        }
+        slotAt(node, node->count - 1).~Slot();
+        node->count--;
+    }
+
+    template <typename K>
+    size_t lowerIndex(const Node* node, const K& key) const {
+        return sorted_search::lowerBound<KeyOf>(slotsOf(node), node->count, key, less);
+    }
+
+    template <typename K>
+    size_t upperIndex(const Node* node, const K& key) const {
+        return sorted_search::upperBound<KeyOf>(slotsOf(node), node->count, key, less);
+    }
+
+    // childAt(parent, index) is full: move its upper half to a new sibling and its middle slot up
+    void splitChild(Node* parent, size_t index) {
+        Node* full = childAt(parent, index);
+        Node* sibling = newNode(full->leaf);
+        for (size_t i = minSlots + 1; i < maxSlots; ++i) {
+            new (&slotAt(sibling, sibling->count++)) Slot(std::move(slotAt(full, i)));
+        }
+        if (!full->leaf) {
+            for (size_t i = minSlots + 1; i <= maxSlots; ++i) {
+                setChild(sibling, i - minSlots - 1, childAt(full, i));
+            }
+        }
+        for (size_t i = parent->count; i > index; --i) {
+            setChild(parent, i + 1, childAt(parent, i)); // Make room for the sibling
+        }
+        insertSlot(parent, index, std::move(slotAt(full, minSlots)));
+        setChild(parent, index + 1, sibling);
+        for (size_t i = minSlots; i < maxSlots; ++i) {
+            slotAt(full, i).~Slot(); // Moved-from leftovers
+        }
+        full->count = static_cast<uint16_t>(minSlots);
+    }
+
+    // The key of value is known not to be in the tree
+    std::pair<Node*, size_t> insertNew(Slot&& value) {
+        if (!root) {
+            root = newNode(true);
+        }
+        if (root->count == maxSlots) {
+            Node* newRoot = newNode(false);
+            setChild(newRoot, 0, root);
+            root = newRoot;
+            splitChild(newRoot, 0); // The tree grows at the top
+        }
+        const Key& key = KeyOf::key(value);
+        Node* node = root;
+        while (true) {
+            size_t index = lowerIndex(node, key);
+            if (node->leaf) {
+                insertSlot(node, index, std::move(value));
+                elementCount++;
+                return {node, index};
+            }
+            if (childAt(node, index)->count == maxSlots) {
+                splitChild(node, index);
+                if (less(KeyOf::key(slotAt(node, index)), key)) ++index; // Key belongs in the new right half
+            }
+            node = childAt(node, index);
+        }
+    }
+
+    // Merge childAt(parent, index + 1) and the slot between them into childAt(parent, index).
+    // Returns the merged node; parent may have been freed (it was a root left empty).
+    Node* mergeChildren(Node* parent, size_t index) {
+        Node* left = childAt(parent, index);
+        Node* right = childAt(parent, index + 1);
+        new (&slotAt(left, left->count)) Slot(std::move(slotAt(parent, index)));
+        size_t base = left->count + 1;
+        for (size_t i = 0; i < right->count; ++i) {
+            new (&slotAt(left, base + i)) Slot(std::move(slotAt(right, i)));
+            slotAt(right, i).~Slot();
+        }
+        if (!left->leaf) {
+            for (size_t i = 0; i <= right->count; ++i) {
+                setChild(left, base + i, childAt(right, i));
+            }
+        }
+        left->count = static_cast<uint16_t>(base + right->count);
+        right->count = 0;
+        deleteNode(right);
+
+        removeSlot(parent, index);
+        for (size_t i = index + 1; i <= parent->count; ++i) {
+            setChild(parent, i, childAt(parent, i + 1));
+        }
+        if (parent == root && parent->count == 0) {
+            root = left; // The tree shrinks at the top
+            left->parent = nullptr;
+            left->position = 0;
+            deleteNode(parent);
+        }
+        return left;
+    }
+
+    // Make sure childAt(parent, index) has more than minSlots slots before descending into it.
+    // Returns the node to descend into (after a merge that is a different node).
+    Node* fillChild(Node* parent, size_t index) {
+        Node* child = childAt(parent, index);
+        if (child->count > minSlots) {
+            return child;
+        }
+        if (index > 0 && childAt(parent, index - 1)->count > minSlots) {
+            Node* left = childAt(parent, index - 1); // Borrow through the parent from the left
+            if (!child->leaf) {
+                for (size_t i = child->count + 1; i > 0; --i) {
+                    setChild(child, i, childAt(child, i - 1));
+                }
+                setChild(child, 0, childAt(left, left->count));
+            }
+            insertSlot(child, 0, std::move(slotAt(parent, index - 1)));
+            slotAt(parent, index - 1) = std::move(slotAt(left, left->count - 1));
+            slotAt(left, left->count - 1).~Slot();
+            left->count--;
+            return child;
+        }
+        if (index < parent->count && childAt(parent, index + 1)->count > minSlots) {
+            Node* right = childAt(parent, index + 1); // Borrow through the parent from the right
+            Node* moved = right->leaf ? nullptr : childAt(right, 0);
+            insertSlot(child, child->count, std::move(slotAt(parent, index)));
+            if (moved) {
+                setChild(child, child->count, moved);
+            }
+            slotAt(parent, index) = std::move(slotAt(right, 0));
+            removeSlot(right, 0);
+            if (moved) {
+                for (size_t i = 0; i <= right->count; ++i) {
+                    setChild(right, i, childAt(right, i + 1));
+                }
+            }
+            return child;
+        }
+        if (index > 0 && index == parent->count) {
+            return mergeChildren(parent, index - 1); // The last child has no right neighbour: merge into the left one
+        }
+        return mergeChildren(parent, index);
+    }
+
+    // Remove and return the largest (Last) or smallest slot of a subtree whose root can spare one
+    template <bool Last>
+    Slot takeExtreme(Node* node) {
+        while (!node->leaf) {
+            node = fillChild(node, Last ? node->count : 0);
+        }
+        size_t index = Last ? node->count - 1 : 0;
+        Slot value(std::move(slotAt(node, index)));
+        removeSlot(node, index);
+        return value;
+    }
+
+    // The key is known to be in the tree
+    template <typename K>
+    void eraseExisting(const K& key) {
+        Node* node = root;
+        while (true) {
+            size_t index = lowerIndex(node, key);
+            if (index < node->count && !less(key, KeyOf::key(slotAt(node, index)))) {
+                if (node->leaf) {
+                    removeSlot(node, index);
+                    break;
+                }
+                Node* left = childAt(node, index);
+                Node* right = childAt(node, index + 1);
+                if (left->count > minSlots) {
+                    slotAt(node, index) = takeExtreme<true>(left); // Predecessor takes its place
+                    break;
+                }
+                if (right->count > minSlots) {
+                    slotAt(node, index) = takeExtreme<false>(right); // Successor takes its place
+                    break;
+                }
+                node = mergeChildren(node, index); // Key moved down into the merged node
+                continue;
+            }
+            node = fillChild(node, index);
+        }
+        elementCount--;
+        if (root->count == 0) {
+            deleteNode(root); // Last element gone (a leaf root)
+            root = nullptr;
+        }
+    }
+
+public:
+    using key_type = Key;
+    using value_type = Slot;
+    using size_type = size_t;
+    using key_compare = Compare;
+
+    template <bool Const>
+    class Iterator {
+    private:
+        friend class BTreeTable;
+        const BTreeTable* tree;
+        Node* node; // nullptr at end()
+        size_t position;
+
+        Iterator(const BTreeTable* tree, Node* node, size_t position) : tree(tree), node(node), position(position) {}
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Slot;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const Slot&, Slot&>;
+        using pointer = std::conditional_t<Const, const Slot*, Slot*>;
+
+        Iterator() : tree(nullptr), node(nullptr), position(0) {}
+
+        // iterator -> const_iterator
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other) : tree(other.tree), node(other.node), position(other.position) {}
+
+        reference operator*() const { return slotAt(node, position); }
+        pointer operator->() const { return &slotAt(node, position); }
+
+        Iterator& operator++() {
+            if (!node->leaf) {
+                node = childAt(node, position + 1); // Leftmost element of the right subtree
+                while (!node->leaf) node = childAt(node, 0);
+                position = 0;
+                return *this;
+            }
+            ++position;
+            while (position == node->count) { // Past the end of this node: back up to the parent
+                if (!node->parent) {
+                    node = nullptr;
+                    position = 0;
+                    return *this;
+                }
+                position = node->position;
+                node = node->parent;
+            }
+            return *this;
+        }
+
+        Iterator& operator--() {
+            if (!node) {
+                node = tree->root; // --end(): the last element
+                while (!node->leaf) node = childAt(node, node->count);
+                position = node->count - 1;
+                return *this;
+            }
+            if (!node->leaf) {
+                node = childAt(node, position); // Rightmost element of the left subtree
+                while (!node->leaf) node = childAt(node, node->count);
+                position = node->count - 1;
+                return *this;
+            }
+            if (position > 0) {
+                --position;
+                return *this;
+            }
+            while (node->parent && node->position == 0) {
+                node = node->parent;
+            }
+            position = node->position - 1; // The slot left of the child we came up from
+            node = node->parent;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        Iterator operator--(int) {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return node == other.node && position == other.position; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+        template <bool>
+        friend class Iterator;
+    };
+
+    using const_iterator = Iterator<true>;
+    // Set keys can't be changed in place, so a set only hands out const iterators
+    using iterator = std::conditional_t<std::is_same<Key, Slot>::value, const_iterator, Iterator<false>>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+protected:
+    iterator iteratorAt(Node* node, size_t position) { return iterator(this, node, position); }
+    const_iterator iteratorAt(Node* node, size_t position) const { return const_iterator(this, node, position); }
+
+    // Insert a slot built from args unless key is already there
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> emplaceKey(const K& key, Args&&... args) {
+        iterator existing = find(key);
+        if (existing != end()) {
+            return {existing, false};
+        }
+        auto [node, position] = insertNew(Slot(std::forward<Args>(args)...));
+        return {iteratorAt(node, position), true};
+    }
+
+public:
+    BTreeTable() : root(nullptr), elementCount(0) {}
+
+    BTreeTable(const BTreeTable& other) : root(other.root ? cloneTree(other.root) : nullptr), elementCount(other.elementCount), less(other.less) {}
+
+    BTreeTable(BTreeTable&& other) noexcept : root(other.root), elementCount(other.elementCount), less(other.less) {
+        other.root = nullptr;
+        other.elementCount = 0;
+    }
+
+    BTreeTable& operator=(const BTreeTable& other) {
+        if (this != &other) {
+            BTreeTable copy(other); // Copy first, so a throwing copy leaves *this untouched
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    BTreeTable& operator=(BTreeTable&& other) noexcept {
+        if (this != &other) {
+            clear();
+            root = other.root;
+            elementCount = other.elementCount;
+            less = other.less;
+            other.root = nullptr;
+            other.elementCount = 0;
+        }
+        return *this;
+    }
+
+    ~BTreeTable() {
+        clear();
+    }
+
+    iterator begin() {
+        if (!root) return end();
+        Node* node = root;
+        while (!node->leaf) node = childAt(node, 0);
+        return iteratorAt(node, 0);
+    }
+    const_iterator begin() const { return const_cast<BTreeTable*>(this)->begin(); }
+    iterator end() { return iteratorAt(nullptr, 0); }
+    const_iterator end() const { return iteratorAt(nullptr, 0); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    size_t size() const { return elementCount; }
+    bool empty() const { return elementCount == 0; }
+
+    void clear() {
+        if (root) destroyTree(root);
+        root = nullptr;
+        elementCount = 0;
+    }
+
+    // Elements per node (a full node); the tree is about log(size) / log(nodeCapacity / 2) levels deep at worst
+    static constexpr size_t nodeCapacity() { return maxSlots; }
+
+    template <typename K>
+    iterator find(const K& key) {
+        for (Node* node = root; node;) {
+            size_t index = lowerIndex(node, key);
+            if (index < node->count && !less(key, KeyOf::key(slotAt(node, index)))) {
+                return iteratorAt(node, index);
+            }
+            node = node->leaf ? nullptr : childAt(node, index);
+        }
+        return end();
+    }
+    template <typename K>
+    const_iterator find(const K& key) const { return const_cast<BTreeTable*>(this)->find(key); }
+
+    template <typename K>
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    template <typename K>
+    size_t count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    // First element not less than key: the deepest candidate seen on the way down is the smallest
+    template <typename K>
+    iterator lower_bound(const K& key) {
+        iterator result = end();
+        for (Node* node = root; node;) {
+            size_t index = lowerIndex(node, key);
+            if (index < node->count) result = iteratorAt(node, index);
+            node = node->leaf ? nullptr : childAt(node, index);
+        }
+        return result;
+    }
+    template <typename K>
+    const_iterator lower_bound(const K& key) const { return const_cast<BTreeTable*>(this)->lower_bound(key); }
+
+    template <typename K>
+    iterator upper_bound(const K& key) {
+        iterator result = end();
+        for (Node* node = root; node;) {
+            size_t index = upperIndex(node, key);
+            if (index < node->count) result = iteratorAt(node, index);
+            node = node->leaf ? nullptr : childAt(node, index);
+        }
+        return result;
+    }
+    template <typename K>
+    const_iterator upper_bound(const K& key) const { return const_cast<BTreeTable*>(this)->upper_bound(key); }
+
+    template <typename K>
+    std::pair<iterator, iterator> equal_range(const K& key) { return {lower_bound(key), upper_bound(key)}; }
+    template <typename K>
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const { return {lower_bound(key), upper_bound(key)}; }
+
+    // Returns how many elements were removed (0 or 1).
+    // (Iterators go to the overloads below, even when they happen to be comparable with keys.)
+    template <typename K, typename = std::enable_if_t<!std::is_convertible<const K&, const_iterator>::value>>
+    size_t erase(const K& key) {
+        if (find(key) == end()) return 0; // Don't restructure the tree on a miss
+        eraseExisting(key);
+        return 1;
+    }
+
+    // Returns the iterator to the element after position; found again by key, since erasing moves elements between nodes
+    iterator erase(const_iterator position) {
+        Key key = KeyOf::key(*position);
+        eraseExisting(key);
+        return lower_bound(key);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        if (last == end()) {
+            while (first != end()) first = erase(first);
+            return end();
+        }
+        Key stop = KeyOf::key(*last);
+        while (less(KeyOf::key(*first), stop)) first = erase(first);
+        return lower_bound(stop);
+    }
+};
+
+// NodeBytes: target size of a node's element array, a few cache lines
+template <typename Key, typename Compare = std::less<>, size_t NodeBytes = 256>
+class BTreeSet : public BTreeTable<Key, Key, sorted_search::SetKeyOf, Compare, NodeBytes> {
+private:
+    using Table = BTreeTable<Key, Key, sorted_search::SetKeyOf, Compare, NodeBytes>;
+
+public:
+    using typename Table::iterator;
+
+    BTreeSet() = default;
+
+    BTreeSet(std::initializer_list<Key> keys) {
+        for (const Key& key : keys) insert(key);
+    }
+
+    std::pair<iterator, bool> insert(const Key& key) {
+        return this->emplaceKey(key, key);
+    }
+
+    std::pair<iterator, bool> insert(Key&& key) {
+        return this->emplaceKey(key, std::move(key));
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first) insert(*first);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(Key(std::forward<Args>(args)...));
+    }
+};
+
+template <typename Key, typename Value, typename Compare = std::less<>, size_t NodeBytes = 256>
+class BTreeMap : public BTreeTable<Key, std::pair<Key, Value>, sorted_search::MapKeyOf, Compare, NodeBytes> {
+private:
+    using Table = BTreeTable<Key, std::pair<Key, Value>, sorted_search::MapKeyOf, Compare, NodeBytes>;
+
+public:
+    using mapped_type = Value;
+    using typename Table::const_iterator;
+    using typename Table::iterator;
+    using typename Table::value_type;
+
+    BTreeMap() = default;
+
+    BTreeMap(std::initializer_list<value_type> values) {
+        for (const value_type& value : values) insert(value);
+    }
+
+    // Like std::map, an existing key keeps its value
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return this->emplaceKey(value.first, value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return this->emplaceKey(value.first, std::move(value));
+    }
+
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first) insert(*first);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    // Only constructs the value if key is new
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return this->emplaceKey(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return this->emplaceKey(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    Value& operator[](Key&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template <typename K>
+    Value& at(const K& key) {
+        iterator it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("BTreeMap::at: key not found");
+        return it->second;
+    }
+
+    template <typename K>
+    const Value& at(const K& key) const {
+        const_iterator it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("BTreeMap::at: key not found");
+        return it->second;
+    }
+};
+
+#endif // BTREE_H
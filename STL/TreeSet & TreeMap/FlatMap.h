@@ -0,0 +1,315 @@
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include <algorithm> // For std::stable_sort, std::inplace_merge, std::unique
+#include <cstddef> // For size_t
+#include <functional> // For std::less
+#include <initializer_list>
+#include <iterator> // For std::reverse_iterator
+#include <stdexcept> // For std::out_of_range
+#include <tuple> // For std::forward_as_tuple
+#include <type_traits>
+#include <utility> // For std::pair, std::move, std::forward
+#include <vector>
+#include "SortedSearch.h"
+
+/*
+Notes about FlatSet / FlatMap (and their Multi versions):
+
+1. **Sorted Vector Instead of a Red-Black Tree**:
+   - std::set/std::map allocate one node per element and lower_bound walks ~log2(n) nodes
+     scattered over the heap, a likely cache miss on every level.
+   - Here the elements sit sorted in one std::vector. A lookup is a branchless binary search
+     over contiguous memory (see SortedSearch.h), iteration is a linear scan, and there is
+     no per-element allocation or pointer overhead at all.
+
+2. **Bulk Build, Then Query**:
+   - Building from a whole vector (constructor) or a range (insert(first, last)) sorts once:
+     O(n log n). Inserting elements one by one shifts the tail of the vector every time,
+     O(n) each, so bulk loading is the intended way to fill a large table.
+   - For unique tables a key that is already there (or repeated in the input) keeps its
+     first value, the same rule std::map::insert follows.
+   - erase() also shifts the tail: for tables that keep changing, use BTreeSet/BTreeMap.
+
+3. **Same Surface as std::set/std::map**:
+   - insert, emplace, count, find, contains, lower_bound, upper_bound, equal_range, erase
+     (by key, iterator or range), operator[] and at for maps, reverse iteration.
+   - Lookups take any type the comparator accepts; with the default std::less<> a
+     FlatMap<std::string, V> can be searched with a std::string_view or const char*.
+   - Inserting or erasing invalidates iterators (elements move), unlike node-based containers.
+   - A map stores std::pair<Key, Value>: the key must not be changed through an iterator.
+*/
+
+// Storage and lookups shared by BasicFlatSet and BasicFlatMap
+template <typename Key, typename Slot, typename KeyOf, typename Compare, bool Multi>
+class SortedVectorTable {
+protected:
+    std::vector<Slot> slots;
+    Compare less;
+
+    template <typename K>
+    size_t lowerIndex(const K& key) const {
+        return sorted_search::lowerBound<KeyOf>(slots.data(), slots.size(), key, less);
+    }
+
+    template <typename K>
+    size_t upperIndex(const K& key) const {
+        return sorted_search::upperBound<KeyOf>(slots.data(), slots.size(), key, less);
+    }
+
+    template <typename K>
+    bool keyAt(size_t index, const K& key) const {
+        return index < slots.size() && !less(key, KeyOf::key(slots[index]));
+    }
+
+    // slots[0, from) is sorted; sort the new elements after it and merge them in
+    void mergeTail(size_t from) {
+        auto keyLess = [this](const Slot& a, const Slot& b) { return less(KeyOf::key(a), KeyOf::key(b)); };
+        std::stable_sort(slots.begin() + from, slots.end(), keyLess); // Stable: equal keys keep input order
+        std::inplace_merge(slots.begin(), slots.begin() + from, slots.end(), keyLess);
+        if constexpr (!Multi) {
+            auto sameKey = [&](const Slot& a, const Slot& b) { return !keyLess(a, b); }; // Sorted, so a <= b
+            slots.erase(std::unique(slots.begin(), slots.end(), sameKey), slots.end()); // First one wins
+        }
+    }
+
+    // Insert an element with this key built from args. Unique tables return the existing one instead.
+    template <typename K, typename... Args>
+    std::pair<size_t, bool> emplaceKey(const K& key, Args&&... args) {
+        if constexpr (Multi) {
+            size_t index = upperIndex(key); // After its equals, like std::multimap
+            slots.emplace(slots.begin() + index, std::forward<Args>(args)...);
+            return {index, true};
+        } else {
+            size_t index = lowerIndex(key);
+            if (keyAt(index, key)) {
+                return {index, false};
+            }
+            slots.emplace(slots.begin() + index, std::forward<Args>(args)...);
+            return {index, true};
+        }
+    }
+
+public:
+    using key_type = Key;
+    using value_type = Slot;
+    using size_type = size_t;
+    using key_compare = Compare;
+    using const_iterator = typename std::vector<Slot>::const_iterator;
+    // Set keys can't be changed in place, so a set only hands out const iterators
+    using iterator = std::conditional_t<std::is_same<Key, Slot>::value, const_iterator, typename std::vector<Slot>::iterator>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    SortedVectorTable() = default;
+
+    // Bulk build: sorts once (and drops repeated keys for unique tables)
+    explicit SortedVectorTable(std::vector<Slot> values, const Compare& less = Compare()) : slots(std::move(values)), less(less) {
+        mergeTail(0);
+    }
+
+    SortedVectorTable(std::initializer_list<Slot> values) : SortedVectorTable(std::vector<Slot>(values)) {}
+
+    // Bulk insert: one sort and merge for the whole range
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        size_t from = slots.size();
+        slots.insert(slots.end(), first, last);
+        mergeTail(from);
+    }
+
+    iterator begin() { return slots.begin(); }
+    iterator end() { return slots.end(); }
+    const_iterator begin() const { return slots.begin(); }
+    const_iterator end() const { return slots.end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    size_t size() const { return slots.size(); }
+    bool empty() const { return slots.empty(); }
+    void clear() { slots.clear(); }
+    void reserve(size_t count) { slots.reserve(count); }
+    size_t capacity() const { return slots.capacity(); }
+    void shrink_to_fit() { slots.shrink_to_fit(); }
+
+    template <typename K>
+    iterator lower_bound(const K& key) { return begin() + lowerIndex(key); }
+    template <typename K>
+    const_iterator lower_bound(const K& key) const { return begin() + lowerIndex(key); }
+
+    template <typename K>
+    iterator upper_bound(const K& key) { return begin() + upperIndex(key); }
+    template <typename K>
+    const_iterator upper_bound(const K& key) const { return begin() + upperIndex(key); }
+
+    template <typename K>
+    std::pair<iterator, iterator> equal_range(const K& key) { return {lower_bound(key), upper_bound(key)}; }
+    template <typename K>
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const { return {lower_bound(key), upper_bound(key)}; }
+
+    template <typename K>
+    iterator find(const K& key) {
+        size_t index = lowerIndex(key);
+        return keyAt(index, key) ? begin() + index : end();
+    }
+    template <typename K>
+    const_iterator find(const K& key) const {
+        size_t index = lowerIndex(key);
+        return keyAt(index, key) ? begin() + index : end();
+    }
+
+    template <typename K>
+    bool contains(const K& key) const {
+        return keyAt(lowerIndex(key), key);
+    }
+
+    template <typename K>
+    size_t count(const K& key) const {
+        if constexpr (Multi) {
+            return upperIndex(key) - lowerIndex(key);
+        } else {
+            return contains(key) ? 1 : 0;
+        }
+    }
+
+    // Removes every element with this key; returns how many there were.
+    // (Iterators go to the overloads below, even when they happen to be comparable with keys.)
+    template <typename K, typename = std::enable_if_t<!std::is_convertible<const K&, const_iterator>::value>>
+    size_t erase(const K& key) {
+        size_t first = lowerIndex(key);
+        size_t last = Multi ? upperIndex(key) : first + (keyAt(first, key) ? 1 : 0);
+        slots.erase(slots.begin() + first, slots.begin() + last);
+        return last - first;
+    }
+
+    iterator erase(const_iterator position) { return slots.erase(position); }
+    iterator erase(const_iterator first, const_iterator last) { return slots.erase(first, last); }
+};
+
+template <typename Key, typename Compare, bool Multi>
+class BasicFlatSet : public SortedVectorTable<Key, Key, sorted_search::SetKeyOf, Compare, Multi> {
+private:
+    using Table = SortedVectorTable<Key, Key, sorted_search::SetKeyOf, Compare, Multi>;
+
+public:
+    using typename Table::iterator;
+    using Table::Table;
+    using Table::insert; // The bulk insert(first, last)
+
+    // pair<iterator, bool> for FlatSet, iterator for FlatMultiset (as in std)
+    auto insert(const Key& key) {
+        auto [index, inserted] = this->emplaceKey(key, key);
+        if constexpr (Multi) {
+            return this->begin() + index;
+        } else {
+            return std::pair<iterator, bool>(this->begin() + index, inserted);
+        }
+    }
+
+    auto insert(Key&& key) {
+        auto [index, inserted] = this->emplaceKey(key, std::move(key));
+        if constexpr (Multi) {
+            return this->begin() + index;
+        } else {
+            return std::pair<iterator, bool>(this->begin() + index, inserted);
+        }
+    }
+
+    template <typename... Args>
+    auto emplace(Args&&... args) {
+        return insert(Key(std::forward<Args>(args)...));
+    }
+};
+
+template <typename Key, typename Value, typename Compare, bool Multi>
+class BasicFlatMap : public SortedVectorTable<Key, std::pair<Key, Value>, sorted_search::MapKeyOf, Compare, Multi> {
+private:
+    using Table = SortedVectorTable<Key, std::pair<Key, Value>, sorted_search::MapKeyOf, Compare, Multi>;
+
+public:
+    using mapped_type = Value;
+    using typename Table::const_iterator;
+    using typename Table::iterator;
+    using typename Table::value_type;
+    using Table::Table;
+    using Table::insert; // The bulk insert(first, last)
+
+    // Like std::map, an existing key keeps its value (FlatMultimap always inserts)
+    auto insert(const value_type& value) {
+        auto [index, inserted] = this->emplaceKey(value.first, value);
+        if constexpr (Multi) {
+            return this->begin() + index;
+        } else {
+            return std::pair<iterator, bool>(this->begin() + index, inserted);
+        }
+    }
+
+    auto insert(value_type&& value) {
+        auto [index, inserted] = this->emplaceKey(value.first, std::move(value));
+        if constexpr (Multi) {
+            return this->begin() + index;
+        } else {
+            return std::pair<iterator, bool>(this->begin() + index, inserted);
+        }
+    }
+
+    template <typename... Args>
+    auto emplace(Args&&... args) {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    // Only constructs the value if key is new
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        static_assert(!Multi, "try_emplace needs unique keys");
+        auto [index, inserted] = this->emplaceKey(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                                  std::forward_as_tuple(std::forward<Args>(args)...));
+        return {this->begin() + index, inserted};
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        static_assert(!Multi, "try_emplace needs unique keys");
+        auto [index, inserted] = this->emplaceKey(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                                  std::forward_as_tuple(std::forward<Args>(args)...));
+        return {this->begin() + index, inserted};
+    }
+
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    Value& operator[](Key&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    template <typename K>
+    Value& at(const K& key) {
+        iterator it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("FlatMap::at: key not found");
+        return it->second;
+    }
+
+    template <typename K>
+    const Value& at(const K& key) const {
+        const_iterator it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("FlatMap::at: key not found");
+        return it->second;
+    }
+};
+
+template <typename Key, typename Compare = std::less<>>
+using FlatSet = BasicFlatSet<Key, Compare, false>;
+
+template <typename Key, typename Compare = std::less<>>
+using FlatMultiset = BasicFlatSet<Key, Compare, true>;
+
+template <typename Key, typename Value, typename Compare = std::less<>>
+using FlatMap = BasicFlatMap<Key, Value, Compare, false>;
+
+template <typename Key, typename Value, typename Compare = std::less<>>
+using FlatMultimap = BasicFlatMap<Key, Value, Compare, true>;
+
+#endif // FLAT_MAP_H
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <set>
 #include <map>
+#include "../FlatMap.h"
 
 using namespace std;
 
@@ -13,7 +14,7 @@ using namespace std;
  *      - insert(value): Adds an element, duplicates allowed.
  *      - emplace(value): Constructs an element in place, duplicates allowed.
  *      - count(value): Returns the number of occurrences of the value.
- *      - erase(value): Removes one occurrence of the value.
+ *      - erase(value): Removes every occurrence of the value (erase(find(value)) removes just one).
  *      - erase(iterator): Removes an element using an iterator.
  *      - clear(): Removes all elements.
  *      - size(): Returns the number of elements.
@@ -44,10 +45,17 @@ using namespace std;
  *      - end(): Returns an iterator to one past the last key-value pair.
  *      - rbegin(): Returns a reverse iterator to the last key-value pair.
  *      - rend(): Returns a reverse iterator to before the first key-value pair.
+ *
+ * 3. **FlatMultiset / FlatMultimap** (../FlatMap.h):
+ *    - The same operations on one sorted vector: much faster lookups and iteration, but
+ *      every insert/erase shifts elements, so fill them in bulk and then query.
+ *    - Equal keys keep their insertion order, as in std::multiset/std::multimap.
+ *    - The usage functions below are templates, so each one runs on both.
  */
 
+template <typename Multiset>
 void multisetUsage() {
-    multiset<int> ms; // Initialize an empty multiset
+    Multiset ms; // Initialize an empty multiset
     ms.insert(10); // Add elements
     ms.insert(20);
     ms.insert(10); // Duplicate
@@ -64,7 +72,7 @@ void multisetUsage() {
     cout << "Count of 20: " << ms.count(20) << endl; // Output: 2
 
     // Remove one occurrence of an element
-    ms.erase(20);
+    ms.erase(ms.find(20));
     cout << "Multiset after removing one occurrence of 20: ";
     for (const auto& n : ms) cout << n << " "; // Output: 10 10 20 30
     cout << endl;
@@ -75,8 +83,9 @@ void multisetUsage() {
     cout << "Multiset size after clear: " << ms.size() << endl; // Output: 0
 }
 
+template <typename Multimap>
 void multimapUsage() {
-    multimap<string, int> mm; // Initialize an empty multimap
+    Multimap mm; // Initialize an empty multimap
     mm.insert({"Alice", 25}); // Add key-value pairs
     mm.insert({"Bob", 30});
     mm.insert({"Alice", 35}); // Duplicate key
@@ -101,9 +110,13 @@ void multimapUsage() {
 }
 
 int main() {
-    cout << "Multiset Usage:\n";
-    multisetUsage();
-    cout << "\nMultimap Usage:\n";
-    multimapUsage();
+    cout << "Multiset Usage (std::multiset):\n";
+    multisetUsage<multiset<int>>();
+    cout << "\nMultiset Usage (FlatMultiset):\n";
+    multisetUsage<FlatMultiset<int>>();
+    cout << "\nMultimap Usage (std::multimap):\n";
+    multimapUsage<multimap<string, int>>();
+    cout << "\nMultimap Usage (FlatMultimap):\n";
+    multimapUsage<FlatMultimap<string, int>>();
     return 0;
 }
@@ -0,0 +1,63 @@
+#ifndef SORTED_SEARCH_H
+#define SORTED_SEARCH_H
+
+#include <cstddef> // For size_t
+
+/*
+Notes about searching a sorted array:
+
+1. **Branchless Binary Search**:
+   - std::lower_bound halves the range with an if/else on every step. The outcome of that
+     comparison is random for random keys, so the CPU mispredicts about half of them.
+   - Here every step moves `first` by either 0 or half, which compiles to a conditional move.
+     The loop runs exactly log2(n) times whatever the data, and the loads of the next steps
+     can start before the current comparison is known.
+
+2. **KeyOf**:
+   - Sets store the key itself, maps store std::pair<Key, Value>; KeyOf picks the key out of a
+     stored element so one search serves both.
+*/
+
+namespace sorted_search {
+
+struct SetKeyOf {
+    template <typename Key>
+    static const Key& key(const Key& slot) { return slot; }
+};
+
+struct MapKeyOf {
+    template <typename Pair>
+    static const typename Pair::first_type& key(const Pair& slot) { return slot.first; }
+};
+
+// Index of the first of count elements whose key is not less than key (like std::lower_bound)
+template <typename KeyOf, typename Slot, typename K, typename Compare>
+size_t lowerBound(const Slot* first, size_t count, const K& key, const Compare& less) {
+    const Slot* base = first;
+    size_t length = count;
+    while (length > 1) {
+        size_t half = length / 2;
+        base += less(KeyOf::key(base[half - 1]), key) ? half : 0; // Answer is in [base, base + length)
+        length -= half;
+    }
+    if (length == 1 && less(KeyOf::key(*base), key)) ++base;
+    return static_cast<size_t>(base - first);
+}
+
+// Index of the first of count elements whose key is greater than key (like std::upper_bound)
+template <typename KeyOf, typename Slot, typename K, typename Compare>
+size_t upperBound(const Slot* first, size_t count, const K& key, const Compare& less) {
+    const Slot* base = first;
+    size_t length = count;
+    while (length > 1) {
+        size_t half = length / 2;
+        base += !less(key, KeyOf::key(base[half - 1])) ? half : 0;
+        length -= half;
+    }
+    if (length == 1 && !less(key, KeyOf::key(*base))) ++base;
+    return static_cast<size_t>(base - first);
+}
+
+} // namespace sorted_search
+
+#endif // SORTED_SEARCH_H
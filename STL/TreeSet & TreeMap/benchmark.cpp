@@ -0,0 +1,112 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <set>
+#include <vector>
+#include "BTree.h"
+#include "FlatMap.h"
+
+using namespace std;
+
+/*
+Benchmark: std::set vs FlatSet vs BTreeSet
+
+- Read-mostly: build a table of 1M random ints (std::set and BTreeSet one insert at a time,
+  FlatSet in one bulk build), then 1M random lower_bound and upper_bound queries and one
+  full in-order scan.
+- Write-heavy: 200K random inserts and erases (half each) on a table kept at about 100K
+  elements, the case where FlatSet has to shift half its elements on every change.
+- Every number is nanoseconds per element/operation.
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static volatile int64_t sink; // Keeps the optimizer from deleting the queries
+
+template <typename Func>
+double nsPerOp(size_t operations, Func&& func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() / operations;
+}
+
+template <typename Set>
+void queries(const char* name, double buildNs, const Set& table, const vector<int>& probes) {
+    double lowerNs = nsPerOp(probes.size(), [&] {
+        int64_t sum = 0;
+        for (int probe : probes) {
+            auto it = table.lower_bound(probe);
+            if (it != table.end()) sum += *it;
+        }
+        sink = sum;
+    });
+    double upperNs = nsPerOp(probes.size(), [&] {
+        int64_t sum = 0;
+        for (int probe : probes) {
+            auto it = table.upper_bound(probe);
+            if (it != table.end()) sum += *it;
+        }
+        sink = sum;
+    });
+    double scanNs = nsPerOp(table.size(), [&] {
+        int64_t sum = 0;
+        for (int value : table) sum += value;
+        sink = sum;
+    });
+    cout << "  " << name << ": build " << buildNs << ", lower_bound " << lowerNs << ", upper_bound " << upperNs
+         << ", scan " << scanNs << " ns" << endl;
+}
+
+template <typename Set>
+void oneByOne(const char* name, const vector<int>& keys, const vector<int>& probes) {
+    Set table;
+    double buildNs = nsPerOp(keys.size(), [&] {
+        for (int key : keys) table.insert(key);
+    });
+    queries(name, buildNs, table, probes);
+}
+
+template <typename Set>
+void writeHeavy(const char* name, const vector<int>& initial, const vector<int>& changes) {
+    Set table;
+    for (int key : initial) table.insert(key);
+    double ns = nsPerOp(changes.size(), [&] {
+        for (size_t i = 0; i < changes.size(); ++i) {
+            if (i % 2 == 0) {
+                table.insert(changes[i]);
+            } else {
+                auto it = table.lower_bound(changes[i]); // A random existing element
+                table.erase(it == table.end() ? table.begin() : it);
+            }
+        }
+    });
+    sink = static_cast<int64_t>(table.size());
+    cout << "  " << name << ": " << ns << " ns per insert/erase (" << table.size() << " elements left)" << endl;
+}
+
+int main() {
+    mt19937 random(7);
+    vector<int> keys(1000000), probes(1000000);
+    for (int& key : keys) key = static_cast<int>(random());
+    for (int& probe : probes) probe = static_cast<int>(random());
+
+    cout << "Read-mostly, " << keys.size() << " keys, " << probes.size() << " queries:" << endl;
+    oneByOne<set<int>>("std::set", keys, probes);
+    {
+        FlatSet<int> table;
+        double buildNs = nsPerOp(keys.size(), [&] { table = FlatSet<int>(keys); });
+        queries("FlatSet ", buildNs, table, probes);
+    }
+    oneByOne<BTreeSet<int>>("BTreeSet", keys, probes);
+
+    vector<int> initial(keys.begin(), keys.begin() + 100000);
+    vector<int> changes(200000);
+    for (int& change : changes) change = static_cast<int>(random());
+    cout << "Write-heavy, " << changes.size() << " inserts/erases on ~" << initial.size() << " elements:" << endl;
+    writeHeavy<set<int>>("std::set", initial, changes);
+    writeHeavy<FlatSet<int>>("FlatSet ", initial, changes);
+    writeHeavy<BTreeSet<int>>("BTreeSet", initial, changes);
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <set>
 #include <map>
+#include "BTree.h"
+#include "FlatMap.h"
 
 using namespace std;
 
@@ -44,10 +46,20 @@ using namespace std;
  *      - end(): Returns an iterator to one past the last key-value pair.
  *      - rbegin(): Returns a reverse iterator to the last key-value pair.
  *      - rend(): Returns a reverse iterator to before the first key-value pair.
+ *
+ * 3. **Drop-in Alternatives** (same operations as above):
+ *    - FlatSet / FlatMap (FlatMap.h): one sorted vector. Fastest lookups and iteration, but
+ *      every insert/erase shifts elements, so build in bulk (constructor or insert(first, last))
+ *      and then query.
+ *    - BTreeSet / BTreeMap (BTree.h): many elements per node, so far fewer cache misses per
+ *      lookup than a red-black tree while inserts and erases stay O(log n).
+ *    - Both invalidate iterators on insert/erase, unlike std::set/std::map.
+ *    - The usage functions below are templates, so each one runs on all three.
  */
 
+template <typename Set>
 void setUsage() {
-    set<int> s; // Initialize an empty set
+    Set s; // Initialize an empty set
     s.insert(10); // Add an element
     s.insert(20);
     s.insert(30);
@@ -89,8 +101,9 @@ void setUsage() {
     cout << endl;
 }
 
+template <typename Map>
 void mapUsage() {
-    map<string, int> m; // Initialize an empty map
+    Map m; // Initialize an empty map
     m["Alice"] = 25; // Add key-value pairs
     m["Bob"] = 30;
     m["Charlie"] = 35;
@@ -121,7 +134,7 @@ void mapUsage() {
 
     // Lower and upper bounds
     cout << "Lower bound for 'Bob': " << m.lower_bound("Bob")->first << endl; // Output: David
-    cout << "Upper bound for 'Bob': " << m.upper_bound("Bob")->first << endl; // Output: Eve
+    cout << "Upper bound for 'Bob': " << m.upper_bound("Bob")->first << endl; // Output: David
 
     // Iterators
     cout << "Map elements using iterators:\n";
@@ -129,9 +142,21 @@ void mapUsage() {
 }
 
 int main() {
-    cout << "Set Usage:\n";
-    setUsage(); 
-    cout << "\nMap Usage:\n";
-    mapUsage(); 
-    return 0; 
+    cout << "Set Usage (std::set):\n";
+    setUsage<set<int>>();
+    cout << "\nSet Usage (FlatSet):\n";
+    setUsage<FlatSet<int>>();
+    cout << "\nSet Usage (BTreeSet):\n";
+    setUsage<BTreeSet<int>>();
+    cout << "\nMap Usage (std::map):\n";
+    mapUsage<map<string, int>>();
+    cout << "\nMap Usage (FlatMap):\n";
+    mapUsage<FlatMap<string, int>>();
+    cout << "\nMap Usage (BTreeMap):\n";
+    mapUsage<BTreeMap<string, int>>();
+
+    // Bulk build, then query: one sort instead of one insert per element
+    FlatMap<int, string> table(vector<pair<int, string>>{{30, "thirty"}, {10, "ten"}, {20, "twenty"}});
+    cout << "\nFlatMap built in bulk, first key >= 15: " << table.lower_bound(15)->second << endl; // Output: twenty
+    return 0;
 }
@@ -1,129 +1,19 @@
 #include <iostream>
-#include <queue>
+#include <utility> // For std::move
 #include <vector>
+#include "BinaryTree.h" // TreeNode, BinaryTree and PooledBinaryTree
+#include "FlatBinaryTree.h" // Array-backed FlatBinaryTree
+#include "TreeSerialization.h" // saveTree, loadTree, streamTree and MappedTreeFile
+#include "ParallelBinaryTree.h" // Parallel build and reductions on a TaskPool
+#include <cstdio> // For std::remove
 
 using namespace std;
 
-// TreeNode structure to represent each node in the tree
-struct TreeNode {
-    int data;
-    TreeNode* left;
-    TreeNode* right;
-
-    // Constructor to initialize the node with data
-    TreeNode(int value) : data(value), left(nullptr), right(nullptr) {}
-};
-
-// BinaryTree class to manage the binary tree
-class BinaryTree {
-    int preorderIndex;
-    int postorderIndex;
-
-public:
-    TreeNode* root;
-
-    BinaryTree() : root(nullptr), preorderIndex(0), postorderIndex(0) {}
-    // Helper function for inorder traversal
-    void inorderRec(TreeNode* node) {
-        if (node != nullptr) {
-            inorderRec(node->left);
-            cout << node->data << " ";
-            inorderRec(node->right);
-        }
-    }
-
-    // Helper function to construct tree from preorder array
-    TreeNode* constructTreeFromPreorderHelper(const vector<int>& preorder) {
-        if (preorderIndex >= preorder.size() || preorder[preorderIndex] == -1) {
-            preorderIndex++;
-            return nullptr;
-        }
-
-        TreeNode* node = new TreeNode(preorder[preorderIndex++]);
-
-        node->left = constructTreeFromPreorderHelper(preorder);
-        node->right = constructTreeFromPreorderHelper(preorder);
-
-        return node;
-    }
-
-    // Helper function to construct tree from postorder array
-    TreeNode* constructTreeFromPostorderHelper(const vector<int>& postorder) {
-        if (postorderIndex >= postorder.size() || postorder[postorderIndex] == -1) {
-            postorderIndex++;
-            return nullptr;
-        }
-
-        TreeNode* node = new TreeNode(postorder[postorderIndex++]);
-
-        // Note: Postorder traversal processes the right child before the left child
-        node->right = constructTreeFromPostorderHelper(postorder);
-        node->left = constructTreeFromPostorderHelper(postorder);
-
-        return node;
-    }
-
-
-
-    // Method to construct a binary tree from a level order array
-    void constructTreeFromLevelOrder(const vector<int>& levelOrder) {
-        if (levelOrder.empty()) {
-            return;
-        }
-
-        root = new TreeNode(levelOrder[0]);
-        queue<TreeNode*> queue;
-        queue.push(root);
-
-        int i = 0;
-        while (!queue.empty()) {
-            TreeNode* current = queue.front();
-            queue.pop();
-
-            // Calculate indices for left and right children
-            int leftIndex = 2 * i + 1;
-            int rightIndex = 2 * i + 2;
-
-            // Left child
-            if (leftIndex < levelOrder.size() && levelOrder[leftIndex] != -1) {
-                current->left = new TreeNode(levelOrder[leftIndex]);
-                queue.push(current->left);
-            }
-
-            // Right child
-            if (rightIndex < levelOrder.size() && levelOrder[rightIndex] != -1) {
-                current->right = new TreeNode(levelOrder[rightIndex]);
-                queue.push(current->right);
-            }
-
-            i++;
-        }
-    }
-
-    // Method to construct a binary tree from preorder array
-    void constructTreeFromPreorder(const vector<int>& preorder) {
-        preorderIndex = 0;
-        root = constructTreeFromPreorderHelper(preorder);
-    }
-
-    // Method to construct a binary tree from postorder array
-    void constructTreeFromPostorder(const vector<int>& postorder) {
-        postorderIndex = 0;
-        root = constructTreeFromPostorderHelper(postorder);
-    }
-
-    // Method for inorder traversal
-    void inorder() {
-        inorderRec(root);
-        cout << endl;
-    }
-};
-
 int main() {
     BinaryTree tree;
     vector<int> levelOrder = {1, 2, 3, 4, 5, -1, 6};
     vector<int> preorder = {1, 2, 4, -1, -1, 5, -1, -1, 3, -1, 6, -1, -1};
-    vector<int> postorder = {4, -1, -1, 5, -1, -1, 2, -1, 6, -1, -1, 3, 1};
+    vector<int> postorder = {-1, -1, 4, -1, -1, 5, 2, -1, -1, -1, 6, 3, 1};
 
     // Construct the tree from level order
     tree.constructTreeFromLevelOrder(levelOrder);
@@ -140,5 +30,98 @@ int main() {
     cout << "Inorder traversal of tree constructed from postorder: ";
     tree.inorder();
 
+    // Ownership can be handed over without copying any node
+    BinaryTree movedTree = std::move(tree);
+    cout << "Inorder traversal of moved-to tree: ";
+    movedTree.inorder();
+
+    // Other traversal orders, collected through a visitor instead of printed
+    vector<int> values;
+    movedTree.forEachPreorder([&](int value) { values.push_back(value); });
+    cout << "Preorder: ";
+    for (int value : values) cout << value << " "; // Output: 1 2 4 5 3 6
+    cout << endl;
+    int sum = 0;
+    movedTree.forEachPostorder([&](int value) { sum += value; });
+    cout << "Sum of all values (postorder visit): " << sum << endl; // Output: 21
+    cout << "Level order: ";
+    movedTree.forEachLevelOrder([](int value) { cout << value << " "; }); // Output: 1 2 3 4 5 6
+    cout << endl;
+    cout << "Morris inorder: ";
+    movedTree.morrisInorder([](int value) { cout << value << " "; }); // Output: 4 2 5 1 3 6
+    cout << endl;
+
+    // A degenerate (linked-list-shaped) tree far deeper than the call stack allows
+    vector<int> deepPreorder;
+    for (int i = 0; i < 500000; ++i) {
+        deepPreorder.push_back(i);
+        deepPreorder.push_back(-1); // Every node only has a right child
+    }
+    deepPreorder.push_back(-1);
+    BinaryTree deepTree;
+    deepTree.constructTreeFromPreorder(deepPreorder);
+    long long deepSum = 0;
+    deepTree.forEachInorder([&](int value) { deepSum += value; });
+    cout << "Sum over a 500000-deep tree: " << deepSum << endl; // Output: 124999750000
+
+    // Same tree backed by a node pool: every rebuild is one reset of the pool
+    PooledBinaryTree pooledTree;
+    for (int request = 0; request < 3; ++request) {
+        pooledTree.constructTreeFromPreorder(preorder); // Reuses the nodes of the previous build
+    }
+    cout << "Inorder traversal of pooled tree rebuilt 3 times: ";
+    pooledTree.inorder();
+
+    // Level order with a hole: 2 has no left child, so 4's entries follow 3's directly
+    vector<int> levelOrderWithHoles = {1, 2, 3, -1, 4, 5, 6, 7, -1, -1, 8};
+    tree.constructTreeFromLevelOrder(levelOrderWithHoles);
+    cout << "Inorder traversal of tree with holes: ";
+    tree.inorder(); // Output: 2 7 4 1 5 8 3 6
+
+    // Same API on the contiguous, pointer-free layout
+    FlatBinaryTree flatTree;
+    flatTree.constructTreeFromLevelOrder(levelOrder);
+    cout << "Inorder traversal of flat tree constructed from level order: ";
+    flatTree.inorder();
+    flatTree.constructTreeFromPostorder(postorder);
+    cout << "Inorder traversal of flat tree constructed from postorder: ";
+    flatTree.inorder();
+    flatTree.constructTreeFromLevelOrder(levelOrderWithHoles);
+    cout << "Flat tree with holes: " << flatTree.size() << " nodes in " << flatTree.slotCount() << " slots, inorder: ";
+    flatTree.inorder(); // Output: 2 7 4 1 5 8 3 6
+
+    // Binary files: write once, then load without parsing any text
+    tree.constructTreeFromPreorder(preorder);
+    saveTree(tree, "tree_preorder.bin");
+    BinaryTree loadedTree;
+    loadTree(loadedTree, "tree_preorder.bin"); // Built straight from the mapped file
+    cout << "Inorder traversal of tree loaded from file: ";
+    loadedTree.inorder();
+    PooledBinaryTree streamedTree;
+    streamTree(streamedTree, "tree_preorder.bin", 4); // Read 4 values at a time
+    cout << "Inorder traversal of tree streamed from file: ";
+    streamedTree.inorder();
+
+    flatTree.constructTreeFromLevelOrder(levelOrder);
+    saveTree(flatTree, "tree_flat.bin");
+    {
+        MappedTreeFile mapped("tree_flat.bin");
+        cout << "Inorder traversal of memory-mapped flat tree: ";
+        mapped.flatView().inorder(); // The mapped bytes are the tree, nothing is built
+    }
+    remove("tree_preorder.bin");
+    remove("tree_flat.bin");
+
+    // Parallel build and reductions: subtrees are found with a pre-scan and built on the pool
+    TaskPool pool(4);
+    PooledBinaryTree parallelTree;
+    constructTreeFromPreorderParallel(parallelTree, deepPreorder, pool, 1024);
+    cout << "Parallel build of the 500000-deep tree: " << parallelCount(parallelTree, pool) << " nodes, height "
+         << parallelHeight(parallelTree, pool) << ", sum " << parallelSum(parallelTree, pool) << endl;
+    parallelTransform(parallelTree, pool, [](int value) { return value * 2; });
+    long long maxValue = parallelMapReduce(parallelTree, pool, 0LL, [](int value) { return (long long)value; },
+                                           [](long long a, long long b) { return a > b ? a : b; });
+    cout << "Largest value after doubling every value: " << maxValue << endl; // Output: 999998
+
     return 0;
 }
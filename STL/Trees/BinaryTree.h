@@ -0,0 +1,321 @@
+#ifndef BINARY_TREE_H
+#define BINARY_TREE_H
+
+#include <cstddef> // For size_t
+#include <iostream>
+#include <queue>
+#include <utility> // For std::move
+#include <vector>
+#include "../Allocators/NodePool.h" // HeapNodeAllocator and NodePool
+#include "../Iterators/FastIO.h" // For IntWriter
+
+// TreeNode structure to represent each node in the tree
+struct TreeNode {
+    int data;
+    TreeNode* left;
+    TreeNode* right;
+
+    // Constructor to initialize the node with data
+    TreeNode(int value) : data(value), left(nullptr), right(nullptr) {}
+};
+
+// BinaryTree class to manage the binary tree
+// NodeAllocator decides where nodes come from: plain new/delete or a NodePool.
+template <typename NodeAllocator>
+class BasicBinaryTree {
+    NodeAllocator nodes; // Creates and destroys the nodes of this tree
+
+    // Free a subtree node by node without recursion or an explicit stack:
+    // rotate each left child up until the node has no left child, then the node
+    // can be freed and the walk continues down its right child.
+    void destroyNodes(TreeNode* node) {
+        while (node != nullptr) {
+            if (node->left != nullptr) {
+                TreeNode* left = node->left;
+                node->left = left->right; // Right rotation at node
+                left->right = node;
+                node = left;
+            } else {
+                TreeNode* right = node->right;
+                nodes.destroy(node);
+                node = right;
+            }
+        }
+    }
+
+public:
+    TreeNode* root;
+
+    BasicBinaryTree() : root(nullptr) {}
+
+    // The tree owns its nodes, so it can be moved but not copied
+    BasicBinaryTree(const BasicBinaryTree&) = delete;
+    BasicBinaryTree& operator=(const BasicBinaryTree&) = delete;
+
+    BasicBinaryTree(BasicBinaryTree&& other) noexcept
+        : nodes(std::move(other.nodes)), root(other.root) {
+        other.root = nullptr; // Leave the other tree empty but valid
+    }
+
+    BasicBinaryTree& operator=(BasicBinaryTree&& other) noexcept {
+        if (this != &other) {
+            clear(); // Free our own nodes before taking over the other tree's
+            nodes = std::move(other.nodes);
+            root = other.root;
+            other.root = nullptr;
+        }
+        return *this;
+    }
+
+    ~BasicBinaryTree() {
+        clear();
+    }
+
+    // Take ownership of the nodes another allocator created (e.g. in a worker thread)
+    void adoptNodes(NodeAllocator&& other) {
+        nodes.absorb(std::move(other));
+    }
+
+    // Free every node: one by one with new/delete, a single reset with a pool.
+    // A pooled tree keeps its chunks, so the next build reuses the same memory.
+    void clear() {
+        if constexpr (NodeAllocator::supportsBulkRelease) {
+            nodes.reset();
+        } else {
+            destroyNodes(root);
+        }
+        root = nullptr;
+    }
+
+    // Like clear(), but a pooled tree also gives its chunks back to the system.
+    // For builds whose nodes come from other allocators (see adoptNodes), where kept chunks would never be reused.
+    void releaseNodes() {
+        if constexpr (NodeAllocator::supportsBulkRelease) {
+            nodes.releaseAll();
+        } else {
+            destroyNodes(root);
+        }
+        root = nullptr;
+    }
+
+    // Visit every value in inorder (left, node, right) using an explicit stack,
+    // so the depth of the tree is limited by heap memory, not the call stack
+    template <typename Visitor>
+    void forEachInorder(Visitor&& visit) const {
+        std::vector<const TreeNode*> stack;
+        const TreeNode* node = root;
+        while (node != nullptr || !stack.empty()) {
+            while (node != nullptr) {
+                stack.push_back(node); // Walk down the left spine
+                node = node->left;
+            }
+            node = stack.back();
+            stack.pop_back();
+            visit(node->data);
+            node = node->right;
+        }
+    }
+
+    // Visit every value in preorder (node, left, right)
+    template <typename Visitor>
+    void forEachPreorder(Visitor&& visit) const {
+        if (root == nullptr) return;
+        std::vector<const TreeNode*> stack = {root};
+        while (!stack.empty()) {
+            const TreeNode* node = stack.back();
+            stack.pop_back();
+            visit(node->data);
+            if (node->right) stack.push_back(node->right); // Pushed first, so visited after the left subtree
+            if (node->left) stack.push_back(node->left);
+        }
+    }
+
+    // Visit every value in postorder (left, right, node)
+    template <typename Visitor>
+    void forEachPostorder(Visitor&& visit) const {
+        std::vector<const TreeNode*> stack;
+        const TreeNode* node = root;
+        const TreeNode* lastVisited = nullptr;
+        while (node != nullptr || !stack.empty()) {
+            while (node != nullptr) {
+                stack.push_back(node);
+                node = node->left;
+            }
+            const TreeNode* top = stack.back();
+            if (top->right != nullptr && top->right != lastVisited) {
+                node = top->right; // Right subtree not done yet
+            } else {
+                visit(top->data); // Both subtrees done
+                lastVisited = top;
+                stack.pop_back();
+            }
+        }
+    }
+
+    // Visit every value level by level, left to right
+    template <typename Visitor>
+    void forEachLevelOrder(Visitor&& visit) const {
+        if (root == nullptr) return;
+        std::queue<const TreeNode*> pending;
+        pending.push(root);
+        while (!pending.empty()) {
+            const TreeNode* node = pending.front();
+            pending.pop();
+            visit(node->data);
+            if (node->left) pending.push(node->left);
+            if (node->right) pending.push(node->right);
+        }
+    }
+
+    // Morris inorder traversal: O(1) extra memory. Each node's inorder predecessor
+    // temporarily points back to it (a "thread"), which is removed on the second visit,
+    // so the tree is unchanged afterwards - but it must not be read concurrently.
+    template <typename Visitor>
+    void morrisInorder(Visitor&& visit) {
+        TreeNode* node = root;
+        while (node != nullptr) {
+            if (node->left == nullptr) {
+                visit(node->data);
+                node = node->right;
+                continue;
+            }
+            TreeNode* predecessor = node->left;
+            while (predecessor->right != nullptr && predecessor->right != node) {
+                predecessor = predecessor->right;
+            }
+            if (predecessor->right == nullptr) {
+                predecessor->right = node; // Thread back to node, then go left
+                node = node->left;
+            } else {
+                predecessor->right = nullptr; // Left subtree done, remove the thread
+                visit(node->data);
+                node = node->right;
+            }
+        }
+    }
+
+    // Method to construct a binary tree from a level order array (-1 = null)
+    // Children are read in order from a cursor: a null node has no entries for its
+    // children, so the array can't be indexed as 2*i+1 / 2*i+2 once holes appear.
+    void constructTreeFromLevelOrder(const std::vector<int>& levelOrder) {
+        clear(); // Rebuilding replaces (and frees) the previous tree
+        if (levelOrder.empty() || levelOrder[0] == -1) {
+            return;
+        }
+
+        root = nodes.create(levelOrder[0]);
+        std::queue<TreeNode*> pending;
+        pending.push(root);
+
+        size_t next = 1; // Next unread entry of levelOrder
+        while (!pending.empty() && next < levelOrder.size()) {
+            TreeNode* current = pending.front();
+            pending.pop();
+
+            // Left child
+            if (levelOrder[next] != -1) {
+                current->left = nodes.create(levelOrder[next]);
+                pending.push(current->left);
+            }
+            next++;
+
+            // Right child
+            if (next < levelOrder.size() && levelOrder[next] != -1) {
+                current->right = nodes.create(levelOrder[next]);
+                pending.push(current->right);
+            }
+            next++;
+        }
+    }
+
+    // Builds a tree from preorder values that arrive in pieces (e.g. read from a file in
+    // chunks), so the whole array never has to exist in memory at once.
+    // A stack holds the child slots still waiting for a value, so a degenerate input
+    // of any length cannot overflow the call stack.
+    class PreorderBuilder {
+        NodeAllocator& nodes;
+        std::vector<TreeNode**> pendingSlots;
+
+    public:
+        explicit PreorderBuilder(BasicBinaryTree& tree) : nodes(tree.nodes) {
+            tree.clear(); // Rebuilding replaces (and frees) the previous tree
+            pendingSlots.push_back(&tree.root);
+        }
+
+        // Build a subtree into *slot with nodes from the given allocator
+        PreorderBuilder(NodeAllocator& nodes, TreeNode** slot) : nodes(nodes) {
+            *slot = nullptr;
+            pendingSlots.push_back(slot);
+        }
+
+        // Consume the next count values (node, left, right; -1 = null)
+        void feed(const int* values, size_t count) {
+            for (size_t i = 0; i < count && !pendingSlots.empty(); ++i) {
+                TreeNode** slot = pendingSlots.back();
+                pendingSlots.pop_back();
+                if (values[i] == -1) {
+                    continue; // Slot stays null
+                }
+                TreeNode* node = nodes.create(values[i]);
+                *slot = node;
+                pendingSlots.push_back(&node->right); // Filled after the whole left subtree
+                pendingSlots.push_back(&node->left);
+            }
+        }
+
+        // True once every slot has been filled; later values are ignored
+        bool complete() const {
+            return pendingSlots.empty();
+        }
+    };
+
+    // Method to construct a binary tree from preorder values (node, left, right; -1 = null)
+    void constructTreeFromPreorder(const int* preorder, size_t count) {
+        PreorderBuilder builder(*this);
+        builder.feed(preorder, count);
+    }
+
+    // Method to construct a binary tree from preorder array
+    void constructTreeFromPreorder(const std::vector<int>& preorder) {
+        constructTreeFromPreorder(preorder.data(), preorder.size());
+    }
+
+    // Method to construct a binary tree from postorder array (left, right, node; -1 = null)
+    // Read backwards, postorder is "node, right, left", so it is built like preorder
+    // with the two children swapped.
+    void constructTreeFromPostorder(const std::vector<int>& postorder) {
+        clear(); // Rebuilding replaces (and frees) the previous tree
+        std::vector<TreeNode**> pendingSlots = {&root};
+        for (size_t i = postorder.size(); i-- > 0 && !pendingSlots.empty();) {
+            TreeNode** slot = pendingSlots.back();
+            pendingSlots.pop_back();
+            if (postorder[i] == -1) {
+                continue; // Slot stays null
+            }
+            TreeNode* node = nodes.create(postorder[i]);
+            *slot = node;
+            pendingSlots.push_back(&node->left); // Filled after the whole right subtree
+            pendingSlots.push_back(&node->right);
+        }
+    }
+
+    // Method for inorder traversal (formatted into blocks, not one cout << per node)
+    void inorder() const {
+        IntWriter out(std::cout);
+        forEachInorder([&out](int value) {
+            out.write(value);
+            out.put(' ');
+        });
+        out.put('\n');
+        out.flush();
+    }
+};
+
+// Every node is its own new/delete
+using BinaryTree = BasicBinaryTree<HeapNodeAllocator<TreeNode>>;
+
+// Nodes are carved out of contiguous chunks (an arena for the whole tree):
+// clear() and rebuilds are a single reset, and the chunks are freed with the tree
+using PooledBinaryTree = BasicBinaryTree<NodePool<TreeNode>>;
+
+#endif // BINARY_TREE_H
@@ -0,0 +1,312 @@
+#ifndef FLAT_BINARY_TREE_H
+#define FLAT_BINARY_TREE_H
+
+#include <cstddef> // For size_t
+#include <iostream>
+#include <queue>
+#include <stdexcept> // For std::length_error
+#include <vector>
+#include "../Iterators/FastIO.h" // For IntWriter
+
+/*
+Notes about the flat (implicit) tree layout:
+
+1. **Layout**:
+   - All nodes live in one contiguous array in heap order: the root is slot 0, and the
+     children of slot i are slots 2*i+1 and 2*i+2 (the parent of slot i is (i-1)/2).
+   - There are no child pointers. Moving around the tree is index arithmetic, and a whole
+     level of the tree is a contiguous run of slots, so scans stream through memory and the
+     hardware prefetcher can keep up.
+
+2. **Holes**:
+   - A missing node is a slot holding EMPTY (-1, the same sentinel the serialized arrays use).
+   - Complete or near-complete trees waste almost nothing. A degenerate (list-shaped) tree
+     of depth d would need 2^d slots, so the pointer-based BinaryTree is the right choice
+     there; building past maxSlots throws std::length_error.
+
+3. **Traversals**:
+   - Level order is a straight scan of the array.
+   - Inorder, preorder and postorder walk up via the parent index instead of keeping a stack,
+     so they need O(1) extra memory.
+
+4. **Owning Tree vs View**:
+   - FlatBinaryTreeView only points at slots that live somewhere else (a FlatBinaryTree, or a
+     memory-mapped file), and does all the reading and traversing.
+   - FlatBinaryTree owns its slots in a std::vector and builds them from the serialized arrays.
+*/
+
+// Read-only tree over slots stored elsewhere
+class FlatBinaryTreeView {
+private:
+    const int* slots; // slots[i] is the value at heap index i, or EMPTY
+    size_t numSlots;
+
+    // First node in postorder of the subtree at index: keep going down, left first
+    size_t firstPostorder(size_t index) const {
+        while (true) {
+            if (has(leftChild(index))) {
+                index = leftChild(index);
+            } else if (has(rightChild(index))) {
+                index = rightChild(index);
+            } else {
+                return index;
+            }
+        }
+    }
+
+public:
+    static constexpr int EMPTY = -1;
+
+    static size_t leftChild(size_t index) { return 2 * index + 1; }
+    static size_t rightChild(size_t index) { return 2 * index + 2; }
+    static size_t parent(size_t index) { return (index - 1) / 2; }
+    static bool isLeftChild(size_t index) { return index % 2 == 1; } // Left children have odd indices
+
+    FlatBinaryTreeView(const int* slots, size_t slotCount) : slots(slots), numSlots(slotCount) {}
+
+    // Is there a node at this index?
+    bool has(size_t index) const {
+        return index < numSlots && slots[index] != EMPTY;
+    }
+
+    int valueAt(size_t index) const {
+        return slots[index];
+    }
+
+    size_t slotCount() const { return numSlots; }
+    const int* data() const { return slots; }
+
+    // Visit every value in inorder (left, node, right)
+    template <typename Visitor>
+    void forEachInorder(Visitor&& visit) const {
+        if (!has(0)) return;
+        size_t index = 0;
+        while (has(leftChild(index))) index = leftChild(index);
+        while (true) {
+            visit(slots[index]);
+            if (has(rightChild(index))) {
+                index = rightChild(index); // Next is the leftmost node of the right subtree
+                while (has(leftChild(index))) index = leftChild(index);
+                continue;
+            }
+            while (index != 0 && !isLeftChild(index)) {
+                index = parent(index); // Finished a right subtree, keep climbing
+            }
+            if (index == 0) return;
+            index = parent(index); // Finished a left subtree: the parent is next
+        }
+    }
+
+    // Visit every value in preorder (node, left, right)
+    template <typename Visitor>
+    void forEachPreorder(Visitor&& visit) const {
+        if (!has(0)) return;
+        size_t index = 0;
+        while (true) {
+            visit(slots[index]);
+            if (has(leftChild(index))) {
+                index = leftChild(index);
+                continue;
+            }
+            if (has(rightChild(index))) {
+                index = rightChild(index);
+                continue;
+            }
+            // Leaf: climb until an unvisited right sibling shows up
+            while (index != 0 && !(isLeftChild(index) && has(index + 1))) {
+                index = parent(index);
+            }
+            if (index == 0) return;
+            index = index + 1; // The right sibling
+        }
+    }
+
+    // Visit every value in postorder (left, right, node)
+    template <typename Visitor>
+    void forEachPostorder(Visitor&& visit) const {
+        if (!has(0)) return;
+        size_t index = firstPostorder(0);
+        while (true) {
+            visit(slots[index]);
+            if (index == 0) return;
+            if (isLeftChild(index) && has(index + 1)) {
+                index = firstPostorder(index + 1); // Right sibling's subtree comes before the parent
+            } else {
+                index = parent(index);
+            }
+        }
+    }
+
+    // Visit every value level by level, left to right: a plain scan of the array
+    template <typename Visitor>
+    void forEachLevelOrder(Visitor&& visit) const {
+        for (size_t index = 0; index < numSlots; ++index) {
+            if (slots[index] != EMPTY) {
+                visit(slots[index]);
+            }
+        }
+    }
+
+    // Method for inorder traversal (formatted into blocks, not one cout << per node)
+    void inorder() const {
+        IntWriter out(std::cout);
+        forEachInorder([&out](int value) {
+            out.write(value);
+            out.put(' ');
+        });
+        out.put('\n');
+        out.flush();
+    }
+};
+
+class FlatBinaryTree {
+private:
+    std::vector<int> slots; // slots[i] is the value at heap index i, or EMPTY
+    size_t count; // Number of non-empty slots
+
+    // Make sure slot index exists, growing the array (filled with EMPTY) if needed
+    void ensureSlot(size_t index) {
+        if (index < slots.size()) {
+            return;
+        }
+        if (index >= maxSlots) {
+            throw std::length_error("FlatBinaryTree: tree is too deep for the implicit layout");
+        }
+        size_t newSize = slots.size() * 2 + 1; // Grow one level at a time
+        while (newSize <= index) {
+            newSize = newSize * 2 + 1;
+        }
+        slots.resize(newSize < maxSlots ? newSize : maxSlots, EMPTY);
+    }
+
+    void place(size_t index, int value) {
+        ensureSlot(index);
+        slots[index] = value;
+        count++;
+    }
+
+    static size_t leftChild(size_t index) { return FlatBinaryTreeView::leftChild(index); }
+    static size_t rightChild(size_t index) { return FlatBinaryTreeView::rightChild(index); }
+
+public:
+    static constexpr int EMPTY = FlatBinaryTreeView::EMPTY;
+    static constexpr size_t maxSlots = size_t(1) << 30; // 4 GiB of ints
+
+    FlatBinaryTree() : count(0) {}
+
+    FlatBinaryTreeView view() const {
+        return FlatBinaryTreeView(slots.data(), slots.size());
+    }
+
+    // Is there a node at this index?
+    bool has(size_t index) const {
+        return index < slots.size() && slots[index] != EMPTY;
+    }
+
+    int valueAt(size_t index) const {
+        return slots[index];
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t slotCount() const { return slots.size(); } // Memory footprint, including holes
+
+    void clear() {
+        slots.clear(); // Keeps the capacity for the next build
+        count = 0;
+    }
+
+    // Take the slots as they are (e.g. from a file), in one copy
+    void assignSlots(const int* values, size_t valueCount) {
+        if (valueCount > maxSlots) {
+            throw std::length_error("FlatBinaryTree: too many slots");
+        }
+        slots.assign(values, values + valueCount);
+        count = 0;
+        for (int value : slots) {
+            count += value != EMPTY;
+        }
+    }
+
+    // Method to construct a binary tree from a level order array (-1 = null)
+    void constructTreeFromLevelOrder(const std::vector<int>& levelOrder) {
+        clear();
+        if (levelOrder.empty() || levelOrder[0] == -1) {
+            return;
+        }
+        slots.reserve(levelOrder.size()); // Exact for a complete tree
+        place(0, levelOrder[0]);
+
+        std::queue<size_t> pending; // Heap indices whose children are still to be read
+        pending.push(0);
+        size_t next = 1;
+        while (!pending.empty() && next < levelOrder.size()) {
+            size_t current = pending.front();
+            pending.pop();
+
+            if (levelOrder[next] != -1) {
+                place(leftChild(current), levelOrder[next]);
+                pending.push(leftChild(current));
+            }
+            next++;
+
+            if (next < levelOrder.size() && levelOrder[next] != -1) {
+                place(rightChild(current), levelOrder[next]);
+                pending.push(rightChild(current));
+            }
+            next++;
+        }
+    }
+
+    // Method to construct a binary tree from preorder array (node, left, right; -1 = null)
+    void constructTreeFromPreorder(const std::vector<int>& preorder) {
+        clear();
+        std::vector<size_t> pendingSlots = {0};
+        for (size_t i = 0; i < preorder.size() && !pendingSlots.empty(); ++i) {
+            size_t index = pendingSlots.back();
+            pendingSlots.pop_back();
+            if (preorder[i] == -1) {
+                continue;
+            }
+            place(index, preorder[i]);
+            pendingSlots.push_back(rightChild(index)); // Filled after the whole left subtree
+            pendingSlots.push_back(leftChild(index));
+        }
+    }
+
+    // Method to construct a binary tree from postorder array (left, right, node; -1 = null)
+    void constructTreeFromPostorder(const std::vector<int>& postorder) {
+        clear();
+        std::vector<size_t> pendingSlots = {0};
+        for (size_t i = postorder.size(); i-- > 0 && !pendingSlots.empty();) {
+            size_t index = pendingSlots.back();
+            pendingSlots.pop_back();
+            if (postorder[i] == -1) {
+                continue;
+            }
+            place(index, postorder[i]);
+            pendingSlots.push_back(leftChild(index)); // Filled after the whole right subtree
+            pendingSlots.push_back(rightChild(index));
+        }
+    }
+
+    // Traversals run on the view
+    template <typename Visitor>
+    void forEachInorder(Visitor&& visit) const { view().forEachInorder(visit); }
+
+    template <typename Visitor>
+    void forEachPreorder(Visitor&& visit) const { view().forEachPreorder(visit); }
+
+    template <typename Visitor>
+    void forEachPostorder(Visitor&& visit) const { view().forEachPostorder(visit); }
+
+    template <typename Visitor>
+    void forEachLevelOrder(Visitor&& visit) const { view().forEachLevelOrder(visit); }
+
+    // Method for inorder traversal
+    void inorder() const {
+        view().inorder();
+    }
+};
+
+#endif // FLAT_BINARY_TREE_H
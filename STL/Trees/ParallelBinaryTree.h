@@ -0,0 +1,256 @@
+#ifndef PARALLEL_BINARY_TREE_H
+#define PARALLEL_BINARY_TREE_H
+
+#include <algorithm> // For std::max
+#include <cstddef> // For size_t
+#include <cstdint> // For uint32_t
+#include <limits>
+#include <mutex>
+#include <utility> // For std::move
+#include <vector>
+#include "BinaryTree.h"
+#include "../../Concurrency/TaskPool.h"
+
+/*
+Notes about building and reducing trees in parallel:
+
+1. **Finding Subtrees in a Preorder Array**:
+   - In "node, left, right" order with -1 for null children, every subtree is one contiguous
+     run of the array. span[i] is the length of the run that starts at i: 1 for a -1, and
+     1 + span(left) + span(right) for a node, where the left subtree starts at i + 1 and the
+     right one right after it. One right-to-left pass computes all of them.
+   - With the spans known, the left and right subtrees of any node can be built at the same
+     time - there is no shared "current index" to fight over.
+
+2. **Parallel Build**:
+   - A task keeps walking down into the bigger child of each node. The smaller child becomes a
+     new task on the pool if it spans more than grainSize values, and is built on the spot
+     with the ordinary iterative PreorderBuilder otherwise. Every task therefore owns more
+     than grainSize values (at most n / grainSize tasks), and walking in a loop instead of
+     recursing keeps the call stack flat even for degenerate trees.
+   - Each task allocates from its own NodeAllocator, so a NodePool needs no locking. When a
+     task finishes it hands its nodes to the tree with adoptNodes().
+
+3. **Parallel Reductions**:
+   - The top of the tree is walked until there are a few subtrees per worker. Each subtree is
+     reduced by one task, and the partial results are combined at the end.
+   - The combine function must be associative and commutative (sum, count, max, ...):
+     partial results are not combined in traversal order.
+*/
+
+// span[i] = number of preorder values the subtree starting at i occupies.
+// span[count] = 0 is a sentinel: reading past the end is a null child with nothing to read.
+// A truncated array just gives shorter spans, so span[j] <= count - j and no index leaves the array.
+inline std::vector<uint32_t> computePreorderSpans(const int* values, size_t count) {
+    std::vector<uint32_t> span(count + 1, 0);
+    for (size_t i = count; i-- > 0;) {
+        if (values[i] == -1) {
+            span[i] = 1;
+        } else {
+            uint32_t left = span[i + 1];
+            span[i] = 1 + left + span[i + 1 + left];
+        }
+    }
+    return span;
+}
+
+template <typename NodeAllocator>
+class ParallelPreorderBuild {
+private:
+    using Tree = BasicBinaryTree<NodeAllocator>;
+
+    Tree& tree;
+    const int* values;
+    std::vector<uint32_t> span;
+    size_t grainSize;
+    std::mutex adoptLock;
+
+    size_t spanAt(size_t position) const {
+        return span[position]; // position <= count always, see computePreorderSpans
+    }
+
+    void buildSequential(NodeAllocator& nodes, size_t position, TreeNode** slot) {
+        typename Tree::PreorderBuilder builder(nodes, slot);
+        builder.feed(values + position, spanAt(position));
+    }
+
+    // Build the subtree starting at position into *slot
+    void buildSubtree(size_t position, TreeNode** slot, TaskGroup& group) {
+        NodeAllocator nodes; // This task's own allocator, no sharing
+        try {
+            while (spanAt(position) > grainSize) {
+                TreeNode* node = nodes.create(values[position]); // A big subtree always has a real root
+                *slot = node;
+                size_t left = position + 1;
+                size_t right = left + spanAt(left);
+                bool leftIsBigger = spanAt(left) >= spanAt(right);
+                size_t other = leftIsBigger ? right : left; // The smaller child
+                TreeNode** otherSlot = leftIsBigger ? &node->right : &node->left;
+                if (spanAt(other) > grainSize) {
+                    group.run([this, other, otherSlot, &group] { buildSubtree(other, otherSlot, group); });
+                } else {
+                    buildSequential(nodes, other, otherSlot);
+                }
+                position = leftIsBigger ? left : right; // Keep walking down the bigger child
+                slot = leftIsBigger ? &node->left : &node->right;
+            }
+            buildSequential(nodes, position, slot);
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(adoptLock);
+            tree.adoptNodes(std::move(nodes)); // Nodes already linked in must stay alive
+            throw;
+        }
+        std::lock_guard<std::mutex> guard(adoptLock);
+        tree.adoptNodes(std::move(nodes));
+    }
+
+public:
+    ParallelPreorderBuild(Tree& tree, const int* values, size_t count, size_t grainSize)
+        : tree(tree), values(values), span(computePreorderSpans(values, count)), grainSize(grainSize) {}
+
+    void run(TaskPool& pool) {
+        TaskGroup group(pool);
+        try {
+            buildSubtree(0, &tree.root, group); // The calling thread takes the root's biggest path
+        } catch (...) {
+            group.waitQuietly();
+            throw;
+        }
+        group.wait();
+    }
+};
+
+// Same result as tree.constructTreeFromPreorder(preorder), built on all workers of pool
+template <typename NodeAllocator>
+void constructTreeFromPreorderParallel(BasicBinaryTree<NodeAllocator>& tree, const std::vector<int>& preorder,
+                                       TaskPool& pool, size_t grainSize = 1 << 14) {
+    if (preorder.size() <= grainSize || preorder.size() > std::numeric_limits<uint32_t>::max()) {
+        tree.constructTreeFromPreorder(preorder); // Too small to be worth it (or too big for 32-bit spans)
+        return;
+    }
+    tree.releaseNodes(); // The tasks bring their own nodes, the old chunks would only pile up
+    ParallelPreorderBuild<NodeAllocator> build(tree, preorder.data(), preorder.size(), grainSize);
+    build.run(pool);
+}
+
+// Visit every node of a subtree, using an explicit stack
+template <typename Node, typename Visitor>
+void forEachNode(Node* subtree, Visitor&& visit) {
+    if (subtree == nullptr) return;
+    std::vector<Node*> stack = {subtree};
+    while (!stack.empty()) {
+        Node* node = stack.back();
+        stack.pop_back();
+        visit(node);
+        if (node->right) stack.push_back(node->right);
+        if (node->left) stack.push_back(node->left);
+    }
+}
+
+// Same, also passing each node's depth. Noticeably slower (twice the stack traffic),
+// so only used when the depth is actually needed.
+template <typename Node, typename Visitor>
+void forEachNodeWithDepth(Node* subtree, size_t depth, Visitor&& visit) {
+    if (subtree == nullptr) return;
+    std::vector<std::pair<Node*, size_t>> stack = {{subtree, depth}};
+    while (!stack.empty()) {
+        auto [node, nodeDepth] = stack.back();
+        stack.pop_back();
+        visit(node, nodeDepth);
+        if (node->right) stack.push_back({node->right, nodeDepth + 1});
+        if (node->left) stack.push_back({node->left, nodeDepth + 1});
+    }
+}
+
+// Walk the top of the tree breadth-first until there are about `pieces` subtrees left over.
+// Nodes walked on the way go to `top`, the left-over subtree roots to `subtrees`.
+template <typename Node>
+void splitTree(Node* root, size_t pieces, std::vector<std::pair<Node*, size_t>>& top,
+               std::vector<std::pair<Node*, size_t>>& subtrees) {
+    subtrees.clear();
+    if (root == nullptr) return;
+    subtrees.push_back({root, 0});
+    size_t next = 0; // subtrees[next, end) are still unsplit
+    size_t budget = pieces * 4; // Bounds the sequential part for degenerate trees
+    while (next < subtrees.size() && subtrees.size() - next < pieces && budget-- > 0) {
+        auto [node, depth] = subtrees[next++];
+        top.push_back({node, depth});
+        if (node->left) subtrees.push_back({node->left, depth + 1});
+        if (node->right) subtrees.push_back({node->right, depth + 1});
+    }
+    subtrees.erase(subtrees.begin(), subtrees.begin() + next);
+}
+
+// Fold every node into an R: accumulate(acc, node, depth) adds one node, combine merges two results.
+// depth is only tracked when WithDepth is true (it is 0 otherwise).
+template <bool WithDepth, typename Node, typename R, typename Accumulate, typename Combine>
+R parallelReduceNodes(Node* root, TaskPool& pool, R identity, Accumulate accumulate, Combine combine) {
+    std::vector<std::pair<Node*, size_t>> top, subtrees;
+    splitTree(root, pool.threadCount() * 4, top, subtrees);
+
+    R result = identity;
+    for (auto [node, depth] : top) {
+        accumulate(result, node, depth);
+    }
+
+    std::vector<R> partial(subtrees.size(), identity);
+    TaskGroup group(pool);
+    for (size_t i = 0; i < subtrees.size(); ++i) {
+        group.run([&, i] {
+            R acc = identity;
+            if constexpr (WithDepth) {
+                forEachNodeWithDepth(subtrees[i].first, subtrees[i].second,
+                                     [&](Node* node, size_t depth) { accumulate(acc, node, depth); });
+            } else {
+                forEachNode(subtrees[i].first, [&](Node* node) { accumulate(acc, node, 0); });
+            }
+            partial[i] = acc;
+        });
+    }
+    group.wait();
+
+    for (const R& value : partial) {
+        result = combine(result, value);
+    }
+    return result;
+}
+
+// combine(identity, map(value)) over every value; combine must be associative and commutative
+template <typename NodeAllocator, typename R, typename Map, typename Combine>
+R parallelMapReduce(const BasicBinaryTree<NodeAllocator>& tree, TaskPool& pool, R identity, Map map, Combine combine) {
+    const TreeNode* root = tree.root;
+    return parallelReduceNodes<false>(root, pool, identity,
+                                      [&](R& acc, const TreeNode* node, size_t) { acc = combine(acc, map(node->data)); },
+                                      combine);
+}
+
+template <typename NodeAllocator>
+long long parallelSum(const BasicBinaryTree<NodeAllocator>& tree, TaskPool& pool) {
+    return parallelMapReduce(tree, pool, 0LL, [](int value) { return (long long)value; },
+                             [](long long a, long long b) { return a + b; });
+}
+
+template <typename NodeAllocator>
+size_t parallelCount(const BasicBinaryTree<NodeAllocator>& tree, TaskPool& pool) {
+    return parallelMapReduce(tree, pool, size_t(0), [](int) { return size_t(1); },
+                             [](size_t a, size_t b) { return a + b; });
+}
+
+// Number of levels (0 for an empty tree)
+template <typename NodeAllocator>
+size_t parallelHeight(const BasicBinaryTree<NodeAllocator>& tree, TaskPool& pool) {
+    const TreeNode* root = tree.root;
+    return parallelReduceNodes<true>(root, pool, size_t(0),
+                                     [](size_t& acc, const TreeNode*, size_t depth) { acc = std::max(acc, depth + 1); },
+                                     [](size_t a, size_t b) { return std::max(a, b); });
+}
+
+// Replace every value with transform(value), in parallel
+template <typename NodeAllocator, typename Transform>
+void parallelTransform(BasicBinaryTree<NodeAllocator>& tree, TaskPool& pool, Transform transform) {
+    parallelReduceNodes<false>(tree.root, pool, 0,
+                               [&](int&, TreeNode* node, size_t) { node->data = transform(node->data); },
+                               [](int, int) { return 0; });
+}
+
+#endif // PARALLEL_BINARY_TREE_H
@@ -0,0 +1,320 @@
+#ifndef TREE_SERIALIZATION_H
+#define TREE_SERIALIZATION_H
+
+#include <cstddef> // For size_t
+#include <cstdint> // For fixed-width integers
+#include <cstdio> // For FILE, fopen, fread, fwrite
+#include <cstring> // For std::memcmp, std::memcpy
+#include <stdexcept> // For std::runtime_error
+#include <string>
+#include <vector>
+#include "BinaryTree.h"
+#include "FlatBinaryTree.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h> // For open
+#include <sys/mman.h> // For mmap, munmap
+#include <sys/stat.h> // For fstat
+#include <unistd.h> // For close
+#define TREE_FILE_HAS_MMAP 1
+#else
+#define TREE_FILE_HAS_MMAP 0
+#endif
+
+/*
+Notes about the binary tree file format:
+
+1. **Layout**:
+   - A 24-byte header (magic "TREE", version, layout, value count) followed by the values as
+     32-bit ints in the machine's native byte order, -1 marking a null child/empty slot.
+   - Preorder layout: "node, left, right" with -1 for every null child, the same array that
+     constructTreeFromPreorder takes. Written from (and loaded into) the pointer-based tree.
+   - Flat layout: the slots of a FlatBinaryTree exactly as they sit in memory.
+
+2. **Loading**:
+   - loadTree() maps the file into memory and builds straight from the mapped ints. There
+     is no text parsing and no intermediate std::vector<int>.
+   - MappedTreeFile::flatView() goes one step further for flat files: the mapped bytes *are*
+     the tree, so there are no per-node allocations and nothing to build at all.
+   - streamTree() reads the file in fixed-size chunks and feeds each one to a
+     PreorderBuilder, so memory use is one chunk plus the tree itself.
+
+3. **Portability**:
+   - Files are meant to be written and read on machines with the same byte order.
+   - Without mmap (e.g. on Windows) the file is read into a single buffer instead.
+*/
+
+static_assert(sizeof(int) == sizeof(int32_t), "tree files store values as 32-bit ints");
+
+enum class TreeFileLayout : uint32_t {
+    Preorder = 1,
+    Flat = 2,
+};
+
+struct TreeFileHeader {
+    char magic[4]; // "TREE"
+    uint32_t version;
+    uint32_t layout; // A TreeFileLayout
+    uint32_t reserved;
+    uint64_t valueCount; // Number of int32 values after the header
+};
+
+static_assert(sizeof(TreeFileHeader) == 24, "header must keep the values 8-byte aligned");
+
+constexpr uint32_t treeFileVersion = 1;
+
+// Buffered writer: values go out in large fwrite calls, not one by one
+class TreeFileWriter {
+private:
+    FILE* file;
+    std::vector<int> buffer;
+    uint64_t written;
+    std::string path;
+
+    void flush() {
+        if (!buffer.empty() && std::fwrite(buffer.data(), sizeof(int), buffer.size(), file) != buffer.size()) {
+            throw std::runtime_error("Failed to write tree file: " + path);
+        }
+        written += buffer.size();
+        buffer.clear();
+    }
+
+public:
+    TreeFileWriter(const std::string& path, TreeFileLayout layout) : file(std::fopen(path.c_str(), "wb")), written(0), path(path) {
+        if (!file) {
+            throw std::runtime_error("Cannot open tree file for writing: " + path);
+        }
+        buffer.reserve(1 << 16);
+        TreeFileHeader header = {{'T', 'R', 'E', 'E'}, treeFileVersion, static_cast<uint32_t>(layout), 0, 0};
+        if (std::fwrite(&header, sizeof(header), 1, file) != 1) { // Value count is patched in by finish()
+            std::fclose(file); // The destructor won't run for a throwing constructor
+            throw std::runtime_error("Failed to write tree file header: " + path);
+        }
+    }
+
+    TreeFileWriter(const TreeFileWriter&) = delete;
+    TreeFileWriter& operator=(const TreeFileWriter&) = delete;
+
+    ~TreeFileWriter() {
+        if (file) {
+            std::fclose(file); // finish() was never reached (an exception is on its way)
+        }
+    }
+
+    void write(int value) {
+        buffer.push_back(value);
+        if (buffer.size() == buffer.capacity()) {
+            flush();
+        }
+    }
+
+    void write(const int* values, size_t count) {
+        flush();
+        if (std::fwrite(values, sizeof(int), count, file) != count) {
+            throw std::runtime_error("Failed to write tree file: " + path);
+        }
+        written += count;
+    }
+
+    // Flush, record the value count in the header and close the file
+    void finish() {
+        flush();
+        bool failed = std::fseek(file, offsetof(TreeFileHeader, valueCount), SEEK_SET) != 0 ||
+                      std::fwrite(&written, sizeof(written), 1, file) != 1;
+        failed = std::fclose(file) != 0 || failed;
+        file = nullptr;
+        if (failed) {
+            throw std::runtime_error("Failed to write tree file: " + path);
+        }
+    }
+};
+
+// Read-only view of a whole file: mmap where available, one heap buffer otherwise
+class MappedFile {
+private:
+    const unsigned char* bytes;
+    size_t length;
+#if !TREE_FILE_HAS_MMAP
+    std::vector<unsigned char> contents;
+#endif
+
+public:
+    explicit MappedFile(const std::string& path) : bytes(nullptr), length(0) {
+#if TREE_FILE_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat file: " + path);
+        }
+        length = static_cast<size_t>(info.st_size);
+        if (length > 0) {
+            void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map file: " + path);
+            }
+            bytes = static_cast<const unsigned char*>(mapped);
+        }
+        ::close(fd); // The mapping stays valid after the descriptor is closed
+#else
+        FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        std::fseek(file, 0, SEEK_END);
+        long end = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        contents.resize(end > 0 ? static_cast<size_t>(end) : 0);
+        size_t got = std::fread(contents.data(), 1, contents.size(), file);
+        std::fclose(file);
+        if (got != contents.size()) {
+            throw std::runtime_error("Cannot read file: " + path);
+        }
+        bytes = contents.data();
+        length = contents.size();
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#if TREE_FILE_HAS_MMAP
+        if (bytes) {
+            ::munmap(const_cast<unsigned char*>(bytes), length);
+        }
+#endif
+    }
+
+    const unsigned char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+// Checks a header read from path, throwing if it isn't a tree file of this version
+inline void validateTreeFileHeader(const TreeFileHeader& header, uint64_t valuesAvailable, const std::string& path) {
+    if (std::memcmp(header.magic, "TREE", 4) != 0 || header.version != treeFileVersion) {
+        throw std::runtime_error("Not a tree file (or unsupported version): " + path);
+    }
+    if (header.valueCount > valuesAvailable) {
+        throw std::runtime_error("Truncated tree file: " + path);
+    }
+}
+
+// A mapped tree file; the values are read in place
+class MappedTreeFile {
+private:
+    MappedFile file;
+    TreeFileHeader header;
+    std::string path;
+
+public:
+    explicit MappedTreeFile(const std::string& path) : file(path), path(path) {
+        if (file.size() < sizeof(TreeFileHeader)) {
+            throw std::runtime_error("Not a tree file: " + path);
+        }
+        std::memcpy(&header, file.data(), sizeof(header));
+        validateTreeFileHeader(header, (file.size() - sizeof(TreeFileHeader)) / sizeof(int), path);
+    }
+
+    TreeFileLayout layout() const { return static_cast<TreeFileLayout>(header.layout); }
+    size_t valueCount() const { return static_cast<size_t>(header.valueCount); }
+
+    const int* values() const {
+        return reinterpret_cast<const int*>(file.data() + sizeof(TreeFileHeader)); // Page-aligned + 24
+    }
+
+    // The file itself as a tree: no allocation, no copying
+    FlatBinaryTreeView flatView() const {
+        if (layout() != TreeFileLayout::Flat) {
+            throw std::runtime_error("Not a flat tree file: " + path);
+        }
+        return FlatBinaryTreeView(values(), valueCount());
+    }
+};
+
+// Write a pointer-based tree as preorder values with -1 for every null child
+template <typename NodeAllocator>
+void saveTree(const BasicBinaryTree<NodeAllocator>& tree, const std::string& path) {
+    TreeFileWriter writer(path, TreeFileLayout::Preorder);
+    std::vector<const TreeNode*> stack = {tree.root};
+    while (!stack.empty()) {
+        const TreeNode* node = stack.back();
+        stack.pop_back();
+        if (node == nullptr) {
+            writer.write(-1);
+            continue;
+        }
+        writer.write(node->data);
+        stack.push_back(node->right); // Written after the whole left subtree
+        stack.push_back(node->left);
+    }
+    writer.finish();
+}
+
+// Write a flat tree's slots as they are
+inline void saveTree(const FlatBinaryTree& tree, const std::string& path) {
+    TreeFileWriter writer(path, TreeFileLayout::Flat);
+    FlatBinaryTreeView view = tree.view();
+    writer.write(view.data(), view.slotCount());
+    writer.finish();
+}
+
+// Build a pointer-based tree straight from a mapped preorder file
+template <typename NodeAllocator>
+void loadTree(BasicBinaryTree<NodeAllocator>& tree, const std::string& path) {
+    MappedTreeFile file(path);
+    if (file.layout() != TreeFileLayout::Preorder) {
+        throw std::runtime_error("Not a preorder tree file: " + path);
+    }
+    tree.constructTreeFromPreorder(file.values(), file.valueCount());
+}
+
+// Copy a mapped flat file into an owning FlatBinaryTree (one allocation)
+inline void loadTree(FlatBinaryTree& tree, const std::string& path) {
+    MappedTreeFile file(path);
+    FlatBinaryTreeView view = file.flatView();
+    tree.assignSlots(view.data(), view.slotCount());
+}
+
+// Build a pointer-based tree from a preorder file read chunkValues values at a time
+template <typename NodeAllocator>
+void streamTree(BasicBinaryTree<NodeAllocator>& tree, const std::string& path, size_t chunkValues = 1 << 16) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        throw std::runtime_error("Cannot open tree file: " + path);
+    }
+    TreeFileHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1) {
+        std::fclose(file);
+        throw std::runtime_error("Not a tree file: " + path);
+    }
+    try {
+        validateTreeFileHeader(header, header.valueCount, path);
+        if (static_cast<TreeFileLayout>(header.layout) != TreeFileLayout::Preorder) {
+            throw std::runtime_error("Not a preorder tree file: " + path);
+        }
+
+        typename BasicBinaryTree<NodeAllocator>::PreorderBuilder builder(tree);
+        std::vector<int> chunk(chunkValues > 0 ? chunkValues : 1);
+        uint64_t remaining = header.valueCount;
+        while (remaining > 0 && !builder.complete()) {
+            size_t want = remaining < chunk.size() ? static_cast<size_t>(remaining) : chunk.size();
+            size_t got = std::fread(chunk.data(), sizeof(int), want, file);
+            if (got != want) {
+                throw std::runtime_error("Truncated tree file: " + path);
+            }
+            builder.feed(chunk.data(), got);
+            remaining -= got;
+        }
+    } catch (...) {
+        std::fclose(file);
+        throw;
+    }
+    std::fclose(file);
+}
+
+#endif // TREE_SERIALIZATION_H
@@ -0,0 +1,161 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "BinaryTree.h"
+#include "FlatBinaryTree.h"
+#include "TreeSerialization.h"
+#include "ParallelBinaryTree.h"
+
+using namespace std;
+
+/*
+Benchmark: pointer-based BinaryTree / PooledBinaryTree vs array-backed FlatBinaryTree
+
+- Input is a complete tree of 2^20 - 1 nodes in level order, the case the flat layout is for.
+- Each tree is built from the same array, then walked inorder and in level order; every
+  number is the average over `rounds` runs.
+- Cold start: loading the same tree from a text file of numbers (parsed into a vector<int>
+  first) vs the binary format via loadTree (mmap), streamTree (chunked reads) and a
+  memory-mapped FlatBinaryTreeView.
+- Parallel: preorder build and sum on 1, 2, 4, ... workers of a TaskPool vs the sequential versions.
+
+Build: g++ -std=c++17 -O2 -pthread benchmark.cpp -o benchmark
+*/
+
+static volatile long long sink; // Keeps the optimizer from deleting the traversals
+
+template <typename Func>
+double averageMs(int rounds, Func&& func) {
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        func();
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count() / rounds;
+}
+
+template <typename Tree>
+void run(const char* name, const vector<int>& levelOrder, int rounds) {
+    Tree tree;
+    double buildMs = averageMs(rounds, [&] { tree.constructTreeFromLevelOrder(levelOrder); });
+
+    double inorderMs = averageMs(rounds, [&] {
+        long long sum = 0;
+        tree.forEachInorder([&](int value) { sum += value; });
+        sink = sum;
+    });
+
+    double levelOrderMs = averageMs(rounds, [&] {
+        long long sum = 0;
+        tree.forEachLevelOrder([&](int value) { sum += value; });
+        sink = sum;
+    });
+
+    cout << "  " << name << ": build " << buildMs << " ms, inorder " << inorderMs
+         << " ms, level order " << levelOrderMs << " ms" << endl;
+}
+
+int main() {
+    const int nodes = (1 << 20) - 1;
+    const int rounds = 10;
+
+    vector<int> levelOrder(nodes);
+    for (int i = 0; i < nodes; ++i) {
+        levelOrder[i] = i; // Complete tree, no holes
+    }
+
+    cout << "Complete tree with " << nodes << " nodes (" << rounds << " rounds):" << endl;
+    run<BinaryTree>("BinaryTree      ", levelOrder, rounds);
+    run<PooledBinaryTree>("PooledBinaryTree", levelOrder, rounds);
+    run<FlatBinaryTree>("FlatBinaryTree  ", levelOrder, rounds);
+
+    // Cold start from disk
+    PooledBinaryTree source;
+    source.constructTreeFromLevelOrder(levelOrder);
+    saveTree(source, "bench_preorder.bin");
+    {
+        ofstream text("bench_preorder.txt");
+        MappedTreeFile mapped("bench_preorder.bin");
+        for (size_t i = 0; i < mapped.valueCount(); ++i) {
+            text << mapped.values()[i] << ' ';
+        }
+    }
+    FlatBinaryTree flatSource;
+    flatSource.constructTreeFromLevelOrder(levelOrder);
+    saveTree(flatSource, "bench_flat.bin");
+
+    cout << "Loading the same tree from disk (" << rounds << " rounds):" << endl;
+    double textMs = averageMs(rounds, [&] {
+        ifstream text("bench_preorder.txt");
+        vector<int> values;
+        int value;
+        while (text >> value) values.push_back(value);
+        PooledBinaryTree tree;
+        tree.constructTreeFromPreorder(values);
+        sink = tree.root != nullptr;
+    });
+    double loadMs = averageMs(rounds, [&] {
+        PooledBinaryTree tree;
+        loadTree(tree, "bench_preorder.bin");
+        sink = tree.root != nullptr;
+    });
+    double streamMs = averageMs(rounds, [&] {
+        PooledBinaryTree tree;
+        streamTree(tree, "bench_preorder.bin");
+        sink = tree.root != nullptr;
+    });
+    double mappedMs = averageMs(rounds, [&] {
+        MappedTreeFile mapped("bench_flat.bin");
+        long long sum = 0;
+        mapped.flatView().forEachLevelOrder([&](int value) { sum += value; }); // Includes touching every page
+        sink = sum;
+    });
+    cout << "  text + parse + build:    " << textMs << " ms" << endl;
+    cout << "  loadTree (mmap):         " << loadMs << " ms" << endl;
+    cout << "  streamTree (chunks):     " << streamMs << " ms" << endl;
+    cout << "  mapped flat view + scan: " << mappedMs << " ms" << endl;
+
+    remove("bench_preorder.bin");
+    remove("bench_preorder.txt");
+    remove("bench_flat.bin");
+
+    // Parallel build and reduction over a 2^22-node complete tree in preorder
+    vector<int> preorder;
+    {
+        PooledBinaryTree big;
+        vector<int> bigLevelOrder((1 << 22) - 1);
+        for (size_t i = 0; i < bigLevelOrder.size(); ++i) bigLevelOrder[i] = (int)i;
+        big.constructTreeFromLevelOrder(bigLevelOrder);
+        vector<const TreeNode*> stack = {big.root};
+        while (!stack.empty()) {
+            const TreeNode* node = stack.back();
+            stack.pop_back();
+            preorder.push_back(node ? node->data : -1);
+            if (node) {
+                stack.push_back(node->right);
+                stack.push_back(node->left);
+            }
+        }
+    }
+    cout << "Parallel preorder build and sum, " << preorder.size() << " values (" << rounds << " rounds):" << endl;
+    PooledBinaryTree sequentialTree;
+    double sequentialBuildMs = averageMs(rounds, [&] { sequentialTree.constructTreeFromPreorder(preorder); });
+    double sequentialSumMs = averageMs(rounds, [&] {
+        long long sum = 0;
+        sequentialTree.forEachPreorder([&](int value) { sum += value; });
+        sink = sum;
+    });
+    cout << "  sequential:  build " << sequentialBuildMs << " ms, sum " << sequentialSumMs << " ms" << endl;
+    unsigned hardwareThreads = thread::hardware_concurrency() ? thread::hardware_concurrency() : 1;
+    for (unsigned workers = 1; workers <= hardwareThreads; workers *= 2) {
+        TaskPool pool(workers);
+        PooledBinaryTree parallelTree;
+        double buildMs = averageMs(rounds, [&] { constructTreeFromPreorderParallel(parallelTree, preorder, pool); });
+        double sumMs = averageMs(rounds, [&] { sink = parallelSum(parallelTree, pool); });
+        cout << "  " << workers << " worker(s): build " << buildMs << " ms, sum " << sumMs << " ms" << endl;
+    }
+    return 0;
+}
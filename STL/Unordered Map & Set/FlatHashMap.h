@@ -0,0 +1,679 @@
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include <cstddef> // For size_t
+#include <cstdint> // For int8_t, uint32_t, uint64_t
+#include <cstring> // For std::memset, std::memcpy
+#include <functional> // For std::hash, std::equal_to
+#include <new> // For placement new and std::align_val_t
+#include <stdexcept> // For std::out_of_range
+#include <string>
+#include <string_view>
+#include <tuple> // For std::forward_as_tuple
+#include <type_traits>
+#include <utility> // For std::pair, std::move, std::forward
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h> // SSE2 intrinsics
+#define FLAT_HASH_HAS_SSE2 1
+#else
+#define FLAT_HASH_HAS_SSE2 0
+#endif
+
+/*
+Notes about FlatHashMap / FlatHashSet:
+
+1. **Open Addressing**:
+   - std::unordered_map keeps every element in its own heap node and each bucket is a linked
+     list, so a lookup is a chain of pointer dereferences, each one a likely cache miss.
+   - Here all elements sit in one flat array of slots. A key that collides just goes into
+     another free slot further along its probe sequence; there are no nodes and no links.
+
+2. **Control Bytes**:
+   - Next to the slots is one control byte per slot: empty, deleted, or "full" holding 7 bits
+     of the key's hash (H2). The other bits of the hash (H1) pick where probing starts.
+   - Slots are probed in groups of 16. One SSE2 compare checks all 16 control bytes of a group
+     against H2 at once, so the key comparisons (and the slot memory) are only touched for
+     the ~1/128 of slots whose H2 matches by chance, plus the real match.
+   - A lookup stops at the first group with an empty slot. Without SSE2 the same is done
+     byte by byte.
+
+3. **Erase**:
+   - An erased slot becomes empty if its group still has an empty slot (no probe ever went
+     past that group), and a "deleted" tombstone otherwise, so later lookups keep probing.
+   - Tombstones are reused by inserts and dropped on the next rehash.
+
+4. **Load Factor and Growth**:
+   - The table rehashes into twice the slots when 7/8 of them are used (tombstones count as
+     used). If most of the used slots are tombstones it rehashes at the same size instead.
+   - bucket_count() is the number of slots, load_factor() = size() / bucket_count().
+   - rehash(n) makes room for at least n slots, reserve(n) for n elements without rehashing.
+
+5. **Heterogeneous Lookup**:
+   - With FlatHash<std::string> (the default for string keys) find/count/contains/erase
+     also take a std::string_view or const char*, and no temporary std::string is built.
+
+6. **Differences from std::unordered_map**:
+   - Inserting or rehashing moves elements, so pointers, references and iterators are
+     invalidated by any insert that grows the table. Erase invalidates only the erased element.
+   - The map stores std::pair<Key, Value>: the key must not be changed through an iterator.
+   - There is no bucket interface and no reverse iteration.
+*/
+
+// Default hash: std::hash, plus string_view lookup for std::string keys
+template <typename T>
+struct FlatHash : std::hash<T> {};
+
+template <>
+struct FlatHash<std::string> {
+    using is_transparent = void; // Enables find(string_view) and friends
+
+    size_t operator()(std::string_view text) const {
+        return std::hash<std::string_view>{}(text);
+    }
+};
+
+namespace flat_hash_detail {
+
+using ControlByte = int8_t;
+constexpr ControlByte ctrlEmpty = -128; // 0b10000000
+constexpr ControlByte ctrlDeleted = -2; // 0b11111110; full slots are 0..127 (high bit clear)
+constexpr size_t groupWidth = 16;
+
+// std::hash of an integer is the integer itself, so spread every bit of it over the whole
+// word before splitting it into H1 and H2
+inline size_t mixHash(size_t hash) {
+    uint64_t mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(mixed ^ (mixed >> 32));
+}
+
+inline unsigned lowestBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+    unsigned index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// The 16 control bytes of one group; each query returns a bitmask with bit i for byte i
+class Group {
+private:
+#if FLAT_HASH_HAS_SSE2
+    __m128i bytes;
+
+public:
+    explicit Group(const ControlByte* position) : bytes(_mm_load_si128(reinterpret_cast<const __m128i*>(position))) {}
+
+    uint32_t match(ControlByte h2) const {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(h2))));
+    }
+
+    uint32_t matchFree() const {
+        return static_cast<uint32_t>(_mm_movemask_epi8(bytes)); // Empty and deleted have the high bit set
+    }
+#else
+    const ControlByte* bytes;
+
+public:
+    explicit Group(const ControlByte* position) : bytes(position) {}
+
+    uint32_t match(ControlByte h2) const {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < groupWidth; ++i) {
+            if (bytes[i] == h2) mask |= 1u << i;
+        }
+        return mask;
+    }
+
+    uint32_t matchFree() const {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < groupWidth; ++i) {
+            if (bytes[i] < 0) mask |= 1u << i;
+        }
+        return mask;
+    }
+#endif
+
+    uint32_t matchEmpty() const {
+        return match(ctrlEmpty);
+    }
+};
+
+struct SetKeyOf {
+    template <typename Key>
+    static const Key& key(const Key& slot) { return slot; }
+};
+
+struct MapKeyOf {
+    template <typename Pair>
+    static const typename Pair::first_type& key(const Pair& slot) { return slot.first; }
+};
+
+} // namespace flat_hash_detail
+
+// Shared table of FlatHashMap and FlatHashSet. Slot is what is stored, KeyOf extracts its key.
+template <typename Key, typename Slot, typename KeyOf, typename Hash, typename KeyEqual>
+class FlatHashTable {
+protected:
+    using ControlByte = flat_hash_detail::ControlByte;
+    using Group = flat_hash_detail::Group;
+    static constexpr size_t groupWidth = flat_hash_detail::groupWidth;
+    static constexpr size_t slotAlignment = alignof(Slot) > groupWidth ? alignof(Slot) : groupWidth;
+
+    ControlByte* ctrl; // capacity control bytes, 16-byte aligned; nullptr while capacity is 0
+    Slot* slots; // Lives in the same allocation, right after the control bytes
+    size_t capacity; // 0 or a power of two >= groupWidth
+    size_t elementCount;
+    size_t growthLeft; // Empty slots that may still be filled before the next rehash
+    Hash hasher;
+    KeyEqual equal;
+
+    static size_t maxLoad(size_t slotCount) {
+        return slotCount - slotCount / 8; // 7/8
+    }
+
+    static size_t slotsOffset(size_t slotCount) {
+        return (slotCount + slotAlignment - 1) / slotAlignment * slotAlignment;
+    }
+
+    static bool isFull(ControlByte byte) {
+        return byte >= 0;
+    }
+
+    void allocate(size_t slotCount) {
+        void* block = ::operator new(slotsOffset(slotCount) + slotCount * sizeof(Slot), std::align_val_t(slotAlignment));
+        ctrl = static_cast<ControlByte*>(block);
+        slots = reinterpret_cast<Slot*>(static_cast<unsigned char*>(block) + slotsOffset(slotCount));
+        std::memset(ctrl, static_cast<unsigned char>(flat_hash_detail::ctrlEmpty), slotCount);
+        capacity = slotCount;
+        growthLeft = maxLoad(slotCount);
+    }
+
+    void destroySlots() {
+        if constexpr (!std::is_trivially_destructible<Slot>::value) {
+            for (size_t i = 0; i < capacity; ++i) {
+                if (isFull(ctrl[i])) slots[i].~Slot();
+            }
+        }
+    }
+
+    void deallocate() {
+        if (ctrl) {
+            ::operator delete(ctrl, std::align_val_t(slotAlignment));
+        }
+        ctrl = nullptr;
+        slots = nullptr;
+        capacity = 0;
+        growthLeft = 0;
+    }
+
+    // Walks the groups of a hash: start group from H1, then 1, 2, 3, ... groups further
+    // (triangular steps visit every group of a power-of-two table exactly once)
+    struct ProbeSequence {
+        size_t group;
+        size_t mask;
+        size_t step;
+
+        ProbeSequence(size_t hash, size_t groupCount) : group((hash >> 7) & (groupCount - 1)), mask(groupCount - 1), step(0) {}
+
+        size_t offset() const { return group * groupWidth; }
+
+        void next() {
+            ++step;
+            group = (group + step) & mask;
+        }
+    };
+
+    template <typename K>
+    size_t hashOf(const K& key) const {
+        return flat_hash_detail::mixHash(hasher(key));
+    }
+
+    // Slot index of key, or capacity if it isn't there
+    template <typename K>
+    size_t findIndex(const K& key) const {
+        if (capacity == 0) return 0;
+        size_t hash = hashOf(key);
+        ControlByte h2 = static_cast<ControlByte>(hash & 0x7F);
+        for (ProbeSequence probe(hash, capacity / groupWidth);; probe.next()) {
+            Group group(ctrl + probe.offset());
+            for (uint32_t match = group.match(h2); match != 0; match &= match - 1) {
+                size_t index = probe.offset() + flat_hash_detail::lowestBit(match);
+                if (equal(KeyOf::key(slots[index]), key)) return index;
+            }
+            if (group.matchEmpty() != 0) return capacity; // The key would have been put here
+        }
+    }
+
+    // First empty or deleted slot on the probe sequence of hash
+    size_t findFreeSlot(size_t hash) const {
+        for (ProbeSequence probe(hash, capacity / groupWidth);; probe.next()) {
+            uint32_t free = Group(ctrl + probe.offset()).matchFree();
+            if (free != 0) return probe.offset() + flat_hash_detail::lowestBit(free);
+        }
+    }
+
+    // Move every element into a fresh table of newCapacity slots
+    void resize(size_t newCapacity) {
+        ControlByte* oldCtrl = ctrl;
+        Slot* oldSlots = slots;
+        size_t oldCapacity = capacity;
+        allocate(newCapacity);
+        for (size_t i = 0; i < oldCapacity; ++i) {
+            if (!isFull(oldCtrl[i])) continue;
+            size_t hash = hashOf(KeyOf::key(oldSlots[i]));
+            size_t index = findFreeSlot(hash);
+            new (&slots[index]) Slot(std::move(oldSlots[i]));
+            oldSlots[i].~Slot();
+            ctrl[index] = static_cast<ControlByte>(hash & 0x7F);
+        }
+        growthLeft -= elementCount;
+        if (oldCtrl) {
+            ::operator delete(oldCtrl, std::align_val_t(slotAlignment));
+        }
+    }
+
+    // Called when an insert finds growthLeft == 0
+    void growForInsert() {
+        if (capacity == 0) {
+            resize(groupWidth);
+        } else if (elementCount * 2 <= maxLoad(capacity)) {
+            resize(capacity); // Mostly tombstones: same size, just drop them
+        } else {
+            resize(capacity * 2);
+        }
+    }
+
+    // Find key, or construct a Slot from slotArgs for it. Returns the slot index and whether it was inserted.
+    template <typename K, typename... SlotArgs>
+    std::pair<size_t, bool> findOrEmplace(const K& key, SlotArgs&&... slotArgs) {
+        size_t found = findIndex(key);
+        if (capacity != 0 && found != capacity) {
+            return {found, false};
+        }
+        size_t hash = hashOf(key);
+        size_t index = capacity == 0 ? 0 : findFreeSlot(hash);
+        if (capacity == 0 || (ctrl[index] == flat_hash_detail::ctrlEmpty && growthLeft == 0)) {
+            // slotArgs may refer to an element of this table (insert(*it), try_emplace(key, it->second)),
+            // so build the slot before the old storage goes away
+            Slot slot(std::forward<SlotArgs>(slotArgs)...);
+            growForInsert(); // A tombstone can be reused without growing
+            index = findFreeSlot(hash);
+            new (&slots[index]) Slot(std::move(slot));
+        } else {
+            new (&slots[index]) Slot(std::forward<SlotArgs>(slotArgs)...);
+        }
+        if (ctrl[index] == flat_hash_detail::ctrlEmpty) {
+            growthLeft--;
+        }
+        ctrl[index] = static_cast<ControlByte>(hash & 0x7F);
+        elementCount++;
+        return {index, true};
+    }
+
+    void eraseAt(size_t index) {
+        slots[index].~Slot();
+        size_t groupStart = index & ~(groupWidth - 1);
+        if (Group(ctrl + groupStart).matchEmpty() != 0) {
+            ctrl[index] = flat_hash_detail::ctrlEmpty; // No probe ever continued past this group
+            growthLeft++;
+        } else {
+            ctrl[index] = flat_hash_detail::ctrlDeleted;
+        }
+        elementCount--;
+    }
+
+    void copyFrom(const FlatHashTable& other) {
+        if (other.capacity == 0) return;
+        allocate(other.capacity);
+        try {
+            for (size_t i = 0; i < capacity; ++i) {
+                if (isFull(other.ctrl[i])) {
+                    new (&slots[i]) Slot(other.slots[i]); // Same hash, same slot
+                    ctrl[i] = other.ctrl[i];
+                    elementCount++;
+                }
+            }
+        } catch (...) {
+            destroySlots();
+            deallocate();
+            elementCount = 0;
+            throw;
+        }
+        std::memcpy(ctrl, other.ctrl, capacity); // Tombstones too, so every probe sequence stays intact
+        growthLeft = other.growthLeft;
+    }
+
+    void takeFrom(FlatHashTable& other) noexcept {
+        ctrl = other.ctrl;
+        slots = other.slots;
+        capacity = other.capacity;
+        elementCount = other.elementCount;
+        growthLeft = other.growthLeft;
+        other.ctrl = nullptr;
+        other.slots = nullptr;
+        other.capacity = other.elementCount = other.growthLeft = 0;
+    }
+
+public:
+    using key_type = Key;
+    using value_type = Slot;
+    using size_type = size_t;
+
+    template <bool Const>
+    class Iterator {
+    private:
+        friend class FlatHashTable;
+        using Element = std::conditional_t<Const, const Slot, Slot>;
+
+        const ControlByte* ctrl;
+        Element* slots;
+        size_t index;
+        size_t capacity;
+
+        void skipFree() {
+            while (index < capacity && !isFull(ctrl[index])) ++index;
+        }
+
+    public:
+        Iterator() : ctrl(nullptr), slots(nullptr), index(0), capacity(0) {}
+        Iterator(const ControlByte* ctrl, Element* slots, size_t index, size_t capacity)
+            : ctrl(ctrl), slots(slots), index(index), capacity(capacity) {}
+
+        // iterator -> const_iterator
+        template <bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        Iterator(const Iterator<OtherConst>& other) : ctrl(other.ctrl), slots(other.slots), index(other.index), capacity(other.capacity) {}
+
+        Element& operator*() const { return slots[index]; }
+        Element* operator->() const { return &slots[index]; }
+
+        Iterator& operator++() {
+            ++index;
+            skipFree();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const { return index == other.index && ctrl == other.ctrl; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+        template <bool>
+        friend class Iterator;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+protected:
+    iterator iteratorAt(size_t index) { return iterator(ctrl, slots, index, capacity); }
+    const_iterator iteratorAt(size_t index) const { return const_iterator(ctrl, slots, index, capacity); }
+
+public:
+    FlatHashTable() : ctrl(nullptr), slots(nullptr), capacity(0), elementCount(0), growthLeft(0) {}
+
+    FlatHashTable(const FlatHashTable& other)
+        : ctrl(nullptr), slots(nullptr), capacity(0), elementCount(0), growthLeft(0), hasher(other.hasher), equal(other.equal) {
+        copyFrom(other);
+    }
+
+    FlatHashTable(FlatHashTable&& other) noexcept : hasher(other.hasher), equal(other.equal) {
+        takeFrom(other);
+    }
+
+    FlatHashTable& operator=(const FlatHashTable& other) {
+        if (this != &other) {
+            FlatHashTable copy(other); // Copy first, so a throwing copy leaves *this untouched
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    FlatHashTable& operator=(FlatHashTable&& other) noexcept {
+        if (this != &other) {
+            destroySlots();
+            deallocate();
+            hasher = other.hasher;
+            equal = other.equal;
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    ~FlatHashTable() {
+        destroySlots();
+        deallocate();
+    }
+
+    iterator begin() {
+        iterator it = iteratorAt(0);
+        if (capacity != 0) it.skipFree();
+        return it;
+    }
+    iterator end() { return iteratorAt(capacity); }
+    const_iterator begin() const {
+        const_iterator it = iteratorAt(0);
+        if (capacity != 0) it.skipFree();
+        return it;
+    }
+    const_iterator end() const { return iteratorAt(capacity); }
+
+    size_t size() const { return elementCount; }
+    bool empty() const { return elementCount == 0; }
+
+    size_t bucket_count() const { return capacity; }
+    float load_factor() const { return capacity == 0 ? 0.0f : static_cast<float>(elementCount) / capacity; }
+    float max_load_factor() const { return 0.875f; }
+
+    // At least slotCount slots (and room for the current elements); rehash(0) shrinks to fit
+    void rehash(size_t slotCount) {
+        size_t needed = elementCount + (elementCount + 6) / 7; // Smallest table keeping count within 7/8
+        if (slotCount < needed) slotCount = needed;
+        if (slotCount == 0) {
+            destroySlots();
+            deallocate();
+            return;
+        }
+        size_t newCapacity = groupWidth;
+        while (newCapacity < slotCount) newCapacity *= 2;
+        if (newCapacity != capacity) resize(newCapacity);
+    }
+
+    // Room for elementCount elements without another rehash
+    void reserve(size_t wanted) {
+        if (wanted > elementCount && wanted - elementCount > growthLeft) {
+            rehash(wanted + (wanted + 6) / 7);
+        }
+    }
+
+    // Keeps the slots for reuse
+    void clear() {
+        destroySlots();
+        if (capacity != 0) {
+            std::memset(ctrl, static_cast<unsigned char>(flat_hash_detail::ctrlEmpty), capacity);
+        }
+        elementCount = 0;
+        growthLeft = maxLoad(capacity);
+    }
+
+    iterator find(const Key& key) {
+        return iteratorAt(findIndex(key));
+    }
+    const_iterator find(const Key& key) const {
+        return iteratorAt(findIndex(key));
+    }
+
+    // Heterogeneous lookup, e.g. find(std::string_view) on string keys
+    template <typename K, typename H = Hash, typename = typename H::is_transparent>
+    iterator find(const K& key) {
+        return iteratorAt(findIndex(key));
+    }
+    template <typename K, typename H = Hash, typename = typename H::is_transparent>
+    const_iterator find(const K& key) const {
+        return iteratorAt(findIndex(key));
+    }
+
+    bool contains(const Key& key) const {
+        return findIndex(key) != capacity;
+    }
+    template <typename K, typename H = Hash, typename = typename H::is_transparent>
+    bool contains(const K& key) const {
+        return findIndex(key) != capacity;
+    }
+
+    size_t count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+    template <typename K, typename H = Hash, typename = typename H::is_transparent>
+    size_t count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    size_t erase(const Key& key) {
+        size_t index = findIndex(key);
+        if (index == capacity) return 0;
+        eraseAt(index);
+        return 1;
+    }
+    template <typename K, typename H = Hash, typename = typename H::is_transparent>
+    size_t erase(const K& key) {
+        size_t index = findIndex(key);
+        if (index == capacity) return 0;
+        eraseAt(index);
+        return 1;
+    }
+
+    // Erase the element at it; returns the iterator to the next element
+    iterator erase(const_iterator it) {
+        eraseAt(it.index);
+        iterator next = iteratorAt(it.index);
+        ++next;
+        return next;
+    }
+    iterator erase(iterator it) {
+        return erase(const_iterator(it));
+    }
+};
+
+// Hash set of unique keys, stored inline in one flat array
+template <typename Key, typename Hash = FlatHash<Key>, typename KeyEqual = std::equal_to<>>
+class FlatHashSet : public FlatHashTable<Key, Key, flat_hash_detail::SetKeyOf, Hash, KeyEqual> {
+private:
+    using Table = FlatHashTable<Key, Key, flat_hash_detail::SetKeyOf, Hash, KeyEqual>;
+
+public:
+    using typename Table::const_iterator;
+    using iterator = const_iterator; // Keys can't be changed in place
+
+    FlatHashSet() = default;
+
+    FlatHashSet(std::initializer_list<Key> keys) {
+        this->reserve(keys.size());
+        for (const Key& key : keys) insert(key);
+    }
+
+    const_iterator begin() const { return Table::begin(); }
+    const_iterator end() const { return Table::end(); }
+
+    template <typename K>
+    const_iterator find(const K& key) const { return Table::find(key); }
+
+    std::pair<iterator, bool> insert(const Key& key) {
+        auto [index, inserted] = this->findOrEmplace(key, key);
+        return {std::as_const(*this).iteratorAt(index), inserted};
+    }
+
+    std::pair<iterator, bool> insert(Key&& key) {
+        auto [index, inserted] = this->findOrEmplace(key, std::move(key));
+        return {std::as_const(*this).iteratorAt(index), inserted};
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        Key key(std::forward<Args>(args)...);
+        return insert(std::move(key));
+    }
+};
+
+// Hash map of unique keys to values, stored inline as std::pair<Key, Value>
+template <typename Key, typename Value, typename Hash = FlatHash<Key>, typename KeyEqual = std::equal_to<>>
+class FlatHashMap : public FlatHashTable<Key, std::pair<Key, Value>, flat_hash_detail::MapKeyOf, Hash, KeyEqual> {
+private:
+    using Table = FlatHashTable<Key, std::pair<Key, Value>, flat_hash_detail::MapKeyOf, Hash, KeyEqual>;
+
+public:
+    using mapped_type = Value;
+    using typename Table::const_iterator;
+    using typename Table::iterator;
+    using typename Table::value_type;
+
+    FlatHashMap() = default;
+
+    FlatHashMap(std::initializer_list<value_type> values) {
+        this->reserve(values.size());
+        for (const value_type& value : values) insert(value);
+    }
+
+    // Like std::unordered_map, an existing key keeps its value
+    std::pair<iterator, bool> insert(const value_type& value) {
+        auto [index, inserted] = this->findOrEmplace(value.first, value);
+        return {this->iteratorAt(index), inserted};
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        auto [index, inserted] = this->findOrEmplace(value.first, std::move(value));
+        return {this->iteratorAt(index), inserted};
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(std::forward<Args>(args)...);
+        return insert(std::move(value));
+    }
+
+    // Only constructs the value if key is new
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        auto [index, inserted] = this->findOrEmplace(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                                     std::forward_as_tuple(std::forward<Args>(args)...));
+        return {this->iteratorAt(index), inserted};
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        auto [index, inserted] = this->findOrEmplace(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                                     std::forward_as_tuple(std::forward<Args>(args)...));
+        return {this->iteratorAt(index), inserted};
+    }
+
+    Value& operator[](const Key& key) {
+        return try_emplace(key).first->second;
+    }
+
+    Value& operator[](Key&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    Value& at(const Key& key) {
+        iterator it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("FlatHashMap::at: key not found");
+        return it->second;
+    }
+
+    const Value& at(const Key& key) const {
+        const_iterator it = this->find(key);
+        if (it == this->end()) throw std::out_of_range("FlatHashMap::at: key not found");
+        return it->second;
+    }
+};
+
+#endif // FLAT_HASH_MAP_H
@@ -0,0 +1,132 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "FlatHashMap.h"
+
+using namespace std;
+
+/*
+Benchmark: FlatHashMap / FlatHashSet vs std::unordered_map / std::unordered_set
+
+- Random 64-bit keys: insert all, find all (hits), find as many absent keys (misses), erase all.
+  Every number is nanoseconds per operation, averaged over enough rounds to total ~1M operations.
+- String keys (16+ characters, too long for the small-string buffer): the flat map is searched
+  with std::string_view, std::unordered_map has to be given a std::string.
+- 1K keys fit in L1/L2, 1M keys don't fit in cache, 100M keys don't fit in the TLB either.
+  100M needs about 2.5 GB for the flat map and several times that for std::unordered_map, so
+  it only runs when asked for: ./benchmark huge
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static volatile uint64_t sink; // Keeps the optimizer from deleting the lookups
+
+template <typename Func>
+double nsPerOp(size_t operations, Func&& func) {
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() / operations;
+}
+
+vector<uint64_t> randomKeys(size_t count, uint64_t seed) {
+    mt19937_64 random(seed);
+    vector<uint64_t> keys(count);
+    for (uint64_t& key : keys) key = random();
+    return keys;
+}
+
+// Map is FlatHashMap<uint64_t, uint64_t> or unordered_map<uint64_t, uint64_t>
+template <typename Map>
+void runIntegers(const char* name, const vector<uint64_t>& keys, const vector<uint64_t>& missing, int rounds) {
+    double insertNs = 0, hitNs = 0, missNs = 0, eraseNs = 0;
+    for (int r = 0; r < rounds; ++r) {
+        Map map;
+        insertNs += nsPerOp(keys.size(), [&] {
+            for (uint64_t key : keys) map.insert({key, key});
+        });
+        hitNs += nsPerOp(keys.size(), [&] {
+            uint64_t sum = 0;
+            for (uint64_t key : keys) sum += map.find(key)->second;
+            sink = sum;
+        });
+        missNs += nsPerOp(missing.size(), [&] {
+            uint64_t found = 0;
+            for (uint64_t key : missing) found += map.count(key);
+            sink = found;
+        });
+        eraseNs += nsPerOp(keys.size(), [&] {
+            for (uint64_t key : keys) map.erase(key);
+        });
+    }
+    cout << "  " << name << ": insert " << insertNs / rounds << ", find hit " << hitNs / rounds
+         << ", find miss " << missNs / rounds << ", erase " << eraseNs / rounds << " ns/op" << endl;
+}
+
+template <typename Set>
+void runIntegerSet(const char* name, const vector<uint64_t>& keys, int rounds) {
+    double insertNs = 0, findNs = 0;
+    for (int r = 0; r < rounds; ++r) {
+        Set set;
+        insertNs += nsPerOp(keys.size(), [&] {
+            for (uint64_t key : keys) set.insert(key);
+        });
+        findNs += nsPerOp(keys.size(), [&] {
+            uint64_t found = 0;
+            for (uint64_t key : keys) found += set.count(key);
+            sink = found;
+        });
+    }
+    cout << "  " << name << ": insert " << insertNs / rounds << ", find " << findNs / rounds << " ns/op" << endl;
+}
+
+template <typename Map, typename Lookup>
+void runStrings(const char* name, const vector<string>& keys, const vector<Lookup>& lookups, int rounds) {
+    double insertNs = 0, findNs = 0;
+    for (int r = 0; r < rounds; ++r) {
+        Map map;
+        insertNs += nsPerOp(keys.size(), [&] {
+            for (const string& key : keys) map.insert({key, 1});
+        });
+        findNs += nsPerOp(lookups.size(), [&] {
+            uint64_t sum = 0;
+            for (const Lookup& key : lookups) sum += map.find(key)->second;
+            sink = sum;
+        });
+    }
+    cout << "  " << name << ": insert " << insertNs / rounds << ", find " << findNs / rounds << " ns/op" << endl;
+}
+
+int main(int argc, char** argv) {
+    vector<size_t> sizes = {1000, 1000000};
+    if (argc > 1 && string(argv[1]) == "huge") {
+        sizes.push_back(100000000);
+    }
+
+    for (size_t size : sizes) {
+        int rounds = size >= 1000000 ? 1 : static_cast<int>(1000000 / size);
+        vector<uint64_t> keys = randomKeys(size, 1);
+        vector<uint64_t> missing = randomKeys(size, 2); // Collisions with keys are astronomically unlikely
+        cout << size << " random 64-bit keys (" << rounds << " round(s)):" << endl;
+        runIntegers<FlatHashMap<uint64_t, uint64_t>>("FlatHashMap       ", keys, missing, rounds);
+        runIntegers<unordered_map<uint64_t, uint64_t>>("std::unordered_map", keys, missing, rounds);
+        runIntegerSet<FlatHashSet<uint64_t>>("FlatHashSet       ", keys, rounds);
+        runIntegerSet<unordered_set<uint64_t>>("std::unordered_set", keys, rounds);
+
+        if (size > 1000000) continue; // Strings at 100M would need tens of GB
+        vector<string> names(size);
+        for (size_t i = 0; i < size; ++i) names[i] = "customer-" + to_string(keys[i]);
+        vector<string_view> views(names.begin(), names.end());
+        cout << size << " string keys:" << endl;
+        runStrings<FlatHashMap<string, int>>("FlatHashMap (string_view lookup)", names, views, rounds);
+        runStrings<unordered_map<string, int>>("std::unordered_map (string)     ", names, names, rounds);
+    }
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <unordered_set>
 #include <unordered_map>
+#include "FlatHashMap.h"
 
 using namespace std;
 
@@ -48,10 +49,17 @@ using namespace std;
  *      - end(): Returns an iterator to one past the last key-value pair.
  *      - rbegin(): Returns a reverse iterator to the last key-value pair.
  *      - rend(): Returns a reverse iterator to before the first key-value pair.
+ *
+ * 3. **FlatHashSet / FlatHashMap** (FlatHashMap.h):
+ *    - Same operations (insert, emplace, erase, find, count, reserve, rehash, load_factor, ...),
+ *      but every element lives in one flat array instead of a heap node per element, so a
+ *      lookup is a few cache misses at most instead of a chain of pointer dereferences.
+ *    - String-keyed maps can be searched with a std::string_view without building a std::string.
+ *    - Inserting can move elements, so iterators and references don't survive a rehash.
  */
 
 void unorderedSetUsage() {
-    unordered_set<int> us; // Initialize an empty unordered set
+    FlatHashSet<int> us; // Initialize an empty set (unordered_set<int> works the same)
     us.insert(10); // Add elements
     us.insert(20);
     us.insert(10); // Duplicate (will be ignored)
@@ -80,10 +88,10 @@ void unorderedSetUsage() {
 }
 
 void unorderedMapUsage() {
-    unordered_map<string, int> um; // Initialize an empty unordered map
+    FlatHashMap<string, int> um; // Initialize an empty map (unordered_map<string, int> works the same)
     um.insert({"Alice", 25}); // Add key-value pairs
     um.insert({"Bob", 30});
-    um.insert({"Alice", 35}); // Duplicate key (will be replaced)
+    um.insert({"Alice", 35}); // Duplicate key (ignored, Alice keeps 25)
     um.insert({"Charlie", 40});
 
     // Output elements
@@ -92,6 +100,9 @@ void unorderedMapUsage() {
 
     // Check presence of a key
     cout << "Count of Alice: " << um.count("Alice") << endl; // Output: 1
+    string_view name = "Charlie";
+    cout << "Charlie is " << um.find(name)->second << endl; // Looked up without a temporary string
+    cout << "Load factor: " << um.load_factor() << " (" << um.size() << " of " << um.bucket_count() << " slots)" << endl;
 
     // Remove a specific key
     um.erase("Bob");
@@ -0,0 +1,301 @@
+#ifndef SIMPLE_VECTOR_H
+#define SIMPLE_VECTOR_H
+
+#include <cstddef> // For size_t
+#include <cstdlib> // For std::malloc, std::realloc and std::free
+#include <new> // For placement new and std::bad_alloc
+#include <type_traits> // For std::is_trivially_copyable
+#include <utility> // For std::move, std::move_if_noexcept and std::forward
+
+/*
+Notes about how SimpleVector grows:
+
+1. **Raw Memory vs Constructed Objects**:
+   - malloc only hands back raw bytes; no T lives there yet. Elements must be created with
+     placement new (`new (ptr) T(...)`) and destroyed with an explicit `ptr->~T()` call.
+   - Assigning into raw memory (`new_data[i] = data[i]`) is undefined behaviour for any T that
+     owns resources (std::string, std::vector, ...).
+
+2. **Relocating Elements**:
+   - Trivially copyable types (int, double, plain structs) are just bytes, so realloc can move
+     the whole block (often in place, without copying at all).
+   - Other types are move-constructed into the new block when their move constructor is
+     noexcept, and copy-constructed otherwise (std::move_if_noexcept), so a throwing move
+     can never leave the vector half-moved.
+
+3. **Growth Policy**:
+   - DoubleGrowth (2x) gives the fewest reallocations.
+   - HalfGrowth (1.5x) wastes less memory and lets freed blocks be reused by later growth.
+
+4. **Pre-sizing**:
+   - reserve(n) allocates once up front, so a loop of n push_back/emplace_back never reallocates.
+   - shrink_to_fit() gives back the unused capacity once the vector stops growing.
+
+5. **Small-Buffer Optimization (SmallVector<T, N>)**:
+   - The first N elements live in a buffer inside the vector object itself, so short vectors
+     never touch the heap. Only growing past N moves the elements to a malloc'd block.
+   - SmallVector<T, N, GrowthPolicy> is SimpleVector<T, GrowthPolicy, N>: the inline capacity
+     comes last, so SimpleVector<T, GrowthPolicy> still means what it always did.
+   - SimpleVector<T> (N = 0) is the plain heap-only vector and still allocates on construction.
+   - Moving a vector whose elements are inline has to move them one by one; only a heap
+     block can be stolen by swapping pointers.
+*/
+
+// Growth policies: given the current capacity, return the next one.
+struct DoubleGrowth {
+    static size_t grow(size_t capacity) {
+        return capacity == 0 ? 1 : capacity * 2; // 1, 2, 4, 8, ...
+    }
+};
+
+struct HalfGrowth {
+    static size_t grow(size_t capacity) {
+        return capacity < 2 ? capacity + 1 : capacity + capacity / 2; // 1, 2, 3, 4, 6, 9, ...
+    }
+};
+
+// Raw, uninitialized room for N elements inside the vector object
+template <typename T, size_t N>
+struct SimpleVectorInlineStorage {
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+
+    T* inlineData() const {
+        return reinterpret_cast<T*>(const_cast<unsigned char*>(bytes));
+    }
+};
+
+// No inline room: the "inline" buffer is the null pointer, and the empty base takes no space
+template <typename T>
+struct SimpleVectorInlineStorage<T, 0> {
+    T* inlineData() const {
+        return nullptr;
+    }
+};
+
+template <typename T, typename GrowthPolicy = DoubleGrowth, size_t N = 0>
+class SimpleVector : private SimpleVectorInlineStorage<T, N> {
+private:
+    T* data;        // Pointer to the array of elements
+    size_t size;    // Current number of elements
+    size_t capacity; // Allocated capacity
+
+    using SimpleVectorInlineStorage<T, N>::inlineData;
+
+    // Types that can be moved around with a plain byte copy
+    static constexpr bool triviallyRelocatable = std::is_trivially_copyable<T>::value;
+
+    // Destroy the elements in [first, last)
+    static void destroyRange(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) {
+                first->~T();
+            }
+        }
+    }
+
+    bool isInline() const {
+        return data == inlineData(); // For N = 0 this means "nothing allocated"
+    }
+
+    // Move the elements into new_data (rolling back on a throwing copy), then destroy the originals
+    void relocateInto(T* new_data) {
+        size_t constructed = 0;
+        try {
+            for (; constructed < size; ++constructed) {
+                new (new_data + constructed) T(std::move_if_noexcept(data[constructed]));
+            }
+        } catch (...) {
+            destroyRange(new_data, new_data + constructed); // Old storage is untouched
+            throw;
+        }
+        destroyRange(data, data + size);
+    }
+
+    void resize(size_t new_capacity) {
+        if (new_capacity < size) {
+            new_capacity = size; // Never drop live elements
+        }
+
+        if (new_capacity <= N) {
+            // Fits in the inline buffer (for N = 0: the vector is empty, drop the block)
+            if (!isInline()) {
+                relocateInto(inlineData());
+                std::free(data);
+                data = inlineData();
+                capacity = N;
+            }
+            return;
+        }
+
+        if constexpr (triviallyRelocatable) {
+            if (!isInline()) {
+                T* new_data = (T*)std::realloc(data, new_capacity * sizeof(T)); // Grow (or shrink) the block, in place if possible
+                if (!new_data) {
+                    throw std::bad_alloc();
+                }
+                data = new_data;
+                capacity = new_capacity;
+                return;
+            }
+        }
+
+        T* new_data = (T*)std::malloc(new_capacity * sizeof(T)); // Allocate new memory
+        if (!new_data) {
+            throw std::bad_alloc();
+        }
+        try {
+            relocateInto(new_data);
+        } catch (...) {
+            std::free(new_data);
+            throw;
+        }
+        if (!isInline()) {
+            std::free(data); // Free old memory
+        }
+        data = new_data; // Update the data pointer
+        capacity = new_capacity; // Update capacity
+    }
+
+    // Take over other's elements, leaving it empty; our own elements must already be gone
+    void takeFrom(SimpleVector& other) {
+        if (!other.isInline()) {
+            if (!isInline()) {
+                std::free(data);
+            }
+            data = other.data; // Steal the heap block
+            size = other.size;
+            capacity = other.capacity;
+            other.data = other.inlineData(); // Leave the other vector empty but valid
+            other.size = 0;
+            other.capacity = N;
+        } else {
+            reserve(other.size); // Inline elements have to be moved one by one
+            for (size_t i = 0; i < other.size; ++i) {
+                new (data + i) T(std::move(other.data[i]));
+            }
+            size = other.size;
+            other.clear();
+        }
+    }
+
+public:
+    SimpleVector() : data(inlineData()), size(0), capacity(N) {
+        if (N == 0) {
+            resize(1); // Initial allocation
+        }
+    }
+
+    SimpleVector(const SimpleVector& other) : data(inlineData()), size(0), capacity(N) {
+        reserve(other.size);
+        for (size_t i = 0; i < other.size; ++i) {
+            push_back(other.data[i]);
+        }
+    }
+
+    SimpleVector(SimpleVector&& other) noexcept(N == 0 || std::is_nothrow_move_constructible<T>::value)
+        : data(inlineData()), size(0), capacity(N) {
+        takeFrom(other);
+    }
+
+    SimpleVector& operator=(const SimpleVector& other) {
+        if (this != &other) {
+            SimpleVector copy(other); // Build the copy first so a throwing copy leaves *this intact
+            clear();
+            takeFrom(copy);
+        }
+        return *this;
+    }
+
+    SimpleVector& operator=(SimpleVector&& other) noexcept(N == 0 || std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            clear();
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    ~SimpleVector() {
+        destroyRange(data, data + size); // Destroy the elements
+        if (!isInline()) {
+            std::free(data); // Free allocated memory
+        }
+    }
+
+    // Make room for at least new_capacity elements without changing the size
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity) {
+            resize(new_capacity);
+        }
+    }
+
+    // Release any capacity beyond the current size (moves back inline when the elements fit)
+    void shrink_to_fit() {
+        if (capacity > size && !isInline()) {
+            resize(size);
+        }
+    }
+
+    // Construct a new element in place at the end
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (size >= capacity) {
+            // The arguments may refer to an element of this vector, so build the
+            // new value before the old storage goes away
+            T value(std::forward<Args>(args)...);
+            resize(GrowthPolicy::grow(capacity));
+            new (data + size) T(std::move(value));
+        } else {
+            new (data + size) T(std::forward<Args>(args)...);
+        }
+        return data[size++]; // Increase size and return the new element
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value); // Add new element and increase size
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value)); // Move the new element in
+    }
+
+    void pop_back() {
+        data[--size].~T(); // Destroy the last element
+    }
+
+    void clear() {
+        destroyRange(data, data + size); // Keep the capacity for reuse
+        size = 0;
+    }
+
+    T& operator[](size_t index) {
+        return data[index]; // Access element by index
+    }
+
+    const T& operator[](size_t index) const {
+        return data[index];
+    }
+
+    T* begin() { return data; }
+    T* end() { return data + size; }
+    const T* begin() const { return data; }
+    const T* end() const { return data + size; }
+
+    size_t getSize() const {
+        return size; // Return current size
+    }
+
+    size_t getCapacity() const {
+        return capacity; // Return current capacity
+    }
+
+    // True while the elements still live in the inline buffer
+    bool usesInlineStorage() const {
+        return N > 0 && isInline();
+    }
+};
+
+// A SimpleVector whose first N elements are stored inline
+template <typename T, size_t N, typename GrowthPolicy = DoubleGrowth>
+using SmallVector = SimpleVector<T, GrowthPolicy, N>;
+
+#endif // SIMPLE_VECTOR_H
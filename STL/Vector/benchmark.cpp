@@ -0,0 +1,52 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "SimpleVector.h"
+#include "../../Benchmarks/AllocationCounter.h"
+
+using namespace std;
+
+/*
+Benchmark: SimpleVector<int> (heap only) vs SmallVector<int, 8> (small-buffer) vs std::vector<int>
+
+- Each round constructs a vector, pushes `elements` ints and destroys it again, which is the
+  "millions of short-lived small vectors" pattern the small-buffer variant is meant for.
+- Allocations are counted by Benchmarks/AllocationCounter.h, which sees std::vector's
+  allocations as well as SimpleVector's.
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static volatile int sink; // Keeps the optimizer from deleting the loops
+
+template <typename Vec>
+void run(const char* name, int elements, int rounds) {
+    size_t allocationsBefore = bench::allocationsSoFar().calls;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        Vec vec;
+        for (int i = 0; i < elements; ++i) {
+            vec.push_back(i + r);
+        }
+        sink = elements > 0 ? vec[0] : r;
+    }
+    auto end = chrono::steady_clock::now();
+    size_t allocations = bench::allocationsSoFar().calls - allocationsBefore;
+
+    double ns = chrono::duration<double, nano>(end - start).count() / rounds;
+    cout << "  " << name << ": " << ns << " ns/vector, "
+         << (double)allocations / rounds << " allocations/vector" << endl;
+}
+
+int main() {
+    const int rounds = 2000000;
+    for (int elements : {0, 4, 7, 16}) {
+        cout << elements << " elements per vector (" << rounds << " vectors):" << endl;
+        run<SimpleVector<int>>("SimpleVector<int>  ", elements, rounds);
+        run<SmallVector<int, 8>>("SmallVector<int, 8>", elements, rounds);
+        run<vector<int>>("std::vector<int>   ", elements, rounds);
+    }
+    return 0;
+}
@@ -1,54 +1,9 @@
 #include <iostream>
-#include <cstdlib> // For std::malloc and std::free
+#include <string>
+#include "SimpleVector.h" // SimpleVector<T, GrowthPolicy>, SmallVector<T, N> and the growth policies
 
 using namespace std; // Use the standard namespace
 
-template <typename T>
-class SimpleVector {
-private:
-    T* data;        // Pointer to the array of elements
-    size_t size;    // Current number of elements
-    size_t capacity; // Allocated capacity
-
-    void resize(size_t new_capacity) {
-        T* new_data = (T*)malloc(new_capacity * sizeof(T)); // Allocate new memory
-        for (size_t i = 0; i < size; ++i) {
-            new_data[i] = data[i]; // Copy old elements to new memory
-        }
-        free(data); // Free old memory
-        data = new_data; // Update the data pointer
-        capacity = new_capacity; // Update capacity
-    }
-
-public:
-    SimpleVector() : size(0), capacity(1) {
-        data = (T*)malloc(capacity * sizeof(T)); // Initial allocation
-    }
-
-    ~SimpleVector() {
-        free(data); // Free allocated memory
-    }
-
-    void push_back(const T& value) {
-        if (size >= capacity) {
-            resize(capacity * 2); // Double the capacity
-        }
-        data[size++] = value; // Add new element and increase size
-    }
-
-    T& operator[](size_t index) {
-        return data[index]; // Access element by index
-    }
-
-    size_t getSize() const {
-        return size; // Return current size
-    }
-
-    size_t getCapacity() const {
-        return capacity; // Return current capacity
-    }
-};
-
 int main() {
     SimpleVector<int> vec;
 
@@ -67,5 +22,46 @@ int main() {
     cout << "Current Size: " << vec.getSize() << endl;
     cout << "Current Capacity: " << vec.getCapacity() << endl;
 
+    // Non-trivial elements with 1.5x growth: elements are moved, never copied, on reallocation
+    SimpleVector<string, HalfGrowth> names;
+    for (int i = 0; i < 10; ++i) {
+        names.emplace_back("record-" + to_string(i)); // Constructed in place
+    }
+    cout << "Strings with 1.5x growth: ";
+    for (const auto& name : names) {
+        cout << name << " ";
+    }
+    cout << endl;
+    cout << "Size: " << names.getSize() << ", Capacity: " << names.getCapacity() << endl;
+
+    // Pre-sizing: one allocation up front, no reallocation inside the loop
+    SimpleVector<string> records;
+    records.reserve(1000);
+    for (int i = 0; i < 1000; ++i) {
+        records.emplace_back(20, 'x'); // string(20, 'x') built directly in the vector
+    }
+    cout << "After reserve(1000) and 1000 emplace_back calls, capacity: " << records.getCapacity() << endl;
+
+    // Giving back unused memory
+    for (int i = 0; i < 900; ++i) {
+        records.pop_back();
+    }
+    records.shrink_to_fit();
+    cout << "After popping 900 and shrink_to_fit, size: " << records.getSize()
+         << ", capacity: " << records.getCapacity() << endl;
+
+    // Small-buffer optimization: up to 8 ints live inside the object, no heap allocation
+    SmallVector<int, 8> small;
+    for (int i = 0; i < 8; ++i) {
+        small.push_back(i);
+    }
+    cout << "SmallVector<int, 8> with 8 elements, inline: " << (small.usesInlineStorage() ? "yes" : "no") << endl;
+    small.push_back(8); // The 9th element moves everything to the heap
+    cout << "After the 9th element, inline: " << (small.usesInlineStorage() ? "yes" : "no")
+         << ", capacity: " << small.getCapacity() << endl;
+    small.pop_back();
+    small.shrink_to_fit(); // Back to the inline buffer
+    cout << "After pop_back and shrink_to_fit, inline: " << (small.usesInlineStorage() ? "yes" : "no") << endl;
+
     return 0; // End of the program
 }
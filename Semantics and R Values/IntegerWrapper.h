@@ -0,0 +1,200 @@
+#ifndef INTEGER_WRAPPER_H
+#define INTEGER_WRAPPER_H
+
+#include <cstddef> // For size_t
+#include "../STL/Allocators/NodePool.h"
+
+// Logging is on by default so the demo shows every special member function being called.
+// Build with -DINTEGER_WRAPPER_LOGGING=0 for production: the logging is compiled out entirely.
+#ifndef INTEGER_WRAPPER_LOGGING
+#define INTEGER_WRAPPER_LOGGING 1
+#endif
+
+// Build with -DINTEGER_WRAPPER_COUNTING=1 to count operations in IntegerWrapperStats (not thread-safe)
+#ifndef INTEGER_WRAPPER_COUNTING
+#define INTEGER_WRAPPER_COUNTING 0
+#endif
+
+#if INTEGER_WRAPPER_LOGGING
+#include <iostream>
+#endif
+
+// Notes:
+// 1. **Where the int Lives (Storage policy)**:
+//    - HeapIntStorage: one `new int` per object, what IntegerWrapper always did.
+//    - PooledIntStorage: ints are carved out of a per-thread NodePool in chunks of 1024, so a
+//      vector of a million wrappers does about a thousand allocations instead of a million.
+//      A pooled wrapper must be destroyed on the thread that created it.
+//
+// 2. **Copy Assignment Reuses the Buffer**:
+//    - Both objects already own an int, so `a = b` just copies the value into a's int.
+//      Only a moved-from object (ptr == nullptr) has to allocate again.
+//
+// 3. **Moved-from Objects**:
+//    - ptr is nullptr after a move. Such an object can be destroyed, assigned to or copied from
+//      (the copy is moved-from too), but getValue() must not be called on it.
+
+// Number of calls of each operation since the last reset() (only with INTEGER_WRAPPER_COUNTING)
+struct IntegerWrapperStats
+{
+    static inline size_t constructions = 0;
+    static inline size_t copies = 0; // Copy constructions
+    static inline size_t moves = 0; // Move constructions
+    static inline size_t copyAssignments = 0;
+    static inline size_t moveAssignments = 0;
+    static inline size_t allocations = 0; // ints taken from the storage
+    static inline size_t destructions = 0;
+
+    static void reset()
+    {
+        constructions = copies = moves = copyAssignments = moveAssignments = allocations = destructions = 0;
+    }
+};
+
+// One heap allocation per int
+struct HeapIntStorage
+{
+    static int *create(int value) { return new int(value); }
+    static void destroy(int *ptr) { delete ptr; }
+};
+
+// ints from a per-thread pool: chunked allocation, freed slots are reused
+struct PooledIntStorage
+{
+    static NodePool<int, 1024> &pool()
+    {
+        static thread_local NodePool<int, 1024> ints;
+        return ints;
+    }
+
+    static int *create(int value) { return pool().create(value); }
+    static void destroy(int *ptr) { pool().destroy(ptr); }
+};
+
+// Example Class: IntegerWrapper
+// This class manages a single dynamically allocated integer, showcasing copy and move semantics, and the noexcept specifier.
+template <typename Storage>
+class BasicIntegerWrapper
+{
+private:
+    static void count([[maybe_unused]] size_t &counter)
+    {
+#if INTEGER_WRAPPER_COUNTING
+        counter++;
+#endif
+    }
+
+    static void log([[maybe_unused]] const char *message, [[maybe_unused]] const int *value)
+    {
+#if INTEGER_WRAPPER_LOGGING
+        std::cout << message;
+        if (value)
+        {
+            std::cout << " with value " << *value;
+        }
+        else
+        {
+            std::cout << " (moved-from)";
+        }
+        std::cout << std::endl;
+#endif
+    }
+
+    static int *allocate(int value)
+    {
+        count(IntegerWrapperStats::allocations);
+        return Storage::create(value);
+    }
+
+    void release()
+    {
+        if (ptr)
+        {
+            Storage::destroy(ptr);
+            ptr = nullptr;
+        }
+    }
+
+public:
+    int *ptr; // Pointer to an integer (nullptr once moved from)
+
+    // Constructor: Allocates memory and initializes the integer.
+    BasicIntegerWrapper(int value) : ptr(allocate(value))
+    {
+        count(IntegerWrapperStats::constructions);
+        log("Constructor: Created IntegerWrapper", ptr);
+    }
+
+    // Copy Constructor: Deep copies the integer value from another IntegerWrapper.
+    BasicIntegerWrapper(const BasicIntegerWrapper &other) : ptr(other.ptr ? allocate(*other.ptr) : nullptr)
+    {
+        count(IntegerWrapperStats::copies);
+        log("Copy Constructor: Copied IntegerWrapper", ptr);
+    }
+
+    // Move Constructor: Transfers ownership of the integer pointer from a temporary IntegerWrapper.
+    BasicIntegerWrapper(BasicIntegerWrapper &&other) noexcept : ptr(other.ptr)
+    {
+        other.ptr = nullptr; // Leave the other object in a valid state
+        count(IntegerWrapperStats::moves);
+        log("Move Constructor: Moved IntegerWrapper", ptr);
+    }
+
+    // Copy Assignment Operator: Handles self-assignment and reuses the existing int when there is one.
+    BasicIntegerWrapper &operator=(const BasicIntegerWrapper &other)
+    {
+        count(IntegerWrapperStats::copyAssignments);
+        log("Copy Assignment: Copying IntegerWrapper", other.ptr);
+        if (this != &other)
+        { // Avoid self-assignment
+            if (!other.ptr)
+            {
+                release(); // Copying a moved-from object
+            }
+            else if (ptr)
+            {
+                *ptr = *other.ptr; // Reuse our int, no allocation
+            }
+            else
+            {
+                ptr = allocate(*other.ptr); // We were moved from
+            }
+        }
+        return *this;
+    }
+
+    // Move Assignment Operator: Transfers resources from a temporary IntegerWrapper.
+    BasicIntegerWrapper &operator=(BasicIntegerWrapper &&other) noexcept
+    {
+        count(IntegerWrapperStats::moveAssignments);
+        log("Move Assignment: Moving IntegerWrapper", other.ptr);
+        if (this != &other)
+        {                        // Avoid self-assignment
+            release();           // Free existing resource
+            ptr = other.ptr;     // Transfer ownership
+            other.ptr = nullptr; // Leave the other object in a valid state
+        }
+        return *this;
+    }
+
+    // Destructor: Cleans up allocated memory.
+    ~BasicIntegerWrapper()
+    {
+        release(); // Free the allocated memory
+        count(IntegerWrapperStats::destructions);
+#if INTEGER_WRAPPER_LOGGING
+        std::cout << "Destructor: Deleted IntegerWrapper" << std::endl;
+#endif
+    }
+
+    // Function to get the value stored in the wrapper.
+    int getValue() const
+    {
+        return *ptr;
+    }
+};
+
+using IntegerWrapper = BasicIntegerWrapper<HeapIntStorage>;
+using PooledIntegerWrapper = BasicIntegerWrapper<PooledIntStorage>;
+
+#endif // INTEGER_WRAPPER_H
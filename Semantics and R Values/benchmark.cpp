@@ -0,0 +1,86 @@
+#define INTEGER_WRAPPER_LOGGING 0 // Production mode
+#define INTEGER_WRAPPER_COUNTING 1
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "IntegerWrapper.h"
+#include "../Benchmarks/AllocationCounter.h"
+
+using namespace std;
+
+/*
+Benchmark: IntegerWrapper (one new int per object) vs PooledIntegerWrapper in a growing std::vector
+
+- Each round pushes `elements` wrappers into a vector, once letting it grow and once with
+  reserve() first. Each growth step moves every element to the new buffer; the moves are
+  cheap pointer handovers only because the move constructor is noexcept (otherwise
+  std::vector would have to copy, allocating a new int per element).
+- The last row copy-assigns one vector into another of the same size: the ints are reused,
+  so no wrapper allocation is needed.
+- Allocations are counted by Benchmarks/AllocationCounter.h: both the vector buffers and
+  the ints.
+
+Build: g++ -std=c++17 -O2 benchmark.cpp -o benchmark
+*/
+
+static volatile int sink; // Keeps the optimizer from deleting the loops
+
+template <typename Func>
+void measure(const char* name, int rounds, Func&& func) {
+    IntegerWrapperStats::reset();
+    size_t allocationsBefore = bench::allocationsSoFar().calls;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        func(r);
+    }
+    auto end = chrono::steady_clock::now();
+    size_t allocations = bench::allocationsSoFar().calls - allocationsBefore;
+
+    double ms = chrono::duration<double, milli>(end - start).count() / rounds;
+    cout << "  " << name << ": " << ms << " ms, copies " << (IntegerWrapperStats::copies + IntegerWrapperStats::copyAssignments) / rounds
+         << ", moves " << IntegerWrapperStats::moves / rounds
+         << ", ints allocated " << IntegerWrapperStats::allocations / rounds
+         << ", malloc calls " << allocations / rounds << endl;
+}
+
+template <typename Wrapper>
+void run(const char* name, int elements, int rounds) {
+    cout << name << ":" << endl;
+    measure("push_back, growing", rounds, [&](int r) {
+        vector<Wrapper> values;
+        for (int i = 0; i < elements; ++i) {
+            values.push_back(i + r);
+        }
+        sink = values.back().getValue();
+    });
+    measure("push_back, reserved", rounds, [&](int r) {
+        vector<Wrapper> values;
+        values.reserve(elements);
+        for (int i = 0; i < elements; ++i) {
+            values.emplace_back(i + r);
+        }
+        sink = values.back().getValue();
+    });
+
+    vector<Wrapper> source, target;
+    for (int i = 0; i < elements; ++i) {
+        source.emplace_back(i);
+        target.emplace_back(-i);
+    }
+    measure("copy-assign vector ", rounds, [&](int) {
+        target = source; // Element-wise copy assignment into existing wrappers
+        sink = target.back().getValue();
+    });
+}
+
+int main() {
+    const int elements = 1000000;
+    const int rounds = 10;
+    cout << elements << " wrappers per vector (" << rounds << " rounds, numbers per round):" << endl;
+    run<IntegerWrapper>("IntegerWrapper", elements, rounds);
+    run<PooledIntegerWrapper>("PooledIntegerWrapper", elements, rounds);
+    return 0;
+}
@@ -1,5 +1,7 @@
 #include <iostream>
 #include <utility> // For std::move
+#include <vector>
+#include "IntegerWrapper.h"
 
 // Notes:
 // This code demonstrates move semantics, value categories, and the use of noexcept
@@ -41,76 +43,17 @@
 //       * Avoid using moved-from objects; they may be in a valid but unspecified state.
 //       * Always provide a noexcept specifier for move operations when possible to enable optimizations.
 
+// 8.  **Production Mode** (see IntegerWrapper.h):
+//     - The logging in every special member function dominates any measurement, so it can be compiled out
+//       with -DINTEGER_WRAPPER_LOGGING=0.
+//     - PooledIntegerWrapper takes its ints from a pool instead of one `new int` per object.
+//     - benchmark.cpp counts the copies, moves and allocations a growing std::vector causes.
 
 
 
 
 
 
-// Example Class: IntegerWrapper
-// This class manages a single dynamically allocated integer, showcasing copy and move semantics, and the noexcept specifier.
-class IntegerWrapper
-{
-public:
-    int *ptr; // Pointer to an integer
-
-    // Constructor: Allocates memory and initializes the integer.
-    IntegerWrapper(int value) : ptr(new int(value))
-    {
-        std::cout << "Constructor: Created IntegerWrapper with value " << *ptr << std::endl;
-    }
-
-    // Copy Constructor: Deep copies the integer value from another IntegerWrapper.
-    IntegerWrapper(const IntegerWrapper &other) : ptr(new int(*other.ptr))
-    {
-        std::cout << "Copy Constructor: Copied IntegerWrapper with value " << *ptr << std::endl;
-    }
-
-    // Move Constructor: Transfers ownership of the integer pointer from a temporary IntegerWrapper.
-    IntegerWrapper(IntegerWrapper &&other) noexcept : ptr(other.ptr)
-    {
-        other.ptr = nullptr; // Leave the other object in a valid state
-        std::cout << "Move Constructor: Moved IntegerWrapper with value " << *ptr << std::endl;
-    }
-
-    // Copy Assignment Operator: Handles copying values and self-assignment, freeing old resources.
-    IntegerWrapper &operator=(const IntegerWrapper &other)
-    {
-        std::cout << "Copy Assignment: Copying IntegerWrapper with value " << *other.ptr << std::endl;
-        if (this != &other)
-        {                              // Avoid self-assignment
-            delete ptr;                // Free existing resource
-            ptr = new int(*other.ptr); // Allocate new memory and copy value
-        }
-        return *this;
-    }
-
-    // Move Assignment Operator: Transfers resources from a temporary IntegerWrapper.
-    IntegerWrapper &operator=(IntegerWrapper &&other) noexcept
-    {
-        std::cout << "Move Assignment: Moving IntegerWrapper with value " << *other.ptr << std::endl;
-        if (this != &other)
-        {                        // Avoid self-assignment
-            delete ptr;          // Free existing resource
-            ptr = other.ptr;     // Transfer ownership
-            other.ptr = nullptr; // Leave the other object in a valid state
-        }
-        return *this;
-    }
-
-    // Destructor: Cleans up allocated memory.
-    ~IntegerWrapper()
-    {
-        delete ptr; // Free the allocated memory
-        std::cout << "Destructor: Deleted IntegerWrapper" << std::endl;
-    }
-
-    // Function to get the value stored in the wrapper.
-    int getValue() const
-    {
-        return *ptr;
-    }
-};
 
 // Practical example
 int main()
@@ -123,5 +66,12 @@ int main()
 
     std::cout << "Value of b: " << b.getValue() << std::endl;
 
+    // Same operations, ints taken from a pool
+    std::vector<PooledIntegerWrapper> pooled;
+    pooled.reserve(2);      // No reallocation, so nothing is moved twice
+    pooled.push_back(7);    // Construct a temporary, move it in
+    pooled.emplace_back(8); // Construct in place
+    std::cout << "Pooled values: " << pooled[0].getValue() << " " << pooled[1].getValue() << std::endl;
+
     return 0;
 }
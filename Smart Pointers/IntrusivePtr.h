@@ -0,0 +1,238 @@
+#ifndef INTRUSIVE_PTR_H
+#define INTRUSIVE_PTR_H
+
+#include <atomic>
+#include <cstddef> // For size_t, std::nullptr_t
+#include <cstdint> // For uint32_t
+#include <new> // For std::align_val_t
+#include <utility> // For std::forward, std::swap
+
+/*
+Notes about IntrusivePtr:
+
+1. **What It Saves Over std::shared_ptr**:
+   - makeIntrusive<T>(args...) puts the reference counts in a small header directly in front
+     of the object, in the same allocation (like make_shared), and the pointer itself is one
+     word: the object's address. A shared_ptr is two words (object + control block), so every
+     copy moves twice as much, and a shared_ptr not made with make_shared keeps its counts in a
+     separate block on another cache line.
+   - The counting policy is a template argument:
+     - AtomicCount (the default): safe to copy and destroy from any thread, like shared_ptr.
+     - LocalCount: plain integer increments, for objects that only one thread ever touches
+       (a per-thread cache, the objects of one simulation step). No lock prefix, no fences -
+       and no safety if two threads share the object after all.
+
+2. **Weak References**:
+   - IntrusiveWeakPtr counts in the same header. The object is destroyed when the last
+     IntrusivePtr goes away; the memory (header + object) when the last weak one does too.
+     lock() only succeeds while the strong count is above zero (increment-if-not-zero).
+
+3. **From `this`**:
+   - intrusiveFromThis(this) makes a new owner from a raw pointer, without the weak_ptr that
+     enable_shared_from_this stores in every object. The object must have been created with
+     makeIntrusive using the same counting policy.
+
+4. **Limits**:
+   - An IntrusivePtr<T> only converts to IntrusivePtr<T>, not to a base class: the header is
+     found at a fixed offset before the T, which only holds for the type that was allocated.
+   - Counts are 32-bit.
+*/
+
+// Thread-safe counts (atomic increments and decrements)
+struct AtomicCount {
+    using Counter = std::atomic<uint32_t>;
+
+    static void increment(Counter& count) { count.fetch_add(1, std::memory_order_relaxed); }
+
+    // Returns true when this was the last reference; the acquire makes the other owners' writes visible to the destructor
+    static bool decrement(Counter& count) { return count.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+    static bool incrementIfNotZero(Counter& count) {
+        uint32_t current = count.load(std::memory_order_relaxed);
+        while (current != 0) {
+            if (count.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed)) return true;
+        }
+        return false;
+    }
+
+    static uint32_t load(const Counter& count) { return count.load(std::memory_order_relaxed); }
+};
+
+// Single-thread counts (plain integers)
+struct LocalCount {
+    using Counter = uint32_t;
+
+    static void increment(Counter& count) { ++count; }
+    static bool decrement(Counter& count) { return --count == 0; }
+
+    static bool incrementIfNotZero(Counter& count) {
+        if (count == 0) return false;
+        ++count;
+        return true;
+    }
+
+    static uint32_t load(const Counter& count) { return count; }
+};
+
+namespace intrusive_detail {
+
+template <typename Counting>
+struct Header {
+    typename Counting::Counter strong;
+    typename Counting::Counter weak; // Weak references, plus one for all the strong ones together
+};
+
+template <typename T, typename Counting>
+struct Layout {
+    static constexpr size_t alignment = alignof(T) > alignof(Header<Counting>) ? alignof(T) : alignof(Header<Counting>);
+    // The header, padded so that the object after it is aligned
+    static constexpr size_t headerSize = (sizeof(Header<Counting>) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    static Header<Counting>* headerOf(T* object) {
+        return reinterpret_cast<Header<Counting>*>(reinterpret_cast<char*>(object) - headerSize);
+    }
+
+    static void releaseWeak(T* object) {
+        Header<Counting>* header = headerOf(object);
+        if (Counting::decrement(header->weak)) {
+            header->~Header<Counting>();
+            ::operator delete(static_cast<void*>(header), std::align_val_t(alignment));
+        }
+    }
+
+    static void releaseStrong(T* object) {
+        if (Counting::decrement(headerOf(object)->strong)) {
+            object->~T();
+            releaseWeak(object); // The weak reference all the strong ones held together
+        }
+    }
+};
+
+} // namespace intrusive_detail
+
+template <typename T, typename Counting = AtomicCount>
+class IntrusiveWeakPtr;
+
+template <typename T, typename Counting = AtomicCount>
+class IntrusivePtr {
+private:
+    using Layout = intrusive_detail::Layout<T, Counting>;
+
+    T* object = nullptr;
+
+    struct Adopt {};
+    IntrusivePtr(T* owned, Adopt) : object(owned) {} // Takes over a reference that was already counted
+
+    template <typename U, typename C, typename... Args>
+    friend IntrusivePtr<U, C> makeIntrusive(Args&&... args);
+    template <typename C, typename U>
+    friend IntrusivePtr<U, C> intrusiveFromThis(U* self);
+    friend class IntrusiveWeakPtr<T, Counting>;
+
+public:
+    using element_type = T;
+
+    IntrusivePtr() = default;
+    IntrusivePtr(std::nullptr_t) {}
+
+    IntrusivePtr(const IntrusivePtr& other) : object(other.object) {
+        if (object) Counting::increment(Layout::headerOf(object)->strong);
+    }
+
+    IntrusivePtr(IntrusivePtr&& other) noexcept : object(other.object) { other.object = nullptr; }
+
+    IntrusivePtr& operator=(IntrusivePtr other) noexcept { // Copy or move, then swap
+        swap(other);
+        return *this;
+    }
+
+    ~IntrusivePtr() {
+        if (object) Layout::releaseStrong(object);
+    }
+
+    void reset() { IntrusivePtr().swap(*this); }
+    void swap(IntrusivePtr& other) noexcept { std::swap(object, other.object); }
+
+    T* get() const { return object; }
+    T& operator*() const { return *object; }
+    T* operator->() const { return object; }
+    explicit operator bool() const { return object != nullptr; }
+
+    uint32_t use_count() const { return object ? Counting::load(Layout::headerOf(object)->strong) : 0; }
+
+    bool operator==(const IntrusivePtr& other) const { return object == other.object; }
+    bool operator!=(const IntrusivePtr& other) const { return object != other.object; }
+    bool operator==(std::nullptr_t) const { return object == nullptr; }
+    bool operator!=(std::nullptr_t) const { return object != nullptr; }
+};
+
+template <typename T, typename Counting>
+class IntrusiveWeakPtr {
+private:
+    using Layout = intrusive_detail::Layout<T, Counting>;
+
+    T* object = nullptr; // May already be destroyed; only the header is still valid then
+
+public:
+    IntrusiveWeakPtr() = default;
+
+    IntrusiveWeakPtr(const IntrusivePtr<T, Counting>& strong) : object(strong.object) {
+        if (object) Counting::increment(Layout::headerOf(object)->weak);
+    }
+
+    IntrusiveWeakPtr(const IntrusiveWeakPtr& other) : object(other.object) {
+        if (object) Counting::increment(Layout::headerOf(object)->weak);
+    }
+
+    IntrusiveWeakPtr(IntrusiveWeakPtr&& other) noexcept : object(other.object) { other.object = nullptr; }
+
+    IntrusiveWeakPtr& operator=(IntrusiveWeakPtr other) noexcept {
+        std::swap(object, other.object);
+        return *this;
+    }
+
+    ~IntrusiveWeakPtr() {
+        if (object) Layout::releaseWeak(object);
+    }
+
+    void reset() { IntrusiveWeakPtr().swap(*this); }
+    void swap(IntrusiveWeakPtr& other) noexcept { std::swap(object, other.object); }
+
+    // An owner if the object is still alive, null otherwise
+    IntrusivePtr<T, Counting> lock() const {
+        if (object && Counting::incrementIfNotZero(Layout::headerOf(object)->strong)) {
+            return IntrusivePtr<T, Counting>(object, typename IntrusivePtr<T, Counting>::Adopt());
+        }
+        return IntrusivePtr<T, Counting>();
+    }
+
+    bool expired() const { return use_count() == 0; }
+    uint32_t use_count() const { return object ? Counting::load(Layout::headerOf(object)->strong) : 0; }
+};
+
+// Counts header and object in one allocation; the object starts with one strong reference
+template <typename T, typename Counting = AtomicCount, typename... Args>
+IntrusivePtr<T, Counting> makeIntrusive(Args&&... args) {
+    using Layout = intrusive_detail::Layout<T, Counting>;
+    using Header = intrusive_detail::Header<Counting>;
+    void* memory = ::operator new(Layout::headerSize + sizeof(T), std::align_val_t(Layout::alignment));
+    Header* header = new (memory) Header{{1}, {1}};
+    T* object;
+    try {
+        object = new (static_cast<char*>(memory) + Layout::headerSize) T(std::forward<Args>(args)...);
+    } catch (...) {
+        header->~Header();
+        ::operator delete(memory, std::align_val_t(Layout::alignment));
+        throw;
+    }
+    return IntrusivePtr<T, Counting>(object, typename IntrusivePtr<T, Counting>::Adopt());
+}
+
+// A new owner of an object that makeIntrusive<T, Counting> created (e.g. from inside a member function)
+template <typename Counting = AtomicCount, typename T>
+IntrusivePtr<T, Counting> intrusiveFromThis(T* self) {
+    Counting::increment(intrusive_detail::Layout<T, Counting>::headerOf(self)->strong);
+    return IntrusivePtr<T, Counting>(self, typename IntrusivePtr<T, Counting>::Adopt());
+}
+
+#endif // INTRUSIVE_PTR_H
@@ -0,0 +1,144 @@
+#ifndef SUBSCRIBER_REGISTRY_H
+#define SUBSCRIBER_REGISTRY_H
+
+#include <cstddef> // For size_t
+#include <cstdint> // For uint32_t
+#include <limits>
+#include <memory> // For std::shared_ptr
+#include <stdexcept> // For std::invalid_argument, std::length_error
+#include <utility> // For std::move
+#include <vector>
+#include "../Concurrency/TaskPool.h"
+
+/*
+Notes about SubscriberRegistry:
+
+1. **What It Replaces**:
+   - A publisher (Library) that keeps vector<shared_ptr<Member>> and calls a member function
+     on each, which then locks a weak_ptr back to the publisher: one atomic increment and one
+     decrement per subscriber per notification, all on the publisher's control block, so with
+     many threads they also bounce that cache line around.
+   - With the registry the publisher checks that it is alive once (it is running notify, so
+     it holds a reference already) and hands itself to every subscriber: deliver(subscriber)
+     needs no lock() at all.
+
+2. **Layout and Batches**:
+   - The subscribers sit in one contiguous vector in subscription order, and notify() walks it
+     front to back. notify(pool, deliver) cuts it into batches of batchSize and runs them as
+     TaskPool tasks, so deliver must be safe to call for different subscribers at once.
+
+3. **Unsubscribing Without Rebuilding**:
+   - subscribe() returns a handle; unsubscribe(handle) is O(1): it only clears the slot and
+     drops the reference. The holes are skipped by notify and squeezed out lazily, in one O(n)
+     pass, once they are more than a quarter of the vector (or when compact() is called).
+     Handles stay valid across compaction; unsubscribed handles are reused.
+   - A null slot means "unsubscribed", so subscribe(nullptr) throws std::invalid_argument.
+   - deliver must not subscribe or unsubscribe: subscribe can grow the vector under the loop,
+     and unsubscribe can destroy the subscriber that is being notified.
+*/
+
+template <typename Subscriber>
+class SubscriberRegistry {
+public:
+    using Handle = uint32_t;
+    static constexpr size_t batchSize = 1024;
+
+private:
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+    struct Entry {
+        std::shared_ptr<Subscriber> subscriber; // Null once unsubscribed
+        Handle handle;
+    };
+
+    std::vector<Entry> entries;
+    std::vector<uint32_t> positions; // Handle -> index in entries, npos while the handle is free
+    std::vector<Handle> freeHandles;
+    size_t holes = 0;
+
+    void compactIfSparse() {
+        if (holes > 0 && holes * 4 > entries.size()) compact();
+    }
+
+    template <typename Deliver>
+    void deliverRange(size_t from, size_t to, Deliver& deliver) {
+        for (size_t i = from; i < to; ++i) {
+            Subscriber* subscriber = entries[i].subscriber.get(); // A plain load: no count is touched
+            if (subscriber) deliver(*subscriber);
+        }
+    }
+
+public:
+    Handle subscribe(std::shared_ptr<Subscriber> subscriber) {
+        if (!subscriber) throw std::invalid_argument("SubscriberRegistry: null subscriber");
+        Handle handle;
+        if (!freeHandles.empty()) {
+            handle = freeHandles.back();
+            freeHandles.pop_back();
+        } else {
+            if (positions.size() >= npos) throw std::length_error("SubscriberRegistry: too many subscribers");
+            handle = static_cast<Handle>(positions.size());
+            positions.push_back(npos);
+        }
+        positions[handle] = static_cast<uint32_t>(entries.size());
+        entries.push_back(Entry{std::move(subscriber), handle});
+        return handle;
+    }
+
+    // false if the handle was not subscribed
+    bool unsubscribe(Handle handle) {
+        if (handle >= positions.size() || positions[handle] == npos) return false;
+        entries[positions[handle]].subscriber.reset();
+        positions[handle] = npos;
+        freeHandles.push_back(handle);
+        ++holes;
+        return true;
+    }
+
+    bool contains(Handle handle) const { return handle < positions.size() && positions[handle] != npos; }
+
+    size_t size() const { return entries.size() - holes; }
+    bool empty() const { return size() == 0; }
+
+    void reserve(size_t count) {
+        entries.reserve(count);
+        positions.reserve(count);
+    }
+
+    // Squeezes out the unsubscribed slots, keeping the order of the others
+    void compact() {
+        size_t kept = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (!entries[i].subscriber) continue;
+            if (kept != i) entries[kept] = std::move(entries[i]);
+            positions[entries[kept].handle] = static_cast<uint32_t>(kept);
+            ++kept;
+        }
+        entries.resize(kept);
+        holes = 0;
+    }
+
+    // deliver(subscriber) for every subscriber, in subscription order
+    template <typename Deliver>
+    void notify(Deliver deliver) {
+        compactIfSparse();
+        deliverRange(0, entries.size(), deliver);
+    }
+
+    // The same, with the batches spread over the pool (in no particular order)
+    template <typename Deliver>
+    void notify(TaskPool& pool, Deliver deliver) {
+        compactIfSparse();
+        size_t batches = (entries.size() + batchSize - 1) / batchSize;
+        if (batches <= 1 || pool.threadCount() <= 1) {
+            deliverRange(0, entries.size(), deliver);
+            return;
+        }
+        pool.parallel_for(0, batches, [&](size_t batch) {
+            size_t from = batch * batchSize;
+            deliverRange(from, from + batchSize < entries.size() ? from + batchSize : entries.size(), deliver);
+        }, 1);
+    }
+};
+
+#endif // SUBSCRIBER_REGISTRY_H
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <memory>
 #include <vector>
+#include "../IntrusivePtr.h"
 
 using namespace std;
 
@@ -21,6 +22,10 @@ using namespace std;
  *    - A single car (ride) can be shared by multiple passengers.
  *    - The car remains available as long as at least one passenger (shared_ptr instance) is still sharing it.
  *    - Once all passengers (shared_ptr instances) leave the car, the car is no longer needed and is destroyed.
+ *
+ * 4. IntrusivePtr (../IntrusivePtr.h):
+ *    - Same sharing, but the count sits in front of the object in one allocation and the pointer is one word.
+ *    - IntrusivePtr<Car, LocalCount> counts without atomic instructions, for objects used by one thread only.
  */
 
 class Car {
@@ -116,5 +121,17 @@ int main() {
     
     cout << "End of main function. Car should be destroyed if no one is sharing it.\n";
 
+    {
+        // The same ride with IntrusivePtr: copying a pointer only bumps the count stored with the car
+        IntrusivePtr<Car> car2 = makeIntrusive<Car>("Volvo XC90");
+        IntrusivePtr<Car> alicesRide = car2;
+        IntrusivePtr<Car> bobsRide = car2;
+        cout << "Number of IntrusivePtr instances owning the car: " << car2.use_count() << endl;
+        bobsRide->drive();
+        bobsRide.reset();
+        alicesRide.reset();
+        cout << "After Alice and Bob leave: " << car2.use_count() << endl;
+    } // car2 is the last owner: the Volvo is destroyed here
+
     return 0;
 }
@@ -26,11 +26,20 @@
  * In this example, we use `shared_ptr` for members to allow shared ownership, 
  * and `weak_ptr` in the `Member` class to avoid circular dependencies. This ensures that 
  * when a member leaves, the library can still be destroyed properly without memory leaks.
+ *
+ * notifyMembers doesn't go through borrowBook's weak_ptr::lock() for every member: the library is alive
+ * while it runs, so it hands itself to each member directly. The members sit in a SubscriberRegistry
+ * (../SubscriberRegistry.h), which can also notify them in parallel and drop removed members lazily.
+ *
+ * IntrusiveWeakPtr (../IntrusivePtr.h) is the weak reference for IntrusivePtr: lock() and expired() work
+ * the same way, and its count is stored next to the object instead of in a separate control block.
  */
 
 #include <iostream>
 #include <memory>
 #include <vector>
+#include "../IntrusivePtr.h"
+#include "../SubscriberRegistry.h"
 
 using namespace std;
 
@@ -46,17 +55,12 @@ public:
         cout << "Member \"" << name << "\" destroyed.\n";
     }
 
-    void setLibrary(shared_ptr<Library> library) {
+    void setLibrary(const shared_ptr<Library>& library) {
         this->library = library; // Shared ownership of Library
     }
 
-    void borrowBook() {
-        if (auto lib = library.lock()) { // Locking weak_ptr to access the shared_ptr to the Library if available
-            cout << name << " borrowed a book from " << lib->getName() << ".\n";
-        } else {
-            cout << name << " cannot access the library. It has been destroyed.\n";
-        }
-    }
+    void borrowBook(); // Defined after Library, which it needs to be complete
+    void borrowBookFrom(const Library& lib); // For a caller that holds the library already: no lock()
 
 private:
     string name; // Name of the member
@@ -77,23 +81,40 @@ public:
         return name;
     }
 
-    void addMember(shared_ptr<Member> member) {
-        members.push_back(member);
+    // Returns the handle removeMember takes
+    SubscriberRegistry<Member>::Handle addMember(const shared_ptr<Member>& member) { // By reference: a by-value copy would cost an extra count increment and decrement
+        auto handle = members.subscribe(member);
         member->setLibrary(shared_from_this()); // Set the library reference in the member
+        return handle;
+    }
+
+    void removeMember(SubscriberRegistry<Member>::Handle handle) {
+        members.unsubscribe(handle);
     }
 
     void notifyMembers() {
         cout << "Notifying members of \"" << name << "\"...\n";
-        for (const auto& member : members) {
-            member->borrowBook();
-        }
+        // This library is alive for the whole call, so no member has to lock() it
+        members.notify([this](Member& member) { member.borrowBookFrom(*this); });
     }
 
 private:
     string name; // Name of the library
-    vector<shared_ptr<Member>> members; // Shared ownership of members
+    SubscriberRegistry<Member> members; // Shared ownership of members, in one contiguous block
 };
 
+void Member::borrowBookFrom(const Library& lib) {
+    cout << name << " borrowed a book from " << lib.getName() << ".\n";
+}
+
+void Member::borrowBook() {
+    if (auto lib = library.lock()) { // Locking weak_ptr to access the shared_ptr to the Library if available
+        borrowBookFrom(*lib);
+    } else {
+        cout << name << " cannot access the library. It has been destroyed.\n";
+    }
+}
+
 int main() {
     // Create a library using shared_ptr
     shared_ptr<Library> library = make_shared<Library>("City Library");
@@ -106,6 +127,11 @@ int main() {
     library->addMember(john);
     library->addMember(alice);
 
+    // A member who joins and leaves again: removing is O(1), the gap is squeezed out later
+    shared_ptr<Member> bob = make_shared<Member>("Bob");
+    auto bobHandle = library->addMember(bob);
+    library->removeMember(bobHandle);
+
     // Notify members to borrow books
     library->notifyMembers();
 
@@ -121,5 +147,12 @@ int main() {
     john->borrowBook();
     alice->borrowBook();
 
+    // The same weak reference with IntrusivePtr
+    IntrusivePtr<Member> guest = makeIntrusive<Member>("Guest");
+    IntrusiveWeakPtr<Member> guestRef = guest;
+    cout << "Is guest expired? " << (guestRef.expired() ? "Yes" : "No") << endl;
+    guest.reset(); // The last owner is gone: the member is destroyed, guestRef only keeps the counts alive
+    cout << "After reset, is guest expired? " << (guestRef.expired() ? "Yes" : "No") << endl;
+
     return 0;
 }